@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _UTIL_ATOMIC_MEMORY_H_
+#define _UTIL_ATOMIC_MEMORY_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+
+/**
+ * \ingroup scc-common
+ */
+/**@{*/
+//! @brief SCC common utilities
+namespace util {
+//! the atomic memory operations
+enum class amo_e : uint8_t {
+    LOAD_RESERVED,     //!< load and set a reservation (LR, exclusive read)
+    STORE_CONDITIONAL, //!< store if the reservation is still valid (SC, exclusive write)
+    SWAP,
+    ADD,
+    AND,
+    OR,
+    XOR,
+    MIN,  //!< signed minimum
+    MAX,  //!< signed maximum
+    MINU, //!< unsigned minimum
+    MAXU, //!< unsigned maximum
+    COMPARE_SWAP
+};
+/**
+ * @brief performs a read-modify-write operation on host memory atomically
+ *
+ * LOAD_RESERVED and STORE_CONDITIONAL are handled as atomic load and compare-and-swap, the reservation needs to be
+ * handled by the caller (see exclusive_monitor).
+ *
+ * @param ptr the naturally aligned location
+ * @param op the operation
+ * @param operand the operand of the operation, the value to store for SWAP, STORE_CONDITIONAL and COMPARE_SWAP
+ * @param expected the value expected at the location for STORE_CONDITIONAL and COMPARE_SWAP
+ * @param success set to false if a STORE_CONDITIONAL or COMPARE_SWAP did not store
+ * @return the value of the location before the operation
+ */
+template <typename T> T atomic_rmw(T* ptr, amo_e op, T operand, T expected, bool& success) {
+    static_assert(std::is_unsigned<T>::value, "atomic_rmw needs an unsigned type");
+    using S = typename std::make_signed<T>::type;
+    success = true;
+#if defined(__GNUC__) || defined(__clang__)
+    auto cas_loop = [ptr, operand](bool (*replace)(T, T)) -> T {
+        T old = __atomic_load_n(ptr, __ATOMIC_RELAXED);
+        while(replace(old, operand) && !__atomic_compare_exchange_n(ptr, &old, operand, true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+            ;
+        return old;
+    };
+    switch(op) {
+    case amo_e::LOAD_RESERVED:
+        return __atomic_load_n(ptr, __ATOMIC_SEQ_CST);
+    case amo_e::STORE_CONDITIONAL:
+    case amo_e::COMPARE_SWAP:
+        success = __atomic_compare_exchange_n(ptr, &expected, operand, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+        return expected;
+    case amo_e::SWAP:
+        return __atomic_exchange_n(ptr, operand, __ATOMIC_SEQ_CST);
+    case amo_e::ADD:
+        return __atomic_fetch_add(ptr, operand, __ATOMIC_SEQ_CST);
+    case amo_e::AND:
+        return __atomic_fetch_and(ptr, operand, __ATOMIC_SEQ_CST);
+    case amo_e::OR:
+        return __atomic_fetch_or(ptr, operand, __ATOMIC_SEQ_CST);
+    case amo_e::XOR:
+        return __atomic_fetch_xor(ptr, operand, __ATOMIC_SEQ_CST);
+    case amo_e::MIN:
+        return cas_loop([](T cur, T val) { return static_cast<S>(val) < static_cast<S>(cur); });
+    case amo_e::MAX:
+        return cas_loop([](T cur, T val) { return static_cast<S>(val) > static_cast<S>(cur); });
+    case amo_e::MINU:
+        return cas_loop([](T cur, T val) { return val < cur; });
+    case amo_e::MAXU:
+        return cas_loop([](T cur, T val) { return val > cur; });
+    }
+    return 0;
+#else
+    // no lock-free access to plain memory available, serialize all operations
+    static std::mutex mtx;
+    std::lock_guard<std::mutex> lock(mtx);
+    T old = *ptr;
+    switch(op) {
+    case amo_e::LOAD_RESERVED:
+        return old;
+    case amo_e::STORE_CONDITIONAL:
+    case amo_e::COMPARE_SWAP:
+        success = old == expected;
+        if(success)
+            *ptr = operand;
+        return old;
+    case amo_e::SWAP:
+        *ptr = operand;
+        break;
+    case amo_e::ADD:
+        *ptr = old + operand;
+        break;
+    case amo_e::AND:
+        *ptr = old & operand;
+        break;
+    case amo_e::OR:
+        *ptr = old | operand;
+        break;
+    case amo_e::XOR:
+        *ptr = old ^ operand;
+        break;
+    case amo_e::MIN:
+        *ptr = static_cast<S>(operand) < static_cast<S>(old) ? operand : old;
+        break;
+    case amo_e::MAX:
+        *ptr = static_cast<S>(operand) > static_cast<S>(old) ? operand : old;
+        break;
+    case amo_e::MINU:
+        *ptr = operand < old ? operand : old;
+        break;
+    case amo_e::MAXU:
+        *ptr = operand > old ? operand : old;
+        break;
+    }
+    return old;
+#endif
+}
+/**
+ * @brief a lock-free exclusive monitor tracking reservations per granule
+ *
+ * Reservations are kept in a table of SLOTS entries indexed by the granule address, each entry holds the granule and
+ * the initiator owning the reservation. A reservation is lost if another granule mapping to the same entry is
+ * reserved (which is a legal spurious failure) or if a write to the granule is reported using clear().
+ * Additionally the value read when reserving is kept per initiator so that the store conditional can be done as
+ * compare-and-swap. This way writes which bypass the monitor (e.g. DMI writes) and change the value also make the
+ * store conditional fail.
+ *
+ * @tparam SLOTS the number of entries of the reservation table, needs to be a power of 2
+ * @tparam MAX_INITIATORS the maximum number of initiators, initiator ids are taken modulo this number
+ */
+template <unsigned SLOTS = 1024, unsigned MAX_INITIATORS = 256> class exclusive_monitor {
+    static_assert((SLOTS & (SLOTS - 1)) == 0, "SLOTS needs to be a power of 2");
+    static_assert(MAX_INITIATORS <= 256, "at most 256 initiators are supported");
+
+public:
+    /**
+     * @brief constructs an exclusive monitor
+     *
+     * @param granule_bits the log2 of the size of the reservation granule in bytes
+     */
+    explicit exclusive_monitor(unsigned granule_bits = 6)
+    : granule_bits(granule_bits) {
+        for(auto& s : slots)
+            s.store(0, std::memory_order_relaxed);
+    }
+    /**
+     * @brief sets a reservation for the granule containing addr
+     *
+     * @param id the initiator id
+     * @param addr the reserved address
+     * @param value the value read at the address
+     */
+    void reserve(unsigned id, uint64_t addr, uint64_t value) {
+        id %= MAX_INITIATORS;
+        values[id] = value;
+        auto& slot = slots[index(addr)];
+        if(!slot.exchange(tag(id, addr), std::memory_order_acq_rel))
+            active_cnt.fetch_add(1, std::memory_order_relaxed);
+    }
+    /**
+     * @brief checks and removes the reservation of an initiator
+     *
+     * @param id the initiator id
+     * @param addr the address to store to
+     * @param value the value read when reserving
+     * @return true if the initiator holds the reservation for the granule containing addr
+     */
+    bool check_and_clear(unsigned id, uint64_t addr, uint64_t& value) {
+        id %= MAX_INITIATORS;
+        auto expected = tag(id, addr);
+        if(!slots[index(addr)].compare_exchange_strong(expected, 0, std::memory_order_acq_rel))
+            return false;
+        active_cnt.fetch_sub(1, std::memory_order_relaxed);
+        value = values[id];
+        return true;
+    }
+    /**
+     * @brief removes all reservations of the granules touched by a write
+     *
+     * @param addr the start address of the write
+     * @param len the length of the write
+     */
+    void clear(uint64_t addr, uint64_t len) {
+        if(!active_cnt.load(std::memory_order_relaxed) || !len)
+            return;
+        for(auto g = addr >> granule_bits; g <= (addr + len - 1) >> granule_bits; ++g) {
+            auto& slot = slots[g & (SLOTS - 1)];
+            auto cur = slot.load(std::memory_order_acquire);
+            if((cur >> 8) == g + 1 && slot.compare_exchange_strong(cur, 0, std::memory_order_acq_rel))
+                active_cnt.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+    /**
+     * @brief removes all reservations
+     */
+    void reset() {
+        for(auto& s : slots)
+            s.store(0, std::memory_order_relaxed);
+        active_cnt.store(0, std::memory_order_release);
+    }
+    /**
+     * @brief returns true if there is at least one reservation
+     */
+    bool active() const { return active_cnt.load(std::memory_order_relaxed) != 0; }
+
+private:
+    size_t index(uint64_t addr) const { return (addr >> granule_bits) & (SLOTS - 1); }
+    uint64_t tag(unsigned id, uint64_t addr) const { return ((addr >> granule_bits) + 1) << 8 | id; }
+
+    unsigned const granule_bits;
+    std::array<std::atomic<uint64_t>, SLOTS> slots;
+    std::array<uint64_t, MAX_INITIATORS> values{};
+    std::atomic<unsigned> active_cnt{0};
+};
+} // namespace util
+/**@}*/
+#endif // _UTIL_ATOMIC_MEMORY_H_
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "checkpoint_file.h"
+#include <algorithm>
+#include <cstring>
+#include <lz4.h>
+#include <stdexcept>
+#include <thread>
+
+namespace util {
+namespace {
+char const file_magic[] = "SCCCKP01";
+char const index_magic[] = "SCCCKPIX";
+constexpr size_t magic_size = 8;
+constexpr size_t footer_size = 8 + magic_size;
+constexpr uint64_t block_size = 16 * 1024 * 1024;
+constexpr uint32_t raw_block_flag = 1U << 31;
+
+void put(std::vector<char>& buf, uint64_t val, unsigned bytes) {
+    for(auto i = 0U; i < bytes; ++i)
+        buf.push_back(static_cast<char>((val >> (8 * i)) & 0xff));
+}
+
+uint64_t get(char const* buf, unsigned bytes) {
+    uint64_t ret = 0;
+    for(auto i = 0U; i < bytes; ++i)
+        ret |= static_cast<uint64_t>(static_cast<uint8_t>(buf[i])) << (8 * i);
+    return ret;
+}
+} // namespace
+
+checkpoint_writer::checkpoint_writer(std::string const& name, unsigned threads)
+: file(fopen(name.c_str(), "wb"))
+, threads(threads ? threads : std::max(1U, std::thread::hardware_concurrency())) {
+    if(!file)
+        throw std::runtime_error("Cannot open " + name);
+    fwrite(file_magic, 1, magic_size, file);
+    file_offset = magic_size;
+}
+
+checkpoint_writer::~checkpoint_writer() {
+    try {
+        close();
+    } catch(std::exception&) {
+    }
+}
+
+void checkpoint_writer::add(std::string const& name, void const* data, uint64_t size) {
+    if(name.size() > UINT16_MAX)
+        throw std::runtime_error("Record name too long: " + name);
+    auto src = static_cast<char const*>(data);
+    std::vector<char> buffer;
+    buffer.reserve(LZ4_compressBound(static_cast<int>(std::min(size, block_size))) + 4);
+    for(uint64_t pos = 0; pos < size; pos += block_size) {
+        auto len = static_cast<int>(std::min(size - pos, block_size));
+        auto hdr = buffer.size();
+        put(buffer, 0, 4);
+        buffer.resize(hdr + 4 + LZ4_compressBound(len));
+        auto clen = LZ4_compress_default(src + pos, buffer.data() + hdr + 4, len, LZ4_compressBound(len));
+        if(clen <= 0 || clen >= len) { // incompressible data is stored as is
+            std::copy(src + pos, src + pos + len, buffer.data() + hdr + 4);
+            clen = len;
+            len |= raw_block_flag;
+        } else
+            len = clen;
+        buffer.resize(hdr + 4 + clen);
+        for(auto i = 0U; i < 4; ++i)
+            buffer[hdr + i] = static_cast<char>((static_cast<uint32_t>(len) >> (8 * i)) & 0xff);
+    }
+    std::lock_guard<std::mutex> lock(mtx);
+    if(!file)
+        throw std::runtime_error("Cannot write to closed file");
+    if(fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size())
+        throw std::runtime_error("Cannot write record " + name);
+    index.push_back(entry{name, file_offset, buffer.size(), size});
+    file_offset += buffer.size();
+}
+
+void checkpoint_writer::add_async(std::string const& name, void const* data, uint64_t size) {
+    if(!pool) {
+        pool.reset(new thread_pool);
+        pool->start(threads);
+    }
+    pending.push_back(pool->enqueue([this, name, data, size]() { add(name, data, size); }));
+}
+
+void checkpoint_writer::close() {
+    if(!file)
+        return;
+    std::exception_ptr error;
+    for(auto& f : pending)
+        try {
+            f.get();
+        } catch(...) {
+            error = std::current_exception();
+        }
+    pending.clear();
+    pool.reset();
+    std::vector<char> buffer;
+    put(buffer, index.size(), 8);
+    for(auto const& e : index) {
+        put(buffer, e.name.size(), 2);
+        buffer.insert(buffer.end(), e.name.begin(), e.name.end());
+        put(buffer, e.offset, 8);
+        put(buffer, e.compressed_size, 8);
+        put(buffer, e.size, 8);
+    }
+    put(buffer, file_offset, 8);
+    buffer.insert(buffer.end(), index_magic, index_magic + magic_size);
+    auto written = fwrite(buffer.data(), 1, buffer.size(), file);
+    fclose(file);
+    file = nullptr;
+    index.clear();
+    if(error)
+        std::rethrow_exception(error);
+    if(written != buffer.size())
+        throw std::runtime_error("Cannot write checkpoint index");
+}
+
+checkpoint_reader::checkpoint_reader(std::string const& name)
+: file(new mmap_region(name, false, 0, 0, true)) {
+    auto data = reinterpret_cast<char const*>(file->data());
+    auto const fsize = file->size();
+    if(fsize < magic_size + footer_size || memcmp(data, file_magic, magic_size) ||
+       memcmp(data + fsize - magic_size, index_magic, magic_size))
+        throw std::runtime_error(name + " is not a valid checkpoint image");
+    auto pos = get(data + fsize - footer_size, 8);
+    auto const index_end = fsize - footer_size;
+    if(pos + 8 > index_end)
+        throw std::runtime_error(name + " has a corrupted index");
+    auto count = get(data + pos, 8);
+    pos += 8;
+    for(uint64_t i = 0; i < count; ++i) {
+        if(pos + 2 > index_end)
+            throw std::runtime_error(name + " has a corrupted index");
+        auto len = get(data + pos, 2);
+        pos += 2;
+        if(pos + len + 24 > index_end)
+            throw std::runtime_error(name + " has a corrupted index");
+        std::string rec_name(data + pos, len);
+        pos += len;
+        entry e{get(data + pos, 8), get(data + pos + 8, 8), get(data + pos + 16, 8)};
+        pos += 24;
+        if(e.offset + e.compressed_size > index_end)
+            throw std::runtime_error(name + " has a corrupted record " + rec_name);
+        index[rec_name] = e;
+    }
+}
+
+uint64_t checkpoint_reader::size(std::string const& name) const {
+    auto it = index.find(name);
+    return it == index.end() ? 0 : it->second.size;
+}
+
+std::vector<std::string> checkpoint_reader::names(std::string const& prefix) const {
+    std::vector<std::string> ret;
+    for(auto it = index.lower_bound(prefix); it != index.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it)
+        ret.push_back(it->first);
+    return ret;
+}
+
+bool checkpoint_reader::read(std::string const& name, void* dst, uint64_t size) const {
+    auto it = index.find(name);
+    if(it == index.end() || it->second.size != size)
+        return false;
+    auto src = reinterpret_cast<char const*>(file->data()) + it->second.offset;
+    auto const src_end = src + it->second.compressed_size;
+    auto out = static_cast<char*>(dst);
+    for(uint64_t pos = 0; pos < size; pos += block_size) {
+        auto const len = static_cast<int>(std::min(size - pos, block_size));
+        if(src + 4 > src_end)
+            return false;
+        auto hdr = static_cast<uint32_t>(get(src, 4));
+        src += 4;
+        auto clen = static_cast<int>(hdr & ~raw_block_flag);
+        if(src + clen > src_end)
+            return false;
+        if(hdr & raw_block_flag) {
+            if(clen != len)
+                return false;
+            std::copy(src, src + clen, out + pos);
+        } else if(LZ4_decompress_safe(src, out + pos, clen, len) != len)
+            return false;
+        src += clen;
+    }
+    return true;
+}
+
+std::string checkpoint_reader::read(std::string const& name) const {
+    std::string ret(size(name), '\0');
+    if(ret.size() && !read(name, &ret[0], ret.size()))
+        ret.clear();
+    return ret;
+}
+} // namespace util
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _UTIL_CHECKPOINT_FILE_H_
+#define _UTIL_CHECKPOINT_FILE_H_
+
+#include "mmap_region.h"
+#include "thread_pool.h"
+#include <cstdint>
+#include <cstdio>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * \ingroup scc-common
+ */
+/**@{*/
+//! @brief SCC common utilities
+namespace util {
+/**
+ * @brief writer of a checkpoint image
+ *
+ * A checkpoint image is a set of named records which are compressed independently. The file layout is
+ * - 8 byte file magic "SCCCKP01"
+ * - the records, each being a sequence of LZ4 blocks of at most 16MiB uncompressed data. Each block is preceded by
+ *   its size (uint32_t), if bit 31 of the size is set the block is stored uncompressed
+ * - the index: the record count (uint64_t) followed by name length (uint16_t), name, offset, compressed size and
+ *   size (uint64_t each) per record
+ * - a footer consisting of the index offset (uint64_t) and the 8 byte magic "SCCCKPIX"
+ *
+ * All integers are stored little endian. Records can be added from several threads, add_async() compresses them
+ * in a thread pool.
+ */
+class checkpoint_writer {
+public:
+    /**
+     * @brief creates the image file
+     *
+     * @param name the file name
+     * @param threads the number of compression threads used by add_async(), 0 uses one per host core
+     */
+    explicit checkpoint_writer(std::string const& name, unsigned threads = 0);
+
+    ~checkpoint_writer();
+
+    bool is_open() const { return file != nullptr; }
+    /**
+     * @brief compresses and appends a record, may be called concurrently
+     *
+     * @param name the unique name of the record
+     * @param data the data of the record
+     * @param size the size of the data in bytes
+     */
+    void add(std::string const& name, void const* data, uint64_t size);
+
+    void add(std::string const& name, std::string const& data) { add(name, data.data(), data.size()); }
+    /**
+     * @brief appends a record being compressed in the thread pool
+     *
+     * The data needs to stay valid and unchanged until close() returns.
+     */
+    void add_async(std::string const& name, void const* data, uint64_t size);
+    /**
+     * @brief waits for all pending records, writes the index and closes the file
+     */
+    void close();
+
+    checkpoint_writer(const checkpoint_writer&) = delete;
+    checkpoint_writer& operator=(const checkpoint_writer&) = delete;
+
+private:
+    FILE* file{nullptr};
+    uint64_t file_offset{0};
+    std::mutex mtx;
+    struct entry {
+        std::string name;
+        uint64_t offset, compressed_size, size;
+    };
+    std::vector<entry> index;
+    unsigned const threads;
+    std::unique_ptr<thread_pool> pool;
+    std::vector<std::future<void>> pending;
+};
+/**
+ * @brief reader of a checkpoint image
+ *
+ * The file is memory mapped, records are only decompressed when being read. Reading is thread-safe.
+ */
+class checkpoint_reader {
+public:
+    /**
+     * @brief opens an image
+     *
+     * @param name the file name
+     * @throws std::runtime_error if the file cannot be mapped or is not a checkpoint image
+     */
+    explicit checkpoint_reader(std::string const& name);
+    /**
+     * @brief returns true if the image contains a record with the given name
+     */
+    bool contains(std::string const& name) const { return index.count(name) != 0; }
+    /**
+     * @brief returns the uncompressed size of a record or 0 if it does not exist
+     */
+    uint64_t size(std::string const& name) const;
+    /**
+     * @brief returns the names of all records starting with prefix in lexicographical order
+     */
+    std::vector<std::string> names(std::string const& prefix = "") const;
+    /**
+     * @brief decompresses a record into a buffer
+     *
+     * @param name the name of the record
+     * @param dst the destination buffer
+     * @param size the size of the buffer which needs to match the size of the record
+     * @return true if the record exists and has been decompressed successfully
+     */
+    bool read(std::string const& name, void* dst, uint64_t size) const;
+    /**
+     * @brief returns the content of a record, an empty string if it does not exist
+     */
+    std::string read(std::string const& name) const;
+
+    checkpoint_reader(const checkpoint_reader&) = delete;
+    checkpoint_reader& operator=(const checkpoint_reader&) = delete;
+
+private:
+    struct entry {
+        uint64_t offset, compressed_size, size;
+    };
+    std::map<std::string, entry> index;
+    std::unique_ptr<mmap_region> file;
+};
+} // namespace util
+/**@}*/
+#endif // _UTIL_CHECKPOINT_FILE_H_
@@ -0,0 +1,328 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "chunked_lz4_file.h"
+#include <algorithm>
+#include <cstring>
+#include <lz4frame.h>
+#include <stdexcept>
+
+namespace util {
+namespace {
+char const file_magic[] = "SCCCHK01";
+char const index_magic[] = "SCCCHKIX";
+constexpr size_t magic_size = 8;
+constexpr size_t chunk_header_size = 8;
+constexpr size_t footer_size = 16 + magic_size;
+
+void put(std::vector<char>& buf, uint64_t val, unsigned bytes) {
+    for(auto i = 0U; i < bytes; ++i)
+        buf.push_back(static_cast<char>((val >> (8 * i)) & 0xff));
+}
+
+uint64_t get(char const* buf, unsigned bytes) {
+    uint64_t ret = 0;
+    for(auto i = 0U; i < bytes; ++i)
+        ret |= static_cast<uint64_t>(static_cast<uint8_t>(buf[i])) << (8 * i);
+    return ret;
+}
+
+LZ4F_preferences_t make_prefs(int level) {
+    LZ4F_preferences_t prefs;
+    memset(&prefs, 0, sizeof(prefs));
+    prefs.compressionLevel = level;
+    return prefs;
+}
+} // namespace
+
+chunked_lz4_writer::chunked_lz4_writer(std::string const& base_name, std::string const& extension, config const& cfg)
+: base_name(base_name)
+, extension(extension)
+, cfg(cfg) {
+    buffer.reserve(cfg.chunk_size + cfg.chunk_size / 8);
+    open_file();
+}
+
+chunked_lz4_writer::~chunked_lz4_writer() { close(); }
+
+void chunked_lz4_writer::begin_record(uint64_t time, uint64_t stream) {
+    if(!file)
+        throw std::runtime_error("Cannot write to closed file");
+    if(buffer.size() >= cfg.chunk_size)
+        flush_chunk();
+    if((cfg.max_file_size && file_offset >= cfg.max_file_size) ||
+       (cfg.max_file_time && file_start_time != UINT64_MAX && time >= file_start_time + cfg.max_file_time)) {
+        close_file();
+        open_file();
+        if(!file)
+            throw std::runtime_error("Cannot open " + file_name);
+    }
+    if(file_start_time == UINT64_MAX)
+        file_start_time = time;
+    current.start_time = std::min(current.start_time, time);
+    current.end_time = std::max(current.end_time, time);
+    add_record_stream(stream);
+}
+
+void chunked_lz4_writer::add_record_stream(uint64_t stream) {
+    // streams are recorded in chunk order, most of the time the last one matches
+    if(current.streams.empty() || current.streams.back() != stream) {
+        auto it = std::lower_bound(current.streams.begin(), current.streams.end(), stream);
+        if(it == current.streams.end() || *it != stream)
+            current.streams.insert(it, stream);
+    }
+}
+
+void chunked_lz4_writer::write_definition(char const* data, size_t size) {
+    definitions.insert(definitions.end(), data, data + size);
+    write(data, size);
+    current.flags |= chunk_info::DEFINITIONS;
+}
+
+void chunked_lz4_writer::close() {
+    if(file)
+        close_file();
+}
+
+void chunked_lz4_writer::open_file() {
+    if(cfg.max_file_size || cfg.max_file_time)
+        file_name = base_name + "." + std::to_string(file_idx++) + extension;
+    else
+        file_name = base_name + extension;
+    file = fopen(file_name.c_str(), "wb");
+    if(!file)
+        return;
+    fwrite(file_magic, 1, magic_size, file);
+    file_offset = magic_size;
+    file_start_time = UINT64_MAX;
+    written_files.push_back(file_name);
+    if(cfg.max_files)
+        while(written_files.size() > cfg.max_files) {
+            std::remove(written_files.front().c_str());
+            written_files.pop_front();
+        }
+    if(definitions.size()) {
+        buffer = definitions;
+        current.flags = chunk_info::DEFINITIONS;
+        flush_chunk();
+    }
+}
+
+void chunked_lz4_writer::close_file() {
+    flush_chunk();
+    std::vector<char> idx;
+    for(auto const& c : index) {
+        put(idx, c.offset, 8);
+        put(idx, c.compressed_size, 4);
+        put(idx, c.size, 4);
+        put(idx, c.start_time, 8);
+        put(idx, c.end_time, 8);
+        put(idx, c.flags, 4);
+        put(idx, c.streams.size(), 4);
+        for(auto s : c.streams)
+            put(idx, s, 8);
+    }
+    put(idx, file_offset, 8);
+    put(idx, index.size(), 8);
+    idx.insert(idx.end(), index_magic, index_magic + magic_size);
+    fwrite(idx.data(), 1, idx.size(), file);
+    fclose(file);
+    file = nullptr;
+    index.clear();
+}
+
+void chunked_lz4_writer::flush_chunk() {
+    if(buffer.empty())
+        return;
+    auto prefs = make_prefs(cfg.level);
+    compressed.resize(chunk_header_size + LZ4F_compressFrameBound(buffer.size(), &prefs));
+    auto csize =
+        LZ4F_compressFrame(compressed.data() + chunk_header_size, compressed.size() - chunk_header_size, buffer.data(), buffer.size(), &prefs);
+    if(LZ4F_isError(csize))
+        throw std::runtime_error(std::string("LZ4 compression failed: ") + LZ4F_getErrorName(csize));
+    std::vector<char> hdr;
+    put(hdr, csize, 4);
+    put(hdr, buffer.size(), 4);
+    std::copy(hdr.begin(), hdr.end(), compressed.begin());
+    fwrite(compressed.data(), 1, chunk_header_size + csize, file);
+    if(current.start_time > current.end_time) // chunk without timed records
+        current.start_time = current.end_time = index.size() ? index.back().end_time : 0;
+    current.offset = file_offset;
+    current.compressed_size = csize;
+    current.size = buffer.size();
+    index.push_back(std::move(current));
+    current = chunk_info();
+    file_offset += chunk_header_size + csize;
+    buffer.clear();
+}
+
+chunked_lz4_reader::chunked_lz4_reader(std::string const& name)
+: file(fopen(name.c_str(), "rb")) {
+    if(!file)
+        throw std::runtime_error("fopen failed");
+    char magic[magic_size];
+    if(fread(magic, 1, magic_size, file) != magic_size || memcmp(magic, file_magic, magic_size)) {
+        fclose(file);
+        throw std::runtime_error("not a chunked LZ4 file");
+    }
+    try {
+        indexed = read_index();
+    } catch(...) {
+        fclose(file);
+        throw;
+    }
+    if(!indexed)
+        scan();
+    max_end_time.reserve(index.size());
+    uint64_t max_time = 0;
+    for(auto const& c : index) {
+        max_time = std::max(max_time, c.end_time);
+        max_end_time.push_back(max_time);
+    }
+}
+
+chunked_lz4_reader::~chunked_lz4_reader() { fclose(file); }
+
+bool chunked_lz4_reader::read_index() {
+    if(fseek(file, 0, SEEK_END))
+        return false;
+    uint64_t const file_size = ftell(file);
+    if(file_size < magic_size + footer_size || fseek(file, file_size - footer_size, SEEK_SET))
+        return false;
+    char footer[footer_size];
+    if(fread(footer, 1, footer_size, file) != footer_size || memcmp(footer + 16, index_magic, magic_size))
+        return false;
+    // from here on the file claims to be indexed, so an inconsistent index is an error rather than a reason to scan
+    auto idx_offset = get(footer, 8);
+    auto count = get(footer + 8, 8);
+    uint64_t const idx_end = file_size - footer_size;
+    if(idx_offset < magic_size || idx_offset > idx_end || count > (idx_end - idx_offset) / 40)
+        throw std::runtime_error("corrupt chunked LZ4 index: footer out of bounds");
+    std::vector<char> buf(idx_end - idx_offset);
+    if(fseek(file, idx_offset, SEEK_SET) || fread(buf.data(), 1, buf.size(), file) != buf.size())
+        throw std::runtime_error("corrupt chunked LZ4 index: index not readable");
+    index.resize(count);
+    auto p = buf.data();
+    auto const end = buf.data() + buf.size();
+    for(auto& c : index) {
+        if(end - p < 40)
+            throw std::runtime_error("corrupt chunked LZ4 index: entry out of bounds");
+        c.offset = get(p, 8);
+        c.compressed_size = get(p + 8, 4);
+        c.size = get(p + 12, 4);
+        c.start_time = get(p + 16, 8);
+        c.end_time = get(p + 24, 8);
+        c.flags = get(p + 32, 4);
+        auto stream_count = get(p + 36, 4);
+        p += 40;
+        if(c.offset < magic_size || c.offset + chunk_header_size + c.compressed_size > idx_offset)
+            throw std::runtime_error("corrupt chunked LZ4 index: chunk out of bounds");
+        if(stream_count > static_cast<uint64_t>(end - p) / 8)
+            throw std::runtime_error("corrupt chunked LZ4 index: stream list out of bounds");
+        c.streams.resize(stream_count);
+        for(auto& s : c.streams) {
+            s = get(p, 8);
+            p += 8;
+        }
+    }
+    if(p != end)
+        throw std::runtime_error("corrupt chunked LZ4 index: size mismatch");
+    return true;
+}
+
+void chunked_lz4_reader::scan() {
+    index.clear();
+    if(fseek(file, 0, SEEK_END))
+        return;
+    uint64_t const file_size = ftell(file);
+    fseek(file, magic_size, SEEK_SET);
+    char hdr[chunk_header_size];
+    uint64_t offset = magic_size;
+    while(fread(hdr, 1, chunk_header_size, file) == chunk_header_size) {
+        chunk_info c;
+        c.offset = offset;
+        c.compressed_size = get(hdr, 4);
+        c.size = get(hdr + 4, 4);
+        // the time range is unknown, so each chunk needs to be considered
+        c.start_time = 0;
+        c.end_time = UINT64_MAX;
+        c.flags = chunk_info::DEFINITIONS;
+        // a chunk cut off by an aborted write is dropped, seeking past the end of the file would not fail
+        if(offset + chunk_header_size + c.compressed_size > file_size || fseek(file, c.compressed_size, SEEK_CUR))
+            break;
+        offset += chunk_header_size + c.compressed_size;
+        index.push_back(c);
+    }
+}
+
+size_t chunked_lz4_reader::find(uint64_t time) const {
+    return std::lower_bound(max_end_time.begin(), max_end_time.end(), time) - max_end_time.begin();
+}
+
+std::vector<size_t> chunked_lz4_reader::select(uint64_t start, uint64_t end, std::vector<uint64_t> const& streams) const {
+    std::vector<size_t> ret;
+    auto first = find(start);
+    for(size_t i = 0; i < index.size(); ++i) {
+        auto const& c = index[i];
+        if(c.flags & chunk_info::DEFINITIONS) {
+            ret.push_back(i);
+            continue;
+        }
+        if(i < first)
+            continue;
+        if(c.start_time > end) {
+            // chunks are written in time order so we can stop unless the time range is unknown
+            if(indexed)
+                break;
+            continue;
+        }
+        if(streams.empty() || c.streams.empty() ||
+           std::any_of(streams.begin(), streams.end(), [&c](uint64_t s) { return std::binary_search(c.streams.begin(), c.streams.end(), s); }))
+            ret.push_back(i);
+    }
+    return ret;
+}
+
+std::string chunked_lz4_reader::read(size_t idx) const {
+    auto const& c = index.at(idx);
+    std::vector<char> src(c.compressed_size);
+    fseek(file, c.offset + chunk_header_size, SEEK_SET);
+    if(fread(src.data(), 1, src.size(), file) != src.size())
+        throw std::runtime_error("could not read chunk");
+    std::string ret(c.size, '\0');
+    LZ4F_decompressionContext_t ctx;
+    auto res = LZ4F_createDecompressionContext(&ctx, LZ4F_VERSION);
+    if(LZ4F_isError(res))
+        throw std::runtime_error(std::string("Failed to create LZ4 context: ") + LZ4F_getErrorName(res));
+    size_t src_pos = 0, dst_pos = 0;
+    while(src_pos < src.size() && dst_pos < ret.size()) {
+        auto src_size = src.size() - src_pos;
+        auto dst_size = ret.size() - dst_pos;
+        res = LZ4F_decompress(ctx, &ret[dst_pos], &dst_size, src.data() + src_pos, &src_size, nullptr);
+        if(LZ4F_isError(res)) {
+            LZ4F_freeDecompressionContext(ctx);
+            throw std::runtime_error(std::string("LZ4 decompression failed: ") + LZ4F_getErrorName(res));
+        }
+        src_pos += src_size;
+        dst_pos += dst_size;
+        if(res == 0)
+            break;
+    }
+    LZ4F_freeDecompressionContext(ctx);
+    ret.resize(dst_pos);
+    return ret;
+}
+} // namespace util
@@ -0,0 +1,179 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _UTIL_CHUNKED_LZ4_FILE_H_
+#define _UTIL_CHUNKED_LZ4_FILE_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace util {
+/**
+ * @brief description of a single chunk of a chunked LZ4 file
+ *
+ * The file layout is
+ * - 8 byte file magic "SCCCHK01"
+ * - a sequence of chunks, each consisting of a chunk header (uint32_t compressed size, uint32_t uncompressed size)
+ *   followed by an independent LZ4 frame
+ * - the index: for each chunk offset, compressed and uncompressed size, time range, flags and the list of stream ids
+ * - a footer consisting of the index offset (uint64_t), the chunk count (uint64_t) and the 8 byte magic "SCCCHKIX"
+ *
+ * All integers are stored little endian. A file without footer (e.g. after a crash) can still be read by scanning
+ * the chunk headers, the time ranges and stream ids are unknown in this case.
+ */
+struct chunk_info {
+    //! chunk contains definitions (data written using write_definition())
+    static constexpr uint32_t DEFINITIONS = 1;
+    uint64_t offset{0};
+    uint32_t compressed_size{0};
+    uint32_t size{0};
+    uint64_t start_time{UINT64_MAX};
+    uint64_t end_time{0};
+    uint32_t flags{0};
+    std::vector<uint64_t> streams;
+};
+/**
+ * @brief writer of an LZ4 compressed, chunked and indexed file
+ *
+ * The data is collected into chunks of (at least) chunk_size bytes which are compressed independently. Chunks are
+ * only cut at record boundaries (calls to begin_record()). Each chunk records the time range and the set of
+ * streams of the records it contains. If max_file_size or max_file_time is set the output is rotated into
+ * <base_name>.<n><extension> files, each starting with all definitions written so far. If max_files is set only
+ * the last max_files files are kept on disk.
+ */
+class chunked_lz4_writer {
+public:
+    struct config {
+        //! the uncompressed size of a chunk
+        size_t chunk_size{4 * 1024 * 1024};
+        //! the (compressed) file size triggering a rotation, 0 disables size based rotation
+        uint64_t max_file_size{0};
+        //! the time span covered by a file triggering a rotation, 0 disables time based rotation
+        uint64_t max_file_time{0};
+        //! the number of rotated files to keep, 0 keeps all files
+        unsigned max_files{0};
+        //! the LZ4 compression level
+        int level{0};
+    };
+
+    chunked_lz4_writer(std::string const& base_name, std::string const& extension, config const& cfg);
+
+    chunked_lz4_writer(std::string const& base_name, std::string const& extension)
+    : chunked_lz4_writer(base_name, extension, config()) {}
+
+    ~chunked_lz4_writer();
+
+    bool is_open() const { return file != nullptr; }
+    /**
+     * @brief starts a new record, this is the only place where a chunk may be cut
+     *
+     * @param time the time stamp of the record
+     * @param stream the id of the stream the record belongs to
+     */
+    void begin_record(uint64_t time, uint64_t stream);
+    /**
+     * @brief adds a further stream the current record belongs to, e.g. for records relating two streams
+     */
+    void add_record_stream(uint64_t stream);
+    /**
+     * @brief appends data to the current record
+     */
+    void write(char const* data, size_t size) { buffer.insert(buffer.end(), data, data + size); }
+    /**
+     * @brief writes definition data which is repeated at the beginning of each rotated file
+     */
+    void write_definition(char const* data, size_t size);
+    /**
+     * @brief flushes the current chunk, writes the index and closes the file
+     */
+    void close();
+    /**
+     * @brief returns the name of the file currently being written
+     */
+    std::string const& current_file_name() const { return file_name; }
+
+    chunked_lz4_writer(const chunked_lz4_writer&) = delete;
+    chunked_lz4_writer(chunked_lz4_writer&&) = delete;
+    chunked_lz4_writer& operator=(const chunked_lz4_writer&) = delete;
+    chunked_lz4_writer& operator=(chunked_lz4_writer&&) = delete;
+
+private:
+    void open_file();
+    void close_file();
+    void flush_chunk();
+
+    std::string const base_name;
+    std::string const extension;
+    config const cfg;
+    FILE* file{nullptr};
+    std::string file_name;
+    unsigned file_idx{0};
+    std::deque<std::string> written_files;
+    uint64_t file_offset{0};
+    uint64_t file_start_time{UINT64_MAX};
+    std::vector<char> buffer;
+    std::vector<char> compressed;
+    std::vector<char> definitions;
+    chunk_info current;
+    std::vector<chunk_info> index;
+};
+/**
+ * @brief reader of a file written by chunked_lz4_writer
+ */
+class chunked_lz4_reader {
+public:
+    explicit chunked_lz4_reader(std::string const& name);
+
+    ~chunked_lz4_reader();
+    /**
+     * @brief returns true if the file had a valid index, otherwise the index has been rebuilt by scanning the file
+     */
+    bool has_index() const { return indexed; }
+
+    std::vector<chunk_info> const& chunks() const { return index; }
+    /**
+     * @brief finds the first chunk which may contain records at or after the given time in O(log n)
+     *
+     * @return the index of the chunk or chunks().size() if there is none
+     */
+    size_t find(uint64_t time) const;
+    /**
+     * @brief returns the indexes of all chunks containing records of one of the given streams in the time
+     * range [start, end] plus all chunks containing definitions
+     */
+    std::vector<size_t> select(uint64_t start, uint64_t end, std::vector<uint64_t> const& streams = {}) const;
+    /**
+     * @brief reads and decompresses a single chunk
+     */
+    std::string read(size_t idx) const;
+
+    chunked_lz4_reader(const chunked_lz4_reader&) = delete;
+    chunked_lz4_reader& operator=(const chunked_lz4_reader&) = delete;
+
+private:
+    bool read_index();
+    void scan();
+
+    FILE* file;
+    bool indexed{false};
+    std::vector<chunk_info> index;
+    std::vector<uint64_t> max_end_time;
+};
+} // namespace util
+#endif // _UTIL_CHUNKED_LZ4_FILE_H_
@@ -0,0 +1,201 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _UTIL_DIRTY_BITMAP_H_
+#define _UTIL_DIRTY_BITMAP_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+/**
+ * \ingroup scc-common
+ */
+/**@{*/
+//! @brief SCC common utilities
+namespace util {
+/**
+ * @brief a bitmap tracking which granules of an address range have been written
+ *
+ * Each bit represents a granule of 2^granule_bits bytes. The bitmap is split into chunks which are only allocated
+ * when a granule in it is marked so that large and sparsely written address ranges only need little memory. Marking
+ * is lock-free and may be done concurrently from several threads, marking an already dirty granule does not write
+ * to the bitmap.
+ */
+class dirty_bitmap {
+    static constexpr unsigned chunk_words = 4096;
+
+public:
+    /**
+     * @brief constructs a bitmap covering the address range [0, size)
+     *
+     * @param size the size of the tracked address range in bytes
+     * @param granule_bits the log2 of the tracking granularity in bytes
+     */
+    dirty_bitmap(uint64_t size, unsigned granule_bits = 12)
+    : size(size)
+    , granule_bits(granule_bits) {
+        if(!size || granule_bits > 63)
+            throw std::runtime_error("invalid dirty bitmap configuration");
+        auto const words = (((size - 1) >> granule_bits) >> 6) + 1;
+        chunk_cnt = (words + chunk_words - 1) / chunk_words;
+        chunks.reset(new std::atomic<std::atomic<uint64_t>*>[chunk_cnt]);
+        for(uint64_t i = 0; i < chunk_cnt; ++i)
+            chunks[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    dirty_bitmap(dirty_bitmap const&) = delete;
+
+    dirty_bitmap& operator=(dirty_bitmap const&) = delete;
+
+    ~dirty_bitmap() {
+        for(uint64_t i = 0; i < chunk_cnt; ++i)
+            delete[] chunks[i].load(std::memory_order_relaxed);
+    }
+    /**
+     * @brief returns the size of a granule in bytes
+     */
+    uint64_t granule_size() const { return 1ULL << granule_bits; }
+    /**
+     * @brief marks all granules touched by an access as dirty
+     *
+     * @param addr the start address
+     * @param len the number of bytes
+     */
+    void mark(uint64_t addr, uint64_t len) {
+        for_each_word(addr, len, true, [](std::atomic<uint64_t>& w, uint64_t mask) {
+            if((w.load(std::memory_order_relaxed) & mask) != mask)
+                w.fetch_or(mask, std::memory_order_relaxed);
+            return false;
+        });
+    }
+    /**
+     * @brief checks if any granule touched by an address range is dirty
+     *
+     * @param addr the start address
+     * @param len the number of bytes
+     * @return true if at least one granule is dirty
+     */
+    bool is_dirty(uint64_t addr, uint64_t len = 1) {
+        return for_each_word(addr, len, false,
+                             [](std::atomic<uint64_t>& w, uint64_t mask) { return (w.load(std::memory_order_relaxed) & mask) != 0; });
+    }
+    /**
+     * @brief clears the dirty state of all granules touched by an address range
+     *
+     * @param addr the start address
+     * @param len the number of bytes
+     */
+    void clear(uint64_t addr, uint64_t len) {
+        for_each_word(addr, len, false, [](std::atomic<uint64_t>& w, uint64_t mask) {
+            if(w.load(std::memory_order_relaxed) & mask)
+                w.fetch_and(~mask, std::memory_order_relaxed);
+            return false;
+        });
+    }
+    /**
+     * @brief clears the complete bitmap
+     */
+    void clear() { for_each_dirty([](uint64_t, uint64_t) {}, true); }
+    /**
+     * @brief calls a functor for each contiguous range of dirty granules
+     *
+     * The ranges are reported in ascending order, the last range is clipped to the size of the bitmap.
+     *
+     * @param cb the functor being called with the start address and the length of a dirty range
+     * @param clear if true the reported granules are cleared atomically while being collected
+     */
+    void for_each_dirty(std::function<void(uint64_t, uint64_t)> const& cb, bool clear = false) {
+        uint64_t start = 0, end = 0;
+        for(uint64_t c = 0; c < chunk_cnt; ++c) {
+            auto chunk = chunks[c].load(std::memory_order_acquire);
+            if(!chunk)
+                continue;
+            for(unsigned i = 0; i < chunk_words; ++i) {
+                auto bits = clear ? chunk[i].exchange(0, std::memory_order_relaxed) : chunk[i].load(std::memory_order_relaxed);
+                while(bits) {
+                    auto bit = count_trailing_zeros(bits);
+                    bits &= bits - 1;
+                    auto addr = (((c * chunk_words + i) << 6) + bit) << granule_bits;
+                    if(end != addr) {
+                        if(end > start)
+                            cb(start, end - start);
+                        start = addr;
+                    }
+                    end = std::min(size, addr + granule_size());
+                }
+            }
+        }
+        if(end > start)
+            cb(start, end - start);
+    }
+
+private:
+    static unsigned count_trailing_zeros(uint64_t v) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(v);
+#else
+        unsigned n = 0;
+        for(; !(v & 1); v >>= 1)
+            ++n;
+        return n;
+#endif
+    }
+
+    std::atomic<uint64_t>* get_chunk(uint64_t idx, bool allocate) {
+        auto chunk = chunks[idx].load(std::memory_order_acquire);
+        if(chunk || !allocate)
+            return chunk;
+        auto* new_chunk = new std::atomic<uint64_t>[chunk_words];
+        for(unsigned i = 0; i < chunk_words; ++i)
+            new_chunk[i].store(0, std::memory_order_relaxed);
+        if(chunks[idx].compare_exchange_strong(chunk, new_chunk, std::memory_order_acq_rel))
+            return new_chunk;
+        delete[] new_chunk; // another thread was faster
+        return chunk;
+    }
+    //! calls func for each bitmap word touched by the range until func returns true
+    template <typename FUNC> bool for_each_word(uint64_t addr, uint64_t len, bool allocate, FUNC func) {
+        if(!len || addr >= size)
+            return false;
+        auto const first = addr >> granule_bits;
+        auto const last = (std::min(size - addr, len) - 1 + addr) >> granule_bits;
+        for(auto g = first; g <= last;) {
+            auto const word = g >> 6;
+            auto const lo = g & 63;
+            auto const hi = std::min<uint64_t>(63, lo + (last - g));
+            auto const mask = (hi == 63 ? ~0ULL : (1ULL << (hi + 1)) - 1) & ~((1ULL << lo) - 1);
+            if(auto chunk = get_chunk(word / chunk_words, allocate)) {
+                if(func(chunk[word % chunk_words], mask))
+                    return true;
+                g += hi - lo + 1;
+            } else // skip the complete unallocated chunk
+                g = (word / chunk_words + 1) * chunk_words * 64;
+        }
+        return false;
+    }
+
+    uint64_t const size;
+    unsigned const granule_bits;
+    uint64_t chunk_cnt{0};
+    std::unique_ptr<std::atomic<std::atomic<uint64_t>*>[]> chunks;
+};
+} // namespace util
+/**@}*/
+#endif // _UTIL_DIRTY_BITMAP_H_
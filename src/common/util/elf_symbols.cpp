@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "elf_symbols.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+namespace util {
+namespace {
+char const elf_magic[] = {0x7f, 'E', 'L', 'F'};
+enum { ELF_CLASS32 = 1, ELF_CLASS64 = 2, ELF_DATA2LSB = 1, SHT_SYMTAB = 2, SHT_DYNSYM = 11, STT_SECTION = 3, STT_FILE = 4, STB_LOCAL = 0 };
+
+struct elf_reader {
+    const uint8_t* base;
+    uint64_t size;
+    bool little_endian;
+
+    uint64_t get(uint64_t offs, unsigned bytes) const {
+        if(offs > size || bytes > size - offs)
+            throw std::runtime_error("ELF file is truncated");
+        uint64_t ret = 0;
+        for(auto i = 0U; i < bytes; ++i) {
+            auto shift = little_endian ? 8 * i : 8 * (bytes - 1 - i);
+            ret |= static_cast<uint64_t>(base[offs + i]) << shift;
+        }
+        return ret;
+    }
+};
+
+struct section {
+    uint64_t type;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t link;
+    uint64_t entsize;
+};
+} // namespace
+
+elf_symbol_table::elf_symbol_table(std::string const& name, uint8_t expected_elf_class, uint16_t expected_elf_machine)
+: file(new mmap_region(name, false, 0, 0, true)) {
+    elf_reader elf{file->data(), file->size(), true};
+    if(file->size() < 16 || memcmp(file->data(), elf_magic, sizeof(elf_magic)))
+        throw std::runtime_error(name + " is not an ELF file");
+    auto elf_class = file->data()[4];
+    elf.little_endian = file->data()[5] == ELF_DATA2LSB;
+    if(elf_class != ELF_CLASS32 && elf_class != ELF_CLASS64)
+        throw std::runtime_error("Unknown ELF class");
+    if(expected_elf_class && elf_class != expected_elf_class)
+        throw std::runtime_error("ELF Class missmatch");
+    if(expected_elf_machine && elf.get(18, 2) != expected_elf_machine)
+        throw std::runtime_error("ELF Machine type missmatch");
+    auto const is64 = elf_class == ELF_CLASS64;
+    auto const word = is64 ? 8U : 4U;
+    auto shoff = elf.get(is64 ? 40 : 32, word);
+    auto shentsize = elf.get(is64 ? 58 : 46, 2);
+    auto shnum = elf.get(is64 ? 60 : 48, 2);
+    auto read_section = [&](uint64_t idx) -> section {
+        auto sh = shoff + idx * shentsize;
+        return section{elf.get(sh + 4, 4), elf.get(sh + (is64 ? 24 : 16), word), elf.get(sh + (is64 ? 32 : 20), word),
+                       elf.get(sh + (is64 ? 40 : 24), 4), elf.get(sh + (is64 ? 56 : 36), word)};
+    };
+    section symtab{0, 0, 0, 0, 0};
+    for(uint64_t i = 0; i < shnum; ++i) {
+        auto s = read_section(i);
+        if(s.type == SHT_SYMTAB || (s.type == SHT_DYNSYM && symtab.type != SHT_SYMTAB))
+            symtab = s;
+    }
+    if(!symtab.type)
+        return;
+    if(symtab.link >= shnum)
+        throw std::runtime_error("Invalid string table index");
+    auto str = read_section(symtab.link);
+    if(str.offset > file->size() || str.size > file->size() - str.offset)
+        throw std::runtime_error("ELF string table exceeds the file size");
+    strtab = reinterpret_cast<char const*>(file->data() + str.offset);
+    strtab_size = str.size;
+    auto const entsize = symtab.entsize ? symtab.entsize : (is64 ? 24 : 16);
+    auto const count = symtab.size / entsize;
+    entries.reserve(count);
+    for(uint64_t i = 1; i < count; ++i) {
+        auto sym = symtab.offset + i * entsize;
+        auto name_offs = elf.get(sym, 4);
+        auto info = elf.get(sym + (is64 ? 4 : 12), 1);
+        auto shndx = elf.get(sym + (is64 ? 6 : 14), 2);
+        auto type = info & 0xf;
+        if(!name_offs || name_offs >= strtab_size || !shndx || type == STT_SECTION || type == STT_FILE)
+            continue;
+        entries.push_back(entry{elf.get(sym + (is64 ? 8 : 4), word), elf.get(sym + (is64 ? 16 : 8), word), static_cast<uint32_t>(name_offs),
+                                static_cast<uint8_t>(type), (info >> 4) != STB_LOCAL});
+    }
+    // among symbols at the same address the preferred one comes first
+    auto rank = [](entry const& e) { return (e.global ? 0 : 2) + (e.type == FUNC || e.type == OBJECT ? 0 : 1); };
+    std::sort(entries.begin(), entries.end(), [&rank](entry const& a, entry const& b) {
+        return a.address < b.address || (a.address == b.address && rank(a) < rank(b));
+    });
+    entries.shrink_to_fit();
+}
+
+nonstd::string_view elf_symbol_table::name_of(entry const& e) const {
+    auto p = strtab + e.name_offs;
+    return nonstd::string_view(p, strnlen(p, strtab_size - e.name_offs));
+}
+
+elf_symbol_table::symbol elf_symbol_table::to_symbol(entry const& e) const {
+    return symbol{name_of(e), e.address, e.size, static_cast<symbol_type>(e.type), e.global};
+}
+
+elf_symbol_table::symbol elf_symbol_table::at(size_t idx) const { return to_symbol(entries.at(idx)); }
+
+bool elf_symbol_table::find(uint64_t addr, symbol& sym) const {
+    auto it = std::upper_bound(entries.begin(), entries.end(), addr, [](uint64_t a, entry const& e) { return a < e.address; });
+    if(it == entries.begin())
+        return false;
+    auto const sym_addr = std::prev(it)->address;
+    it = std::lower_bound(entries.begin(), it, sym_addr, [](entry const& e, uint64_t a) { return e.address < a; });
+    if(it->size && addr - it->address >= it->size)
+        return false;
+    sym = to_symbol(*it);
+    return true;
+}
+
+bool elf_symbol_table::find(nonstd::string_view name, symbol& sym) const {
+    std::call_once(name_index_built, [this]() {
+        name_index.reserve(entries.size());
+        // insert global symbols first so they take precedence over local ones with the same name
+        for(auto global : {true, false})
+            for(size_t i = 0; i < entries.size(); ++i)
+                if(entries[i].global == global)
+                    name_index.emplace(name_of(entries[i]), static_cast<uint32_t>(i));
+    });
+    auto it = name_index.find(name);
+    if(it == name_index.end())
+        return false;
+    sym = to_symbol(entries[it->second]);
+    return true;
+}
+
+std::string elf_symbol_table::to_string(uint64_t addr) const {
+    std::ostringstream os;
+    symbol sym;
+    if(find(addr, sym)) {
+        os << sym.name;
+        if(addr != sym.address)
+            os << "+0x" << std::hex << addr - sym.address;
+    } else
+        os << "0x" << std::hex << addr;
+    return os.str();
+}
+} // namespace util
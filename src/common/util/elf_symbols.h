@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _UTIL_ELF_SYMBOLS_H_
+#define _UTIL_ELF_SYMBOLS_H_
+
+#include "mmap_region.h"
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <nonstd/string_view.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \ingroup scc-common
+ */
+/**@{*/
+//! @brief SCC common utilities
+namespace util {
+/**
+ * @brief an index of the symbols of an ELF file
+ *
+ * The file is memory mapped and the symbol names are referenced in the mapped string table, they are never copied.
+ * The symbols are kept in an array sorted by address so that the symbol covering an address (e.g. a PC) is found
+ * using a binary search. The hash map used to look up symbols by name is only built upon the first lookup by name.
+ * All lookups are thread-safe.
+ */
+class elf_symbol_table {
+public:
+    enum symbol_type { NOTYPE = 0, OBJECT = 1, FUNC = 2 };
+    //! a symbol, the name references the memory mapped file and is valid as long as the table exists
+    struct symbol {
+        nonstd::string_view name;
+        uint64_t address;
+        uint64_t size;
+        symbol_type type;
+        bool global;
+    };
+    /**
+     * @brief reads the symbol table (.symtab or if not present .dynsym) of an ELF file
+     *
+     * @param name the file name
+     * @param expected_elf_class the expected ELF class (1 for ELF32, 2 for ELF64), 0 accepts both
+     * @param expected_elf_machine the expected ELF machine, 0 accepts all
+     */
+    explicit elf_symbol_table(std::string const& name, uint8_t expected_elf_class = 0, uint16_t expected_elf_machine = 0);
+    /**
+     * @brief returns the number of (defined) symbols
+     */
+    size_t size() const { return entries.size(); }
+    /**
+     * @brief returns the i-th symbol in address order
+     */
+    symbol at(size_t idx) const;
+    /**
+     * @brief finds the symbol covering an address in O(log n)
+     *
+     * This is the symbol with the highest address less than or equal to addr. If the symbol has a size the
+     * address needs to be within it. Among symbols with the same address global functions and objects are preferred.
+     *
+     * @param addr the address to look up
+     * @param sym the symbol found
+     * @return true if a symbol has been found
+     */
+    bool find(uint64_t addr, symbol& sym) const;
+    /**
+     * @brief finds a symbol by name, global symbols take precedence over local ones
+     *
+     * @param name the symbol name
+     * @param sym the symbol found
+     * @return true if a symbol has been found
+     */
+    bool find(nonstd::string_view name, symbol& sym) const;
+    /**
+     * @brief formats an address as <symbol>+<offset> or as hex number if no symbol covers it
+     */
+    std::string to_string(uint64_t addr) const;
+
+    elf_symbol_table(const elf_symbol_table&) = delete;
+    elf_symbol_table& operator=(const elf_symbol_table&) = delete;
+
+private:
+    struct entry {
+        uint64_t address;
+        uint64_t size;
+        uint32_t name_offs;
+        uint8_t type;
+        bool global;
+    };
+    struct name_hash {
+        size_t operator()(nonstd::string_view const& s) const {
+            // FNV-1a, std::hash<nonstd::string_view> would create a temporary std::string
+            uint64_t h = 14695981039346656037ULL;
+            for(auto c : s)
+                h = (h ^ static_cast<uint8_t>(c)) * 1099511628211ULL;
+            return static_cast<size_t>(h);
+        }
+    };
+    nonstd::string_view name_of(entry const& e) const;
+    symbol to_symbol(entry const& e) const;
+
+    std::unique_ptr<mmap_region> file;
+    char const* strtab{nullptr};
+    uint64_t strtab_size{0};
+    std::vector<entry> entries;
+    mutable std::once_flag name_index_built;
+    mutable std::unordered_map<nonstd::string_view, uint32_t, name_hash> name_index;
+};
+} // namespace util
+/**@}*/
+#endif // _UTIL_ELF_SYMBOLS_H_
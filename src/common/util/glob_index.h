@@ -0,0 +1,428 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _UTIL_GLOB_INDEX_H_
+#define _UTIL_GLOB_INDEX_H_
+
+#include "ities.h"
+#include <algorithm>
+#include <cctype>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <regex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * \ingroup scc-common
+ */
+/**@{*/
+//! @brief SCC common utilities
+namespace util {
+namespace impl {
+/**
+ * @brief the level-wise matching of glob patterns shared by glob_index and name_index
+ *
+ * Only patterns which are guaranteed to match the same names as glob_to_regex() are split into levels, all others
+ * (e.g. patterns with escapes, negated or empty character classes, classes containing the separator or ** within a
+ * level) are matched using std::regex.
+ */
+struct glob_levels {
+#ifdef MTI_SYSTEMC
+    static constexpr char default_separator = '/';
+#else
+    static constexpr char default_separator = '.';
+#endif
+    //! returns true if the pattern is a regular expression and not a glob
+    static bool is_regex(std::string const& pattern) { return pattern.size() && pattern[0] == '^'; }
+    //! splits a pattern into levels, returns false if the pattern needs to be matched using std::regex
+    static bool split(std::string const& pattern, char separator, std::vector<std::string>& levels) {
+        if(pattern.empty() || is_regex(pattern) || std::isspace(static_cast<unsigned char>(pattern.front())) ||
+           std::isspace(static_cast<unsigned char>(pattern.back())) || pattern.find('\\') != std::string::npos)
+            return false;
+        std::string level;
+        for(size_t i = 0; i < pattern.size(); ++i) {
+            auto c = pattern[i];
+            if(c == '[') {
+                auto end = pattern.find(']', i + 1);
+                if(end == std::string::npos || end == i + 1 || pattern[i + 1] == '!' || pattern[i + 1] == '^' ||
+                   !valid_class(pattern.substr(i + 1, end - i - 1), separator))
+                    return false; // negated classes also match the separator, empty ones are not handled here
+                level += pattern.substr(i, end - i + 1);
+                i = end;
+                continue;
+            } else if(c == separator) {
+                levels.push_back(level);
+                level.clear();
+                continue;
+            } else if(c == '*' && i + 1 < pattern.size() && pattern[i + 1] == '*') {
+                if(level.size() || (i + 2 < pattern.size() && pattern[i + 2] != separator))
+                    return false; // ** within a level
+                level += "**";
+                ++i;
+                continue;
+            }
+            level += c;
+        }
+        levels.push_back(level);
+        return true;
+    }
+    //! checks that a character class contains neither the separator nor nested brackets and has ascending ranges
+    static bool valid_class(std::string const& cls, char separator) {
+        for(size_t i = 0; i < cls.size(); ++i) {
+            if(cls[i] == separator || cls[i] == '[' || cls[i] == '-')
+                return false; // a dash is only allowed as range operator
+            if(i + 2 < cls.size() && cls[i + 1] == '-') {
+                if(cls[i + 2] == separator || cls[i + 2] == '[' || cls[i + 2] == '-' || cls[i] > cls[i + 2] ||
+                   (cls[i] < separator && cls[i + 2] > separator))
+                    return false;
+                i += 2;
+            }
+        }
+        return true;
+    }
+    //! the regular expression for patterns which cannot be split into levels
+    static std::regex to_regex(std::string const& pattern) { return std::regex(is_regex(pattern) ? pattern : glob_to_regex(pattern)); }
+
+    static bool is_literal(std::string const& level) { return level.find_first_of("*?[") == std::string::npos; }
+    //! matches a single character class or literal at p against c, advances p on success
+    static bool match_char(char const*& p, char const* pe, char c) {
+        if(*p == '?') {
+            ++p;
+            return true;
+        }
+        if(*p != '[') {
+            if(*p != c)
+                return false;
+            ++p;
+            return true;
+        }
+        auto q = p + 1;
+        bool found = false;
+        while(q < pe && *q != ']') {
+            auto lo = *q++;
+            auto hi = lo;
+            if(q + 1 < pe && *q == '-') {
+                hi = q[1];
+                q += 2;
+            }
+            found |= c >= lo && c <= hi;
+        }
+        if(!found)
+            return false;
+        p = q + 1;
+        return true;
+    }
+    //! matches a glob pattern without hierarchy separators against a single level
+    static bool match_level(std::string const& pattern, std::string const& level) {
+        auto p = pattern.data();
+        auto const pe = p + pattern.size();
+        auto s = level.data();
+        auto const se = s + level.size();
+        char const* star_p = nullptr;
+        char const* star_s = nullptr;
+        while(s != se) {
+            if(p != pe && *p == '*') {
+                star_p = ++p;
+                star_s = s;
+            } else if(p != pe && match_char(p, pe, *s)) {
+                ++s;
+            } else if(star_p) { // backtrack, let the last * consume one more character
+                p = star_p;
+                s = ++star_s;
+            } else
+                return false;
+        }
+        while(p != pe && *p == '*')
+            ++p;
+        return p == pe;
+    }
+
+    static std::vector<std::string> split_name(std::string const& name, char separator) {
+        std::vector<std::string> levels;
+        size_t start = 0;
+        for(auto pos = name.find(separator); pos != std::string::npos; pos = name.find(separator, start)) {
+            levels.push_back(name.substr(start, pos - start));
+            start = pos + 1;
+        }
+        levels.push_back(name.substr(start));
+        return levels;
+    }
+};
+} // namespace impl
+/**
+ * @brief an index of hierarchical glob patterns to find the patterns matching a name
+ *
+ * The patterns use the syntax of glob_to_regex(): ? and * match within a hierarchy level, ** matches across levels
+ * and character classes ([a-z] and [!a-z]) are supported. Patterns starting with a caret (^) are regular
+ * expressions. A name matches a pattern exactly if it matches the regular expression created by glob_to_regex().
+ *
+ * The patterns are stored in a trie keyed by the hierarchy levels. Literal levels are looked up in a hash map, so
+ * finding the patterns matching a name is proportional to the depth of the name and the number of wildcards on the
+ * way instead of the number of patterns. Regular expressions and the glob patterns listed in impl::glob_levels are
+ * matched using std::regex.
+ *
+ * @tparam T the type of the value associated to a pattern
+ */
+template <typename T> class glob_index {
+    struct node {
+        std::unordered_map<std::string, std::unique_ptr<node>> literals;
+        std::vector<std::pair<std::string, std::unique_ptr<node>>> globs;
+        //! the child of a ** level matching one or more levels
+        std::unique_ptr<node> any_levels;
+        std::vector<size_t> ids;
+    };
+
+public:
+    static constexpr char default_separator = impl::glob_levels::default_separator;
+    /**
+     * @brief constructs an empty index
+     *
+     * @param separator the character separating the hierarchy levels
+     */
+    explicit glob_index(char separator = default_separator)
+    : separator(separator) {}
+    /**
+     * @brief adds a pattern
+     *
+     * @param pattern the glob pattern or regular expression
+     * @param value the value associated to the pattern
+     * @return false if the pattern is already in the index, the value is not changed in this case
+     * @throws std::regex_error if the pattern needs to be matched using an invalid regular expression
+     */
+    bool insert(std::string const& pattern, T const& value) {
+        if(ids.count(pattern))
+            return false;
+        auto const id = values.size();
+        std::vector<std::string> levels;
+        if(!impl::glob_levels::split(pattern, separator, levels))
+            regexes.emplace_back(impl::glob_levels::to_regex(pattern), id);
+        else {
+            auto* n = &root;
+            for(auto& level : levels) {
+                if(level == "**") {
+                    if(!n->any_levels)
+                        n->any_levels.reset(new node);
+                    n = n->any_levels.get();
+                } else if(impl::glob_levels::is_literal(level)) {
+                    auto& child = n->literals[level];
+                    if(!child)
+                        child.reset(new node);
+                    n = child.get();
+                } else {
+                    auto it = std::find_if(n->globs.begin(), n->globs.end(),
+                                           [&level](std::pair<std::string, std::unique_ptr<node>> const& e) { return e.first == level; });
+                    if(it == n->globs.end()) {
+                        n->globs.emplace_back(level, std::unique_ptr<node>(new node));
+                        it = std::prev(n->globs.end());
+                    }
+                    n = it->second.get();
+                }
+            }
+            n->ids.push_back(id);
+        }
+        values.push_back(value);
+        ids[pattern] = id;
+        return true;
+    }
+    /**
+     * @brief finds the value of the first inserted pattern matching a name
+     *
+     * @param name the hierarchical name
+     * @return pointer to the value or nullptr if no pattern matches
+     */
+    T const* find(std::string const& name) const {
+        if(values.empty())
+            return nullptr;
+        auto best = std::numeric_limits<size_t>::max();
+        auto const levels = impl::glob_levels::split_name(name, separator);
+        match(root, levels, 0, best);
+        for(auto const& e : regexes)
+            if(e.second < best && std::regex_match(name, e.first))
+                best = e.second;
+        return best < values.size() ? &values[best] : nullptr;
+    }
+    /**
+     * @brief returns true if at least one pattern matches the name
+     */
+    bool matches(std::string const& name) const { return find(name) != nullptr; }
+    /**
+     * @brief returns the value of a pattern
+     *
+     * @param pattern the pattern as given to insert()
+     * @return pointer to the value or nullptr if the pattern is not in the index
+     */
+    T const* get(std::string const& pattern) const {
+        auto it = ids.find(pattern);
+        return it == ids.end() ? nullptr : &values[it->second];
+    }
+
+    bool empty() const { return values.empty(); }
+
+    size_t size() const { return values.size(); }
+
+private:
+    static void match(node const& n, std::vector<std::string> const& levels, size_t idx, size_t& best) {
+        if(idx == levels.size()) {
+            for(auto id : n.ids)
+                best = std::min(best, id);
+            return;
+        }
+        auto it = n.literals.find(levels[idx]);
+        if(it != n.literals.end())
+            match(*it->second, levels, idx + 1, best);
+        for(auto const& g : n.globs)
+            if(impl::glob_levels::match_level(g.first, levels[idx]))
+                match(*g.second, levels, idx + 1, best);
+        if(n.any_levels)
+            for(auto next = idx + 1; next <= levels.size(); ++next)
+                match(*n.any_levels, levels, next, best);
+    }
+
+    char const separator;
+    node root;
+    std::vector<std::pair<std::regex, size_t>> regexes;
+    // a deque keeps the values addressable for any T (std::vector<bool> does not)
+    std::deque<T> values;
+    std::unordered_map<std::string, size_t> ids;
+};
+/**
+ * @brief an index of hierarchical names to find the names matching a glob pattern
+ *
+ * This is the counterpart of glob_index: the names are stored in a trie keyed by the hierarchy levels and a pattern
+ * is matched level by level, so literal levels of the pattern are hash lookups. Patterns which cannot be split into
+ * levels (see impl::glob_levels) are matched against all names using std::regex.
+ *
+ * @tparam T the type of the value associated to a name
+ */
+template <typename T> class name_index {
+    struct node {
+        std::unordered_map<std::string, std::unique_ptr<node>> children;
+        std::unique_ptr<std::pair<std::string const, T>> entry;
+    };
+
+public:
+    explicit name_index(char separator = impl::glob_levels::default_separator)
+    : separator(separator) {}
+    /**
+     * @brief adds a name or replaces its value
+     */
+    void insert(std::string const& name, T const& value) {
+        auto* n = &root;
+        for(auto& level : impl::glob_levels::split_name(name, separator)) {
+            auto& child = n->children[level];
+            if(!child)
+                child.reset(new node);
+            n = child.get();
+        }
+        if(!n->entry)
+            ++count;
+        n->entry.reset(new std::pair<std::string const, T>(name, value));
+    }
+    /**
+     * @brief removes a name
+     *
+     * @return true if the name was in the index
+     */
+    bool erase(std::string const& name) {
+        auto* n = &root;
+        for(auto& level : impl::glob_levels::split_name(name, separator)) {
+            auto it = n->children.find(level);
+            if(it == n->children.end())
+                return false;
+            n = it->second.get();
+        }
+        if(!n->entry)
+            return false;
+        n->entry.reset();
+        --count;
+        return true;
+    }
+    /**
+     * @brief calls a functor for each name matching a glob pattern or regular expression
+     *
+     * Each name is reported once, names are reported in no particular order.
+     *
+     * @param pattern the glob pattern or regular expression
+     * @param func the functor getting the name and the value
+     * @throws std::regex_error if the pattern needs to be matched using an invalid regular expression
+     */
+    template <typename FUNC> void for_each_match(std::string const& pattern, FUNC const& func) const {
+        std::vector<std::string> levels;
+        if(impl::glob_levels::split(pattern, separator, levels)) {
+            std::unordered_set<node const*> found;
+            match(root, levels, 0, found);
+            for(auto* n : found)
+                func(n->entry->first, n->entry->second);
+        } else {
+            auto const rr = impl::glob_levels::to_regex(pattern);
+            for_each(root, [&rr, &func](std::pair<std::string const, T> const& e) {
+                if(std::regex_match(e.first, rr))
+                    func(e.first, e.second);
+            });
+        }
+    }
+
+    bool empty() const { return count == 0; }
+
+    size_t size() const { return count; }
+
+private:
+    static void match(node const& n, std::vector<std::string> const& levels, size_t idx, std::unordered_set<node const*>& found) {
+        if(idx == levels.size()) {
+            if(n.entry)
+                found.insert(&n);
+            return;
+        }
+        auto const& level = levels[idx];
+        if(level == "**") {
+            for(auto const& c : n.children)
+                match_any(*c.second, levels, idx + 1, found);
+        } else if(impl::glob_levels::is_literal(level)) {
+            auto it = n.children.find(level);
+            if(it != n.children.end())
+                match(*it->second, levels, idx + 1, found);
+        } else {
+            for(auto const& c : n.children)
+                if(impl::glob_levels::match_level(level, c.first))
+                    match(*c.second, levels, idx + 1, found);
+        }
+    }
+    //! a ** has consumed the level of n, it may consume further levels
+    static void match_any(node const& n, std::vector<std::string> const& levels, size_t idx, std::unordered_set<node const*>& found) {
+        match(n, levels, idx, found);
+        for(auto const& c : n.children)
+            match_any(*c.second, levels, idx, found);
+    }
+
+    template <typename FUNC> static void for_each(node const& n, FUNC const& func) {
+        if(n.entry)
+            func(*n.entry);
+        for(auto const& c : n.children)
+            for_each(*c.second, func);
+    }
+
+    char const separator;
+    node root;
+    size_t count{0};
+};
+} // namespace util
+/**@}*/
+#endif // _UTIL_GLOB_INDEX_H_
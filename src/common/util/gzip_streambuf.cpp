@@ -15,6 +15,7 @@
  *******************************************************************************/
 
 #include "gzip_streambuf.h"
+#include "thread_pool.h"
 
 util::gzip_streambuf::gzip_streambuf(const std::string& path)
 : gz_(gzopen(path.c_str(), "rb"))
@@ -38,3 +39,119 @@ auto util::gzip_streambuf::underflow() -> int_type {
     setg(buffer_.data(), buffer_.data(), buffer_.data() + n);
     return traits_type::to_int_type(*gptr());
 }
+
+namespace {
+// windowBits of 15 plus 16 makes zlib write a gzip header and trailer instead of a zlib wrapper
+constexpr int gzip_window_bits = 15 + 16;
+
+std::vector<char> compress_gzip_member(std::vector<char> const& in, int level) {
+    z_stream strm{};
+    if(deflateInit2(&strm, level, Z_DEFLATED, gzip_window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+        throw std::runtime_error("deflateInit2 failed");
+    std::vector<char> out(deflateBound(&strm, in.size()));
+    strm.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(in.data()));
+    strm.avail_in = in.size();
+    strm.next_out = reinterpret_cast<Bytef*>(out.data());
+    strm.avail_out = out.size();
+    auto ret = deflate(&strm, Z_FINISH);
+    deflateEnd(&strm);
+    if(ret != Z_STREAM_END)
+        throw std::runtime_error("deflate of gzip member failed");
+    out.resize(out.size() - strm.avail_out);
+    return out;
+}
+} // namespace
+
+util::gzip_ostreambuf::gzip_ostreambuf(const std::string& path, int level, unsigned threads, size_t buf_size)
+: file_(fopen(path.c_str(), "wb"))
+, level_(level)
+, buffer_(buf_size) {
+    if(!file_)
+        throw std::runtime_error("fopen failed");
+    if(threads) {
+        pool_.reset(new thread_pool());
+        pool_->start(threads);
+        max_pending_ = 2 * threads;
+    } else {
+        if(deflateInit2(&strm_, level, Z_DEFLATED, gzip_window_bits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+            throw std::runtime_error("deflateInit2 failed");
+        outbuf_.resize(buf_size);
+    }
+    setp(buffer_.data(), buffer_.data() + buffer_.size() - 1);
+}
+
+util::gzip_ostreambuf::~gzip_ostreambuf() { close(); }
+
+void util::gzip_ostreambuf::close() {
+    if(closed_)
+        return;
+    compress_and_write();
+    if(pool_) {
+        write_completed(0);
+        pool_.reset();
+    } else {
+        strm_.avail_in = 0;
+        int ret;
+        do {
+            strm_.next_out = reinterpret_cast<Bytef*>(outbuf_.data());
+            strm_.avail_out = outbuf_.size();
+            ret = deflate(&strm_, Z_FINISH);
+            fwrite(outbuf_.data(), 1, outbuf_.size() - strm_.avail_out, file_);
+        } while(ret == Z_OK);
+        deflateEnd(&strm_);
+    }
+    fclose(file_);
+    closed_ = true;
+}
+
+auto util::gzip_ostreambuf::overflow(int_type ch) -> int_type {
+    compress_and_write();
+    if(!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+int util::gzip_ostreambuf::sync() {
+    if(closed_)
+        return -1;
+    compress_and_write();
+    fflush(file_);
+    return 0;
+}
+
+void util::gzip_ostreambuf::compress_and_write() {
+    if(closed_)
+        throw std::runtime_error("Cannot write to closed stream");
+    auto size = pptr() - pbase();
+    if(!size)
+        return;
+    if(pool_) {
+        auto block = std::make_shared<std::vector<char>>(pbase(), pptr());
+        auto level = level_;
+        pending_.emplace_back(pool_->enqueue([block, level]() { return compress_gzip_member(*block, level); }));
+        write_completed(max_pending_);
+    } else {
+        strm_.next_in = reinterpret_cast<Bytef*>(pbase());
+        strm_.avail_in = size;
+        do {
+            strm_.next_out = reinterpret_cast<Bytef*>(outbuf_.data());
+            strm_.avail_out = outbuf_.size();
+            if(deflate(&strm_, Z_NO_FLUSH) == Z_STREAM_ERROR)
+                throw std::runtime_error("deflate failed");
+            fwrite(outbuf_.data(), 1, outbuf_.size() - strm_.avail_out, file_);
+        } while(strm_.avail_out == 0);
+    }
+    pbump(-size);
+}
+
+void util::gzip_ostreambuf::write_completed(size_t max_pending) {
+    // members have to be written in submission order, so we block on the oldest one only if too many are in flight
+    while(pending_.size() > max_pending ||
+          (pending_.size() && pending_.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready)) {
+        auto member = pending_.front().get();
+        pending_.pop_front();
+        fwrite(member.data(), 1, member.size(), file_);
+    }
+}
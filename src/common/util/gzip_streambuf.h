@@ -19,7 +19,10 @@
 
 #include <cctype>
 #include <climits>
+#include <deque>
 #include <fstream>
+#include <future>
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <sys/stat.h>
@@ -57,5 +60,66 @@ private:
     gzip_streambuf buf_;
 };
 
+struct thread_pool;
+/**
+ * @brief gzip compressing output stream buffer
+ *
+ * If threads is 0 the data is compressed on the calling thread into a single gzip member. Otherwise each buffer
+ * of buf_size bytes is compressed on a pool of worker threads into an independent gzip member (pigz-style).
+ * The members are written in order and the resulting file can be read by any gzip compliant reader.
+ */
+class gzip_ostreambuf : public std::streambuf {
+public:
+    gzip_ostreambuf(const std::string& path, int level = Z_DEFAULT_COMPRESSION, unsigned threads = 0, size_t buf_size = 1024 * 1024);
+
+    ~gzip_ostreambuf() override;
+
+    void close();
+
+    gzip_ostreambuf(const gzip_ostreambuf&) = delete;
+    gzip_ostreambuf(gzip_ostreambuf&&) = delete;
+    gzip_ostreambuf& operator=(const gzip_ostreambuf&) = delete;
+    gzip_ostreambuf& operator=(gzip_ostreambuf&&) = delete;
+
+protected:
+    int_type overflow(int_type ch) override;
+
+    int sync() override;
+
+private:
+    void compress_and_write();
+
+    void write_completed(size_t max_pending);
+
+    FILE* file_;
+    int level_;
+    std::vector<char> buffer_;
+    z_stream strm_{};
+    std::vector<char> outbuf_;
+    std::unique_ptr<thread_pool> pool_;
+    std::deque<std::future<std::vector<char>>> pending_;
+    size_t max_pending_{0};
+    bool closed_{false};
+};
+
+class gzip_ostream : public std::ostream {
+public:
+    gzip_ostream() = delete;
+    explicit gzip_ostream(const std::string& path, int level = Z_DEFAULT_COMPRESSION, unsigned threads = 0,
+                          size_t buf_size = 1024 * 1024)
+    : std::ostream(nullptr)
+    , buf_(path, level, threads, buf_size) {
+        rdbuf(&buf_);
+    }
+
+    void close() {
+        flush();
+        buf_.close();
+    }
+
+private:
+    gzip_ostreambuf buf_;
+};
+
 } // namespace util
 #endif // _UTIL_GZIP_STREAMBUF_H_
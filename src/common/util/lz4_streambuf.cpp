@@ -4,18 +4,29 @@
  ******************************************************************************/
 
 #include "lz4_streambuf.h"
+#include <cstring>
 #include <stdexcept>
 
 namespace util {
 
-lz4c_steambuf::lz4c_steambuf(std::ostream& sink, size_t buf_size)
+namespace {
+LZ4F_preferences_t make_prefs(int level) {
+    LZ4F_preferences_t prefs;
+    memset(&prefs, 0, sizeof(prefs));
+    prefs.compressionLevel = level;
+    return prefs;
+}
+} // namespace
+
+lz4c_steambuf::lz4c_steambuf(std::ostream& sink, size_t buf_size, int level)
 : sink(sink)
 , src_buf(buf_size)
-, dest_buf(LZ4F_compressBound(buf_size, nullptr)) {
+, prefs(make_prefs(level))
+, dest_buf(LZ4F_compressBound(buf_size, &prefs)) {
     auto errCode = LZ4F_createCompressionContext(&ctx, LZ4F_VERSION);
     if(LZ4F_isError(errCode) != 0)
         throw std::runtime_error(std::string("Failed to create LZ4 context: ") + LZ4F_getErrorName(errCode));
-    size_t sz = LZ4F_compressBegin(ctx, dest_buf.data(), dest_buf.capacity(), nullptr);
+    size_t sz = LZ4F_compressBegin(ctx, dest_buf.data(), dest_buf.capacity(), &prefs);
     if(LZ4F_isError(sz) != 0)
         throw std::runtime_error(std::string("Failed to start LZ4 compression: ") + LZ4F_getErrorName(sz));
     setp(src_buf.data(), src_buf.data() + src_buf.size() - 1);
@@ -20,7 +20,7 @@
 namespace util {
 class lz4c_steambuf : public std::streambuf {
 public:
-    lz4c_steambuf(std::ostream& sink, size_t buf_size);
+    lz4c_steambuf(std::ostream& sink, size_t buf_size, int level = 0);
 
     ~lz4c_steambuf();
 
@@ -40,6 +40,7 @@ private:
 
     std::ostream& sink;
     std::vector<char> src_buf;
+    LZ4F_preferences_t prefs;
     std::vector<char> dest_buf;
     LZ4F_compressionContext_t ctx{nullptr};
     bool closed{false};
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "mmap_region.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace util {
+#ifndef _WIN32
+namespace {
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0
+#endif
+struct file_handle {
+    int fd;
+    file_handle(std::string const& path, bool writable)
+    : fd(open(path.c_str(), writable ? O_RDWR : O_RDONLY)) {
+        if(fd < 0)
+            throw std::runtime_error("cannot open " + path + ": " + strerror(errno));
+    }
+    ~file_handle() { close(fd); }
+    uint64_t size() const {
+        struct stat st;
+        return fstat(fd, &st) == 0 ? st.st_size : 0;
+    }
+};
+} // namespace
+
+mmap_region::mmap_region(uint64_t size)
+: len(size) {
+    auto* p = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if(p == MAP_FAILED)
+        throw std::runtime_error(std::string("cannot reserve host memory: ") + strerror(errno));
+    ptr = static_cast<uint8_t*>(p);
+}
+
+mmap_region::mmap_region(std::string const& path, bool shared, uint64_t offset, uint64_t size, bool read_only) {
+    file_handle fh(path, shared && !read_only);
+    auto fsize = fh.size();
+    if(offset >= fsize)
+        throw std::runtime_error("offset exceeds the size of " + path);
+    len = size ? size : fsize - offset;
+    auto* p = mmap(nullptr, len, read_only ? PROT_READ : PROT_READ | PROT_WRITE, shared ? MAP_SHARED : MAP_PRIVATE, fh.fd, offset);
+    if(p == MAP_FAILED)
+        throw std::runtime_error("cannot map " + path + ": " + strerror(errno));
+    ptr = static_cast<uint8_t*>(p);
+}
+
+mmap_region::~mmap_region() {
+    if(ptr)
+        munmap(ptr, len);
+}
+
+uint64_t mmap_region::map_file(uint64_t at, std::string const& path, bool shared, uint64_t offset, uint64_t size) {
+    if(at >= len)
+        throw std::runtime_error("mapping location exceeds region size");
+    if(at % host_page_size() || offset % host_page_size())
+        throw std::runtime_error("file mappings need to be aligned to the host page size");
+    file_handle fh(path, shared);
+    auto fsize = fh.size();
+    if(offset >= fsize)
+        throw std::runtime_error("offset exceeds the size of " + path);
+    auto map_len = std::min(size ? size : fsize - offset, len - at);
+    auto* p = mmap(ptr + at, map_len, PROT_READ | PROT_WRITE, (shared ? MAP_SHARED : MAP_PRIVATE) | MAP_FIXED, fh.fd, offset);
+    if(p == MAP_FAILED)
+        throw std::runtime_error("cannot map " + path + ": " + strerror(errno));
+    return map_len;
+}
+
+uint64_t mmap_region::host_page_size() { return sysconf(_SC_PAGESIZE); }
+#else
+mmap_region::mmap_region(uint64_t size)
+: ptr(new uint8_t[size]())
+, len(size) {}
+
+mmap_region::mmap_region(std::string const& path, bool shared, uint64_t offset, uint64_t size, bool read_only) {
+    throw std::runtime_error("file mappings are not supported on this platform");
+}
+
+mmap_region::~mmap_region() { delete[] ptr; }
+
+uint64_t mmap_region::map_file(uint64_t at, std::string const& path, bool shared, uint64_t offset, uint64_t size) {
+    throw std::runtime_error("file mappings are not supported on this platform");
+}
+
+uint64_t mmap_region::host_page_size() { return 4096; }
+#endif
+} // namespace util
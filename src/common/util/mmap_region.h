@@ -0,0 +1,87 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _UTIL_MMAP_REGION_H_
+#define _UTIL_MMAP_REGION_H_
+
+#include <cstdint>
+#include <string>
+
+/**
+ * \ingroup scc-common
+ */
+/**@{*/
+//! @brief SCC common utilities
+namespace util {
+/**
+ * @brief a contiguous host memory region backed by a memory mapping
+ *
+ * The region is either reserved anonymously (MAP_NORESERVE) so that physical memory is only committed upon first
+ * access, or it maps a file. Files can also be mapped into parts of an anonymously reserved region. Mapping is
+ * done MAP_PRIVATE (copy-on-write, the file stays untouched) or MAP_SHARED (writes go to the file).
+ */
+class mmap_region {
+public:
+    /**
+     * @brief reserves an anonymous, zero initialized region of the given size
+     *
+     * @param size the size in bytes
+     */
+    explicit mmap_region(uint64_t size);
+    /**
+     * @brief maps a file
+     *
+     * @param path the file name
+     * @param shared if true the mapping is MAP_SHARED otherwise MAP_PRIVATE
+     * @param offset the offset in the file, needs to be a multiple of the host page size
+     * @param size the size of the mapping, 0 means the remainder of the file
+     * @param read_only if true the mapping is read-only
+     */
+    mmap_region(std::string const& path, bool shared, uint64_t offset = 0, uint64_t size = 0, bool read_only = false);
+
+    ~mmap_region();
+    /**
+     * @brief maps a file into the region replacing the anonymous memory
+     *
+     * @param at the offset in the region, needs to be a multiple of the host page size
+     * @param path the file name
+     * @param shared if true the mapping is MAP_SHARED otherwise MAP_PRIVATE
+     * @param offset the offset in the file, needs to be a multiple of the host page size
+     * @param size the size of the mapping, 0 means the remainder of the file (limited by the size of the region)
+     * @return the number of bytes mapped
+     */
+    uint64_t map_file(uint64_t at, std::string const& path, bool shared, uint64_t offset = 0, uint64_t size = 0);
+
+    uint8_t* data() const { return ptr; }
+
+    uint64_t size() const { return len; }
+    /**
+     * @brief returns the host page size which is the alignment requirement for file mappings
+     */
+    static uint64_t host_page_size();
+
+    mmap_region(const mmap_region&) = delete;
+    mmap_region(mmap_region&&) = delete;
+    mmap_region& operator=(const mmap_region&) = delete;
+    mmap_region& operator=(mmap_region&&) = delete;
+
+private:
+    uint8_t* ptr{nullptr};
+    uint64_t len{0};
+};
+} // namespace util
+/**@}*/
+#endif // _UTIL_MMAP_REGION_H_
@@ -20,6 +20,7 @@
 #include "ities.h"
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <deque>
 #include <mutex>
 #include <unordered_map>
@@ -19,6 +19,7 @@
 
 #include "ities.h"
 #include <array>
+#include <atomic>
 #include <cassert>
 
 /**
@@ -32,7 +33,8 @@ namespace util {
  *  @brief a sparse array suitable for large sizes
  *
  *  a simple array which allocates memory in configurable chunks (size of 2^PAGE_ADDR_BITS), used for
- *  large sparse arrays. Memory is allocated on demand
+ *  large sparse arrays. Memory is allocated on demand, concurrent accesses may allocate pages since a page is
+ *  installed using a compare-and-swap.
  */
 template <typename T, uint64_t SIZE, unsigned PAGE_ADDR_BITS = 24> class sparse_array {
 public:
@@ -50,13 +52,20 @@ public:
     /**
      * the default constructor
      */
-    sparse_array() { arr.fill(nullptr); }
+    sparse_array() {
+        for(auto& p : arr)
+            p.store(nullptr, std::memory_order_relaxed);
+    }
+
+    sparse_array(sparse_array const&) = delete;
+
+    sparse_array& operator=(sparse_array const&) = delete;
     /**
      * the destructor
      */
     ~sparse_array() {
-        for(auto i : arr)
-            delete i;
+        for(auto& p : arr)
+            delete p.load(std::memory_order_relaxed);
     }
     /**
      * element access operator
@@ -66,10 +75,7 @@ public:
      */
     T& operator[](uint32_t addr) {
         assert(addr < SIZE);
-        T nr = addr >> PAGE_ADDR_BITS;
-        if(arr[nr] == nullptr)
-            arr[nr] = new page_type();
-        return arr[nr]->at(addr & page_addr_mask);
+        return operator()(addr >> PAGE_ADDR_BITS).at(addr & page_addr_mask);
     }
     /**
      * page fetch operator
@@ -79,9 +85,16 @@ public:
      */
     page_type& operator()(uint32_t page_nr) {
         assert(page_nr < page_count);
-        if(arr[page_nr] == nullptr)
-            arr.at(page_nr) = new page_type();
-        return *(arr[page_nr]);
+        auto* page = arr[page_nr].load(std::memory_order_acquire);
+        if(page == nullptr) {
+            auto* new_page = new page_type();
+            // if another thread installed a page in the meantime use that one
+            if(arr[page_nr].compare_exchange_strong(page, new_page, std::memory_order_acq_rel, std::memory_order_acquire))
+                page = new_page;
+            else
+                delete new_page;
+        }
+        return *page;
     }
     /**
      * check if page for address is allocated
@@ -91,8 +104,25 @@ public:
      */
     bool is_allocated(uint32_t addr) {
         assert(addr < SIZE);
-        T nr = addr >> PAGE_ADDR_BITS;
-        return arr.at(nr) != nullptr;
+        return is_page_allocated(addr >> PAGE_ADDR_BITS);
+    }
+    /**
+     * check if a page is allocated
+     *
+     * @param page_nr the page number to check
+     * @return true if the page is allocated
+     */
+    bool is_page_allocated(uint32_t page_nr) const {
+        assert(page_nr < page_count);
+        return arr[page_nr].load(std::memory_order_acquire) != nullptr;
+    }
+    /**
+     * releases all pages so that the array reads as freshly constructed. This must not be called concurrently to
+     * other accesses and invalidates all references to elements and pages
+     */
+    void clear() {
+        for(auto& p : arr)
+            delete p.exchange(nullptr, std::memory_order_acq_rel);
     }
     /**
      * get the size of the array
@@ -102,7 +132,7 @@ public:
     uint64_t size() { return SIZE; }
 
 protected:
-    std::array<page_type*, SIZE / (1 << PAGE_ADDR_BITS) + 1> arr;
+    std::array<std::atomic<page_type*>, SIZE / (1 << PAGE_ADDR_BITS) + 1> arr;
 };
 } // namespace util
 /** @}*/
@@ -60,3 +60,73 @@ auto util::xz_streambuf::underflow() -> int_type {
     setg(buffer_.data(), buffer_.data(), buffer_.data() + produced);
     return traits_type::to_int_type(*gptr());
 }
+
+util::xz_ostreambuf::xz_ostreambuf(const std::string& path, uint32_t level, unsigned threads, size_t buf_size, uint64_t block_size)
+: file_(fopen(path.c_str(), "wb"))
+, buffer_(buf_size)
+, outbuf_(buf_size) {
+    if(!file_)
+        throw std::runtime_error("fopen failed");
+    lzma_ret res;
+    if(threads > 1) {
+        lzma_mt mt{};
+        mt.threads = threads;
+        mt.block_size = block_size;
+        mt.timeout = 0;
+        mt.preset = level;
+        mt.check = LZMA_CHECK_CRC64;
+        res = lzma_stream_encoder_mt(&strm_, &mt);
+    } else
+        res = lzma_easy_encoder(&strm_, level, LZMA_CHECK_CRC64);
+    if(res != LZMA_OK)
+        throw std::runtime_error("initialization of lzma encoder failed");
+    setp(buffer_.data(), buffer_.data() + buffer_.size() - 1);
+}
+
+util::xz_ostreambuf::~xz_ostreambuf() { close(); }
+
+void util::xz_ostreambuf::close() {
+    if(closed_)
+        return;
+    encode(LZMA_FINISH);
+    lzma_end(&strm_);
+    fclose(file_);
+    closed_ = true;
+}
+
+auto util::xz_ostreambuf::overflow(int_type ch) -> int_type {
+    encode(LZMA_RUN);
+    if(!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+int util::xz_ostreambuf::sync() {
+    if(closed_)
+        return -1;
+    encode(LZMA_RUN);
+    fflush(file_);
+    return 0;
+}
+
+void util::xz_ostreambuf::encode(lzma_action action) {
+    if(closed_)
+        throw std::runtime_error("Cannot write to closed stream");
+    strm_.next_in = reinterpret_cast<uint8_t*>(pbase());
+    strm_.avail_in = pptr() - pbase();
+    while(true) {
+        strm_.next_out = reinterpret_cast<uint8_t*>(outbuf_.data());
+        strm_.avail_out = outbuf_.size();
+        auto ret = lzma_code(&strm_, action);
+        fwrite(outbuf_.data(), 1, outbuf_.size() - strm_.avail_out, file_);
+        if(ret == LZMA_STREAM_END)
+            break;
+        if(ret != LZMA_OK)
+            throw std::runtime_error("lzma compression failed");
+        if(action == LZMA_RUN && strm_.avail_in == 0)
+            break;
+    }
+    setp(buffer_.data(), buffer_.data() + buffer_.size() - 1);
+}
@@ -19,6 +19,7 @@
 
 #include <cctype>
 #include <climits>
+#include <cstdint>
 #include <iostream>
 #include <lzma.h>
 #include <string>
@@ -57,6 +58,59 @@ public:
 private:
     xz_streambuf buf_;
 };
+/**
+ * @brief xz compressing output stream buffer
+ *
+ * If threads is larger than 1 the multi-threaded liblzma encoder is used which compresses independent blocks of
+ * block_size bytes (0 lets liblzma choose a size based on the preset) in parallel.
+ */
+class xz_ostreambuf : public std::streambuf {
+public:
+    xz_ostreambuf(const std::string& path, uint32_t level = LZMA_PRESET_DEFAULT, unsigned threads = 0, size_t buf_size = 64 * 1024,
+                  uint64_t block_size = 0);
+
+    ~xz_ostreambuf() override;
+
+    void close();
+
+    xz_ostreambuf(const xz_ostreambuf&) = delete;
+    xz_ostreambuf(xz_ostreambuf&&) = delete;
+    xz_ostreambuf& operator=(const xz_ostreambuf&) = delete;
+    xz_ostreambuf& operator=(xz_ostreambuf&&) = delete;
+
+protected:
+    int_type overflow(int_type ch) override;
+
+    int sync() override;
+
+private:
+    void encode(lzma_action action);
+
+    FILE* file_;
+    lzma_stream strm_ = LZMA_STREAM_INIT;
+    std::vector<char> buffer_;
+    std::vector<char> outbuf_;
+    bool closed_{false};
+};
+
+class xz_ostream : public std::ostream {
+public:
+    xz_ostream() = delete;
+    explicit xz_ostream(const std::string& path, uint32_t level = LZMA_PRESET_DEFAULT, unsigned threads = 0,
+                        size_t buf_size = 64 * 1024)
+    : std::ostream(nullptr)
+    , buf_(path, level, threads, buf_size) {
+        rdbuf(&buf_);
+    }
+
+    void close() {
+        flush();
+        buf_.close();
+    }
+
+private:
+    xz_ostreambuf buf_;
+};
 
 } // namespace util
 #endif // _UTIL_XZ_STREAMBUF_H_
@@ -15,11 +15,12 @@
  *******************************************************************************/
 
 #include "zstd_streambuf.h"
+#include <stdexcept>
 
 util::zstd_streambuf::zstd_streambuf(const std::string& path)
 : file_(fopen(path.c_str(), "rb"))
-, buffer_(64 * 1024)
-, inbuf_(64 * 1024) {
+, buffer_(ZSTD_DStreamOutSize())
+, inbuf_(ZSTD_DStreamInSize()) {
     if(!file_)
         throw std::runtime_error("fopen failed");
 
@@ -39,14 +40,83 @@ util::zstd_streambuf::~zstd_streambuf() {
 }
 
 auto util::zstd_streambuf::underflow() -> int_type {
-    size_t inSize = fread(inbuf_.data(), 1, inbuf_.size(), file_);
-    if(inSize == 0)
-        return traits_type::eof();
+    ZSTD_outBuffer output{buffer_.data(), buffer_.size(), 0};
+    while(output.pos == 0) {
+        if(input_.pos == input_.size) {
+            input_.src = inbuf_.data();
+            input_.size = fread(inbuf_.data(), 1, inbuf_.size(), file_);
+            input_.pos = 0;
+            if(input_.size == 0)
+                return traits_type::eof();
+        }
+        auto ret = ZSTD_decompressStream(dctx_, &output, &input_);
+        if(ZSTD_isError(ret))
+            return traits_type::eof();
+    }
+    setg(buffer_.data(), buffer_.data(), buffer_.data() + output.pos);
+    return traits_type::to_int_type(*gptr());
+}
 
-    size_t outSize = ZSTD_decompressDCtx(dctx_, buffer_.data(), buffer_.size(), inbuf_.data(), inSize);
-    if(ZSTD_isError(outSize))
-        return traits_type::eof();
+util::zstd_ostreambuf::zstd_ostreambuf(const std::string& path, int level, unsigned threads, size_t buf_size)
+: file_(fopen(path.c_str(), "wb"))
+, buffer_(buf_size ? buf_size : ZSTD_CStreamInSize())
+, outbuf_(ZSTD_CStreamOutSize()) {
+    if(!file_)
+        throw std::runtime_error("fopen failed");
+    cctx_ = ZSTD_createCCtx();
+    if(!cctx_)
+        throw std::runtime_error("ZSTD_createCCtx failed");
+    if(ZSTD_isError(ZSTD_CCtx_setParameter(cctx_, ZSTD_c_compressionLevel, level)))
+        throw std::runtime_error("invalid zstd compression level");
+    // fails if libzstd is not built with ZSTD_MULTITHREAD, in this case we stay single threaded
+    if(threads)
+        ZSTD_CCtx_setParameter(cctx_, ZSTD_c_nbWorkers, threads);
+    setp(buffer_.data(), buffer_.data() + buffer_.size() - 1);
+}
 
-    setg(buffer_.data(), buffer_.data(), buffer_.data() + outSize);
-    return traits_type::to_int_type(*gptr());
+util::zstd_ostreambuf::~zstd_ostreambuf() {
+    close();
+    ZSTD_freeCCtx(cctx_);
+}
+
+void util::zstd_ostreambuf::close() {
+    if(closed_)
+        return;
+    compress(ZSTD_e_end);
+    fclose(file_);
+    closed_ = true;
+}
+
+auto util::zstd_ostreambuf::overflow(int_type ch) -> int_type {
+    compress(ZSTD_e_continue);
+    if(!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+int util::zstd_ostreambuf::sync() {
+    if(closed_)
+        return -1;
+    compress(ZSTD_e_flush);
+    fflush(file_);
+    return 0;
+}
+
+void util::zstd_ostreambuf::compress(ZSTD_EndDirective mode) {
+    if(closed_)
+        throw std::runtime_error("Cannot write to closed stream");
+    ZSTD_inBuffer input{pbase(), static_cast<size_t>(pptr() - pbase()), 0};
+    bool finished;
+    do {
+        ZSTD_outBuffer output{outbuf_.data(), outbuf_.size(), 0};
+        auto remaining = ZSTD_compressStream2(cctx_, &output, &input, mode);
+        if(ZSTD_isError(remaining))
+            throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(remaining));
+        fwrite(outbuf_.data(), 1, output.pos, file_);
+        // with ZSTD_e_continue the input needs to be consumed, flush and end need to drain the internal buffers
+        finished = mode == ZSTD_e_continue ? input.pos == input.size : remaining == 0;
+    } while(!finished);
+    setp(buffer_.data(), buffer_.data() + buffer_.size() - 1);
 }
@@ -44,6 +44,7 @@ private:
     ZSTD_DCtx* dctx_;
     std::vector<char> buffer_;
     std::vector<char> inbuf_;
+    ZSTD_inBuffer input_{nullptr, 0, 0};
 };
 
 class zstd_stream : public std::istream {
@@ -57,6 +58,58 @@ public:
 private:
     zstd_streambuf buf_;
 };
+/**
+ * @brief zstd compressing output stream buffer
+ *
+ * If threads is not 0 the compression is done by threads zstd worker threads (ZSTD_c_nbWorkers) while the calling
+ * thread only hands over the data. If the zstd library has been built without multi-threading support the compression
+ * silently falls back to the calling thread.
+ */
+class zstd_ostreambuf : public std::streambuf {
+public:
+    zstd_ostreambuf(const std::string& path, int level = ZSTD_CLEVEL_DEFAULT, unsigned threads = 0, size_t buf_size = 0);
+
+    ~zstd_ostreambuf() override;
+
+    void close();
+
+    zstd_ostreambuf(const zstd_ostreambuf&) = delete;
+    zstd_ostreambuf(zstd_ostreambuf&&) = delete;
+    zstd_ostreambuf& operator=(const zstd_ostreambuf&) = delete;
+    zstd_ostreambuf& operator=(zstd_ostreambuf&&) = delete;
+
+protected:
+    int_type overflow(int_type ch) override;
+
+    int sync() override;
+
+private:
+    void compress(ZSTD_EndDirective mode);
+
+    FILE* file_;
+    ZSTD_CCtx* cctx_;
+    std::vector<char> buffer_;
+    std::vector<char> outbuf_;
+    bool closed_{false};
+};
+
+class zstd_ostream : public std::ostream {
+public:
+    zstd_ostream() = delete;
+    explicit zstd_ostream(const std::string& path, int level = ZSTD_CLEVEL_DEFAULT, unsigned threads = 0, size_t buf_size = 0)
+    : std::ostream(nullptr)
+    , buf_(path, level, threads, buf_size) {
+        rdbuf(&buf_);
+    }
+
+    void close() {
+        flush();
+        buf_.close();
+    }
+
+private:
+    zstd_ostreambuf buf_;
+};
 
 } // namespace util
 #endif // _UTIL_ZSTD_STREAMBUF_H_
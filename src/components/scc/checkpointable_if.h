@@ -0,0 +1,59 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_CHECKPOINTABLE_IF_H_
+#define _SCC_CHECKPOINTABLE_IF_H_
+
+#include <memory>
+#include <string>
+#include <util/checkpoint_file.h>
+
+namespace scc {
+/**
+ * @class checkpointable_if
+ * @brief interface of sc_objects whose state is saved and restored by the @ref scc::checkpointer
+ *
+ * All records written by an object need to start with the given prefix, which is derived from the hierarchical name
+ * of the object.
+ */
+class checkpointable_if {
+public:
+    virtual ~checkpointable_if() = default;
+    /**
+     * @fn void save_state(util::checkpoint_writer&, const std::string&)
+     * @brief writes the state of the object
+     *
+     * Data passed to util::checkpoint_writer::add_async() needs to stay unchanged until the writer is closed, which
+     * is the case as long as the simulation does not advance.
+     *
+     * @param writer the checkpoint image
+     * @param prefix the prefix of the record names
+     */
+    virtual void save_state(util::checkpoint_writer& writer, std::string const& prefix) = 0;
+    /**
+     * @fn void restore_state(const std::shared_ptr<util::checkpoint_reader>&, const std::string&)
+     * @brief restores the state of the object
+     *
+     * This is called after start_of_simulation() has been called for all modules. The reader may be kept to restore
+     * parts of the state lazily.
+     *
+     * @param reader the checkpoint image
+     * @param prefix the prefix of the record names
+     */
+    virtual void restore_state(std::shared_ptr<util::checkpoint_reader> const& reader, std::string const& prefix) = 0;
+};
+} // namespace scc
+#endif // _SCC_CHECKPOINTABLE_IF_H_
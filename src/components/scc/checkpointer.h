@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_CHECKPOINTER_H_
+#define _SCC_CHECKPOINTER_H_
+
+#include "checkpointable_if.h"
+#include "resource_access_if.h"
+#include <scc/configurer.h>
+#include <scc/report.h>
+#include <sstream>
+#include <systemc>
+#include <vector>
+
+namespace scc {
+/**
+ * @class checkpointer
+ * @brief saves and restores the state of a platform to skip e.g. an OS boot
+ *
+ * A checkpoint image (see util::checkpoint_writer) contains
+ * - the configuration as dumped by the @ref scc::configurer (if one is instantiated)
+ * - the storage of all registers (all sc_objects implementing @ref scc::resource_access_if like sc_register, the
+ *   elements of sc_register_indexed and bitfield_register) accessed using the debug interface
+ * - the state of all sc_objects implementing @ref scc::checkpointable_if, e.g. the allocated pages of scc::memory
+ *
+ * To restore a checkpoint the checkpointer is created with the image name after the configurer and before the
+ * design. The configuration is applied as preset values right away while the state is restored at time 0 after
+ * start_of_simulation() of all modules so that initialization done in the callbacks is overwritten.
+ */
+class checkpointer : public sc_core::sc_module, public sc_core::sc_stage_callback_if {
+public:
+    /**
+     * @fn  checkpointer(const std::string&, bool, unsigned)
+     * @brief the constructor
+     *
+     * @param restore_file the checkpoint image to restore, no restore is done if empty
+     * @param restore_config if true the configuration stored in the image is applied
+     * @param threads the number of threads to compress a checkpoint, 0 uses one thread per host core
+     */
+    checkpointer(std::string const& restore_file = "", bool restore_config = true, unsigned threads = 0)
+    : sc_core::sc_module(sc_core::sc_module_name("$$$checkpointer$$$"))
+    , threads(threads) {
+        if(restore_file.empty())
+            return;
+        try {
+            reader = std::make_shared<util::checkpoint_reader>(restore_file);
+        } catch(std::runtime_error& e) {
+            SCCERR(SCMOD) << "Cannot restore checkpoint " << restore_file << ": " << e.what();
+            return;
+        }
+        if(restore_config && reader->contains(config_record())) {
+            if(auto* cfg = dynamic_cast<configurer*>(sc_core::sc_find_object("$$$configurer$$$"))) {
+                std::istringstream is(reader->read(config_record()));
+                cfg->read_input(is, restore_file);
+            } else
+                SCCWARN(SCMOD) << "No configurer instantiated, the configuration of " << restore_file << " is not restored";
+        }
+        sc_core::sc_register_stage_callback(*this, sc_core::SC_POST_START_OF_SIMULATION);
+        registered = true;
+    }
+
+    checkpointer(const checkpointer&) = delete;
+
+    checkpointer& operator=(const checkpointer&) = delete;
+
+    ~checkpointer() {
+        if(registered)
+            sc_core::sc_unregister_stage_callback(*this, sc_core::SC_POST_START_OF_SIMULATION);
+    }
+    /**
+     * @fn void save(const std::string&)
+     * @brief writes a checkpoint of the current state
+     *
+     * This needs to be called while the simulation is paused (e.g. between sc_start() calls) or from a process at a
+     * point where the state is consistent, e.g. with all quantum keepers being synchronized.
+     *
+     * @param file_name the name of the image
+     */
+    void save(std::string const& file_name) {
+        try {
+            util::checkpoint_writer writer(file_name, threads);
+            if(auto* cfg = dynamic_cast<configurer*>(sc_core::sc_find_object("$$$configurer$$$"))) {
+                std::ostringstream os;
+                cfg->dump_configuration(os, false, false, true);
+                writer.add(config_record(), os.str());
+            }
+            std::vector<uint8_t> buffer;
+            for_each_object([&writer, &buffer](sc_core::sc_object* obj) {
+                if(auto* rai = dynamic_cast<resource_access_if*>(obj)) {
+                    buffer.resize(rai->size());
+                    if(rai->read_dbg(buffer.data(), buffer.size()))
+                        writer.add(obj->name(), buffer.data(), buffer.size());
+                }
+                if(auto* cp = dynamic_cast<checkpointable_if*>(obj))
+                    cp->save_state(writer, std::string(obj->name()) + "/");
+            });
+            writer.close();
+            SCCINFO(SCMOD) << "Saved checkpoint " << file_name << " at " << sc_core::sc_time_stamp();
+        } catch(std::runtime_error& e) {
+            SCCERR(SCMOD) << "Cannot save checkpoint " << file_name << ": " << e.what();
+        }
+    }
+    /**
+     * @fn checkpointer& get()
+     * @brief find the checkpointer in the design hierarchy
+     *
+     * @return reference to the singleton
+     */
+    static checkpointer& get() {
+        checkpointer* inst = dynamic_cast<checkpointer*>(sc_core::sc_find_object("$$$checkpointer$$$"));
+        if(!inst)
+            SCCFATAL() << "No checkpointer instantiated when using it";
+        return *inst;
+    }
+
+protected:
+    void stage_callback(const sc_core::sc_stage& stage) override {
+        if(!reader)
+            return;
+        std::vector<uint8_t> buffer;
+        auto& r = reader;
+        for_each_object([&r, &buffer](sc_core::sc_object* obj) {
+            if(auto* rai = dynamic_cast<resource_access_if*>(obj)) {
+                buffer.resize(rai->size());
+                if(r->read(obj->name(), buffer.data(), buffer.size()))
+                    rai->write_dbg(buffer.data(), buffer.size());
+            }
+            if(auto* cp = dynamic_cast<checkpointable_if*>(obj))
+                cp->restore_state(r, std::string(obj->name()) + "/");
+        });
+        // objects restoring lazily keep their own reference
+        reader.reset();
+    }
+
+private:
+    template <typename FUNC> static void for_each_object(FUNC const& func) {
+        std::vector<sc_core::sc_object*> objs(sc_core::sc_get_top_level_objects());
+        while(objs.size()) {
+            auto* obj = objs.back();
+            objs.pop_back();
+            func(obj);
+            auto const& children = obj->get_child_objects();
+            objs.insert(objs.end(), children.rbegin(), children.rend());
+        }
+    }
+
+    static char const* config_record() { return "@config"; }
+
+    unsigned const threads;
+    bool registered{false};
+    std::shared_ptr<util::checkpoint_reader> reader;
+};
+} // namespace scc
+#endif // _SCC_CHECKPOINTER_H_
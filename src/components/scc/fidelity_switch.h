@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_FIDELITY_SWITCH_H_
+#define _SCC_FIDELITY_SWITCH_H_
+
+#include <cci_configuration>
+#include <limits>
+#include <scc/report.h>
+#include <scc/utilities.h>
+#include <tlm/scc/initiator_mixin.h>
+#include <tlm/scc/target_mixin.h>
+#include <tlm>
+
+namespace scc {
+/**
+ * @class fidelity_switch
+ * @brief switches the path of LT transactions between a direct connection and a detailed (e.g. pin-level) model
+ *
+ * The switch has two ends. Incoming LT transactions arrive at tsck and leave via isck towards the target. In fast
+ * mode they are forwarded directly. In detailed mode they are sent via detailed_isck into the detailed path (e.g.
+ * an LT to AT adapter followed by a pin-level initiator and target BFM) whose output is connected to detailed_tsck
+ * from where they are forwarded to isck.
+ *
+ * The mode is controlled by the CCI parameter detailed or by set_detailed(). A mode change takes effect at the next
+ * quiescent point: new transactions are held back until all outstanding transactions have finished. Requesting the
+ * detailed mode invalidates all DMI pointers immediately and no DMI is granted from then on until the fast mode is
+ * requested again. Debug transactions always use the direct path.
+ *
+ * @tparam BUSWIDTH the width of the bus
+ */
+template <unsigned BUSWIDTH = LT> struct fidelity_switch : sc_core::sc_module {
+    using intor_sckt = tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<BUSWIDTH>>;
+    using target_sckt = tlm::scc::target_mixin<tlm::tlm_target_socket<BUSWIDTH>>;
+    //! the socket receiving the transactions of the initiator
+    target_sckt tsck{"tsck"};
+    //! the socket connecting to the target
+    intor_sckt isck{"isck"};
+    //! the socket sending transactions into the detailed path
+    intor_sckt detailed_isck{"detailed_isck"};
+    //! the socket receiving the transactions at the end of the detailed path
+    target_sckt detailed_tsck{"detailed_tsck"};
+    //! if true the detailed path is used
+    cci::cci_param<bool> detailed{"detailed", false, "Send transactions through the detailed path"};
+
+    fidelity_switch(sc_core::sc_module_name const& nm);
+
+    ~fidelity_switch() = default;
+    /**
+     * @fn void set_detailed(bool)
+     * @brief request a mode change, it takes effect when no transaction is outstanding
+     *
+     * @param enable if true the detailed path is used
+     */
+    void set_detailed(bool enable) { detailed.set_value(enable); }
+    /**
+     * @fn bool is_detailed()
+     * @brief returns the mode currently in effect
+     */
+    bool is_detailed() const { return current_detailed; }
+
+private:
+    void b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay);
+    void switch_mode(bool to_detailed);
+
+    bool current_detailed{false};
+    unsigned outstanding{0};
+    sc_core::sc_event idle_evt;
+};
+
+template <unsigned BUSWIDTH>
+fidelity_switch<BUSWIDTH>::fidelity_switch(sc_core::sc_module_name const& nm)
+: sc_module(nm) {
+    tsck.register_b_transport([this](tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) -> void { b_transport(trans, delay); });
+    tsck.register_transport_dbg([this](tlm::tlm_generic_payload& trans) -> unsigned { return isck->transport_dbg(trans); });
+    tsck.register_get_direct_mem_ptr([this](tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi_data) -> bool {
+        if(current_detailed || detailed.get_value())
+            return false;
+        return isck->get_direct_mem_ptr(trans, dmi_data);
+    });
+    isck.register_invalidate_direct_mem_ptr(
+        [this](::sc_dt::uint64 start, ::sc_dt::uint64 end) -> void { tsck->invalidate_direct_mem_ptr(start, end); });
+    detailed_tsck.register_b_transport(
+        [this](tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) -> void { isck->b_transport(trans, delay); });
+    detailed_tsck.register_transport_dbg([this](tlm::tlm_generic_payload& trans) -> unsigned { return isck->transport_dbg(trans); });
+    detailed_tsck.register_get_direct_mem_ptr([](tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi_data) -> bool { return false; });
+    detailed_isck.register_invalidate_direct_mem_ptr([](::sc_dt::uint64 start, ::sc_dt::uint64 end) -> void {});
+    detailed.register_post_write_callback([this](cci::cci_param_write_event<bool> const& ev) {
+        // DMI accesses would bypass the detailed path even before the mode change takes effect
+        if(ev.new_value && sc_core::sc_get_curr_simcontext()->elaboration_done())
+            tsck->invalidate_direct_mem_ptr(0, std::numeric_limits<::sc_dt::uint64>::max());
+    });
+    current_detailed = detailed.get_value();
+}
+
+template <unsigned BUSWIDTH> void fidelity_switch<BUSWIDTH>::b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) {
+    // a mode change is only applied if no transaction is in flight
+    while(detailed.get_value() != current_detailed) {
+        if(!outstanding)
+            switch_mode(detailed.get_value());
+        else
+            wait(idle_evt);
+    }
+    ++outstanding;
+    if(current_detailed)
+        detailed_isck->b_transport(trans, delay);
+    else
+        isck->b_transport(trans, delay);
+    if(!--outstanding)
+        idle_evt.notify();
+}
+
+template <unsigned BUSWIDTH> void fidelity_switch<BUSWIDTH>::switch_mode(bool to_detailed) {
+    SCCINFO(SCMOD) << "switching to " << (to_detailed ? "detailed" : "fast") << " mode";
+    current_detailed = to_detailed;
+}
+} // namespace scc
+#endif // _SCC_FIDELITY_SWITCH_H_
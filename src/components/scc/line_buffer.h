@@ -0,0 +1,287 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_LINE_BUFFER_H_
+#define _SCC_LINE_BUFFER_H_
+
+#include <algorithm>
+#include <cci_configuration>
+#include <cstring>
+#include <scc/report.h>
+#include <scc/utilities.h>
+#include <tlm/scc/initiator_mixin.h>
+#include <tlm/scc/target_mixin.h>
+#include <tlm>
+#include <vector>
+
+namespace scc {
+/**
+ * @class line_buffer
+ * @brief a write-combining and read-prefetch buffer for LT transactions working on lines of line_size bytes
+ *
+ * The buffer sits in front of a target and reduces the number of small blocking transactions reaching it. Accesses
+ * which do not cross a line boundary and target an enabled region (see add_region()) are buffered:
+ * - writes are collected in a write line which is written to the target once it is complete, when a write to a
+ *   different line arrives, when an access needs to be ordered after it or at the latest write_flush_delay after the
+ *   first buffered write,
+ * - reads are served from a prefetch line which is read from the target as a whole upon a miss. Pending write data
+ *   is merged into it.
+ *
+ * All other accesses, notably accesses to regions which have not been enabled (device regions), first flush the
+ * write line and are then forwarded unchanged. This preserves the order of device accesses with respect to buffered
+ * writes. The prefetch line is dropped if it is written by other means or if the target invalidates DMI pointers
+ * covering it. Debug transactions and DMI requests commit pending writes using a debug transaction. Accesses to the
+ * range of a granted DMI pointer are not buffered until the target invalidates it, since DMI accesses bypass the
+ * buffer.
+ *
+ * @tparam BUSWIDTH the width of the bus
+ */
+template <unsigned BUSWIDTH = LT> struct line_buffer : sc_core::sc_module {
+    using intor_sckt = tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<BUSWIDTH>>;
+    using target_sckt = tlm::scc::target_mixin<tlm::tlm_target_socket<BUSWIDTH>>;
+    //! the socket receiving the transactions of the initiator
+    target_sckt tsck{"tsck"};
+    //! the socket connecting to the target
+    intor_sckt isck{"isck"};
+    //! the size of a line in bytes
+    cci::cci_param<unsigned> line_size{"line_size", 64, "Size of the write-combining and prefetch lines in bytes"};
+    //! the maximum time a buffered write is held back
+    cci::cci_param<sc_core::sc_time> write_flush_delay{"write_flush_delay", sc_core::sc_time(100, sc_core::SC_NS),
+                                                       "Maximum time a buffered write is held back"};
+
+    line_buffer(sc_core::sc_module_name const& nm);
+
+    ~line_buffer() = default;
+    /**
+     * @fn void add_region(uint64_t, uint64_t)
+     * @brief enables buffering for an address region, accesses outside of enabled regions are handled as device accesses
+     *
+     * @param base the start address of the region
+     * @param size the size of the region in bytes
+     */
+    void add_region(uint64_t base, uint64_t size) { regions.emplace_back(base, base + size - 1); }
+
+private:
+    void end_of_elaboration() override;
+    void b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay);
+    unsigned transport_dbg(tlm::tlm_generic_payload& trans);
+    bool get_direct_mem_ptr(tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi_data);
+    void invalidate_direct_mem_ptr(::sc_dt::uint64 start, ::sc_dt::uint64 end);
+    bool is_bufferable(tlm::tlm_generic_payload const& trans) const;
+    static bool overlaps(std::pair<uint64_t, uint64_t> const& r, uint64_t start, uint64_t end) {
+        return start <= r.second && end >= r.first;
+    }
+    bool fetch_line(uint64_t base, sc_core::sc_time& delay);
+    void flush_write_line(sc_core::sc_time& delay);
+    void commit_write_line();
+    void invalidate_read_line(uint64_t start, uint64_t end) {
+        if(rd_valid && start < rd_base + line_bytes && end >= rd_base)
+            rd_valid = false;
+    }
+    void flush_t() {
+        while(true) {
+            wait(flush_evt);
+            sc_core::sc_time delay;
+            flush_write_line(delay);
+        }
+    }
+
+    std::vector<std::pair<uint64_t, uint64_t>> regions;
+    std::vector<std::pair<uint64_t, uint64_t>> dmi_grants;
+    unsigned line_bytes{0};
+    uint64_t wr_base{0}, rd_base{0};
+    unsigned wr_dirty{0};
+    bool rd_valid{false};
+    std::vector<uint8_t> wr_data, wr_be, rd_data;
+    sc_core::sc_event flush_evt;
+};
+
+template <unsigned BUSWIDTH>
+line_buffer<BUSWIDTH>::line_buffer(sc_core::sc_module_name const& nm)
+: sc_module(nm) {
+    SC_HAS_PROCESS(line_buffer);
+    tsck.register_b_transport([this](tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) -> void { b_transport(trans, delay); });
+    tsck.register_transport_dbg([this](tlm::tlm_generic_payload& trans) -> unsigned { return transport_dbg(trans); });
+    tsck.register_get_direct_mem_ptr(
+        [this](tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi_data) -> bool { return get_direct_mem_ptr(trans, dmi_data); });
+    isck.register_invalidate_direct_mem_ptr(
+        [this](::sc_dt::uint64 start, ::sc_dt::uint64 end) -> void { invalidate_direct_mem_ptr(start, end); });
+    SC_THREAD(flush_t);
+}
+
+template <unsigned BUSWIDTH> void line_buffer<BUSWIDTH>::end_of_elaboration() {
+    line_bytes = line_size.get_value();
+    if(!line_bytes)
+        SCCFATAL(SCMOD) << "line_size needs to be larger than 0";
+    wr_data.resize(line_bytes);
+    wr_be.resize(line_bytes, 0);
+    rd_data.resize(line_bytes);
+}
+
+template <unsigned BUSWIDTH> bool line_buffer<BUSWIDTH>::is_bufferable(tlm::tlm_generic_payload const& trans) const {
+    auto const addr = trans.get_address();
+    auto const len = trans.get_data_length();
+    if(!(trans.is_read() || trans.is_write()) || !len || addr % line_bytes + len > line_bytes || trans.get_byte_enable_ptr() ||
+       trans.get_streaming_width() < len)
+        return false;
+    auto const end = addr + len - 1;
+    auto const in_dmi_range = [addr, end](std::pair<uint64_t, uint64_t> const& r) { return overlaps(r, addr, end); };
+    if(std::any_of(dmi_grants.begin(), dmi_grants.end(), in_dmi_range))
+        return false;
+    return std::any_of(regions.begin(), regions.end(),
+                       [addr, end](std::pair<uint64_t, uint64_t> const& r) { return addr >= r.first && end <= r.second; });
+}
+
+template <unsigned BUSWIDTH> void line_buffer<BUSWIDTH>::b_transport(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) {
+    auto const addr = trans.get_address();
+    auto const len = trans.get_data_length();
+    if(!is_bufferable(trans)) {
+        // device access or access not fitting into a line, keep it ordered after the buffered writes
+        flush_write_line(delay);
+        if(!trans.is_read())
+            invalidate_read_line(addr, addr + len - 1);
+        isck->b_transport(trans, delay);
+        return;
+    }
+    auto const base = addr - addr % line_bytes;
+    auto const offs = addr - base;
+    if(trans.is_write()) {
+        if(wr_dirty && wr_base != base)
+            flush_write_line(delay);
+        if(!wr_dirty) {
+            wr_base = base;
+            flush_evt.notify(delay + write_flush_delay.get_value());
+        }
+        std::copy(trans.get_data_ptr(), trans.get_data_ptr() + len, wr_data.begin() + offs);
+        for(auto i = offs; i < offs + len; ++i)
+            if(!wr_be[i]) {
+                wr_be[i] = 0xff;
+                ++wr_dirty;
+            }
+        if(rd_valid && rd_base == base) // keep the prefetch line coherent
+            std::copy(trans.get_data_ptr(), trans.get_data_ptr() + len, rd_data.begin() + offs);
+        trans.set_response_status(tlm::TLM_OK_RESPONSE);
+        if(wr_dirty == line_bytes)
+            flush_write_line(delay);
+        return;
+    }
+    if(!(rd_valid && rd_base == base) && !fetch_line(base, delay)) {
+        isck->b_transport(trans, delay);
+        return;
+    }
+    std::copy(rd_data.begin() + offs, rd_data.begin() + offs + len, trans.get_data_ptr());
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+template <unsigned BUSWIDTH> bool line_buffer<BUSWIDTH>::fetch_line(uint64_t base, sc_core::sc_time& delay) {
+    rd_valid = false;
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_READ_COMMAND);
+    gp.set_address(base);
+    gp.set_data_ptr(rd_data.data());
+    gp.set_data_length(line_bytes);
+    gp.set_streaming_width(line_bytes);
+    gp.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    isck->b_transport(gp, delay);
+    if(gp.is_response_error()) // e.g. the line exceeds the target, fall back to the original access
+        return false;
+    if(wr_dirty && wr_base == base) // merge the pending write data
+        for(auto i = 0U; i < line_bytes; ++i)
+            if(wr_be[i])
+                rd_data[i] = wr_data[i];
+    rd_base = base;
+    rd_valid = true;
+    return true;
+}
+
+template <unsigned BUSWIDTH> void line_buffer<BUSWIDTH>::flush_write_line(sc_core::sc_time& delay) {
+    if(!wr_dirty)
+        return;
+    flush_evt.cancel();
+    auto first = std::distance(wr_be.begin(), std::find(wr_be.begin(), wr_be.end(), 0xff));
+    auto last = std::distance(std::find(wr_be.rbegin(), wr_be.rend(), 0xff), wr_be.rend()) - 1;
+    auto const len = last - first + 1;
+    // take a copy so that the line can be refilled while the write is in flight
+    std::vector<uint8_t> data(wr_data.begin() + first, wr_data.begin() + last + 1);
+    std::vector<uint8_t> be(wr_be.begin() + first, wr_be.begin() + last + 1);
+    auto const contiguous = wr_dirty == len;
+    std::fill(wr_be.begin(), wr_be.end(), 0);
+    wr_dirty = 0;
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_address(wr_base + first);
+    gp.set_data_ptr(data.data());
+    gp.set_data_length(len);
+    gp.set_streaming_width(len);
+    if(!contiguous) {
+        gp.set_byte_enable_ptr(be.data());
+        gp.set_byte_enable_length(len);
+    }
+    gp.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    isck->b_transport(gp, delay);
+    if(gp.is_response_error())
+        SCCWARN(SCMOD) << "buffered write of " << len << " bytes to 0x" << std::hex << gp.get_address()
+                       << " failed: " << gp.get_response_string();
+}
+
+template <unsigned BUSWIDTH> void line_buffer<BUSWIDTH>::commit_write_line() {
+    if(!wr_dirty)
+        return;
+    flush_evt.cancel();
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_address(wr_base);
+    gp.set_data_ptr(wr_data.data());
+    gp.set_data_length(line_bytes);
+    gp.set_streaming_width(line_bytes);
+    gp.set_byte_enable_ptr(wr_be.data());
+    gp.set_byte_enable_length(line_bytes);
+    if(isck->transport_dbg(gp) != line_bytes)
+        SCCWARN(SCMOD) << "committing the buffered write to 0x" << std::hex << wr_base << " failed";
+    std::fill(wr_be.begin(), wr_be.end(), 0);
+    wr_dirty = 0;
+}
+
+template <unsigned BUSWIDTH> unsigned line_buffer<BUSWIDTH>::transport_dbg(tlm::tlm_generic_payload& trans) {
+    commit_write_line();
+    if(trans.is_write())
+        invalidate_read_line(trans.get_address(), trans.get_address() + trans.get_data_length() - 1);
+    return isck->transport_dbg(trans);
+}
+
+template <unsigned BUSWIDTH> bool line_buffer<BUSWIDTH>::get_direct_mem_ptr(tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi_data) {
+    // a DMI user bypasses the buffer
+    commit_write_line();
+    rd_valid = false;
+    if(!isck->get_direct_mem_ptr(trans, dmi_data))
+        return false;
+    std::pair<uint64_t, uint64_t> grant{dmi_data.get_start_address(), dmi_data.get_end_address()};
+    if(std::find(dmi_grants.begin(), dmi_grants.end(), grant) == dmi_grants.end())
+        dmi_grants.push_back(grant);
+    return true;
+}
+
+template <unsigned BUSWIDTH> void line_buffer<BUSWIDTH>::invalidate_direct_mem_ptr(::sc_dt::uint64 start, ::sc_dt::uint64 end) {
+    invalidate_read_line(start, end);
+    dmi_grants.erase(std::remove_if(dmi_grants.begin(), dmi_grants.end(),
+                                    [start, end](std::pair<uint64_t, uint64_t> const& r) { return overlaps(r, start, end); }),
+                     dmi_grants.end());
+    if(wr_dirty)
+        flush_evt.notify(sc_core::SC_ZERO_TIME);
+    tsck->invalidate_direct_mem_ptr(start, end);
+}
+} // namespace scc
+#endif // _SCC_LINE_BUFFER_H_
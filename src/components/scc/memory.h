@@ -19,15 +19,21 @@
 
 // Needed for the simple_target_socket
 #include "util/ities.h"
+#include <tlm/scc/atomic_extension.h>
 #include <tlm/scc/memory_map_collector.h>
 #include <tlm_core/tlm_2/tlm_generic_payload/tlm_gp.h>
 #ifndef SC_INCLUDE_DYNAMIC_PROCESSES
 #define SC_INCLUDE_DYNAMIC_PROCESSES
 #endif
 
+#include "checkpointable_if.h"
 #include "clock_if_mixins.h"
+#include <algorithm>
+#include <atomic>
 #include <cci_configuration>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <numeric>
 #include <scc/mt19937_rng.h>
 #include <scc/report.h>
@@ -35,7 +41,14 @@
 #include <scc/utilities.h>
 #include <tlm.h>
 #include <tlm/scc/target_mixin.h>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <type_traits>
+#include <unordered_set>
+#include <util/atomic_memory.h>
+#include <util/dirty_bitmap.h>
+#include <util/mmap_region.h>
 #include <util/range_lut.h>
 #include <util/sparse_array.h>
 
@@ -63,13 +76,32 @@ template <> struct delay_spec_type<false> {
  * For this the @ref scc::host_mem_map_extension hs to be used in conjunction with the TLM_IGNORE_COMMAND. The extension
  * carries the pointer to the host memory to be used while the generic payload address and length indicate the size of the memory block
  *
+ * Alternatively the complete memory can be backed by one host memory mapping reserved with MAP_NORESERVE (see
+ * reserve_host_memory() and the parameter host_mapped). In this case a single DMI grant covers the whole memory and
+ * files like flash or disk images can be mapped directly into the memory (see map_image_file() and the parameter
+ * image_file). Unlike the sparse array the host mapped memory is initialized with zeros.
+ *
+ * Transactions carrying a @ref tlm::scc::atomic_extension are executed as atomic operations on the backing store
+ * using host atomics so that they stay atomic with respect to other host threads accessing the memory (e.g. via DMI).
+ * Reservations of LR/SC and exclusive accesses are tracked by a lock-free exclusive monitor.
+ *
+ * Optionally the memory keeps a dirty bitmap of the written regions (see enable_dirty_tracking()) which allows
+ * incremental checkpoints or the detection of modified code without scanning the whole memory. Since writes via DMI
+ * cannot be observed, regions granted for DMI write access are marked dirty as a whole. Therefore DMI requests for
+ * reading are granted read-only access while the tracking is enabled.
+ *
+ * The memory implements @ref scc::checkpointable_if, only allocated pages (or non-zero parts of the host memory
+ * mapping) are saved. Pages of the sparse array are restored lazily upon their first access while a host memory
+ * mapping is restored in parallel right away since a single DMI grant covers it completely. Host memory mapped by
+ * map_host_memory() is owned by the caller and not part of the checkpoint.
+ *
  * TODO: add some more parameters to configure allowed access types (rw, read only)
  *
  * @tparam SIZE size of the memery
  * @tparam BUSWIDTH bus width of the socket
  */
 template <unsigned long long SIZE, unsigned BUSWIDTH = LT, unsigned PAGE_ADDR_BITS = 24, bool USE_CYCLES = false>
-class memory : public sc_core::sc_module {
+class memory : public sc_core::sc_module, public checkpointable_if {
 public:
     using delay_type = typename delay_spec_type<USE_CYCLES>::type;
 
@@ -122,6 +154,146 @@ public:
      * @brief write response delay in cycles if USE_CYCLES==true else in sc_core::sc_time
      */
     cci::cci_param<delay_type> wr_resp_delay{"wr_resp_delay", delay_spec_type<USE_CYCLES>::get_default_val()};
+    /**
+     * @brief back the whole memory by one host memory mapping, evaluated during construction
+     */
+    cci::cci_param<bool> host_mapped{"host_mapped", false, "Back the whole memory by one host memory mapping so that a single DMI grant covers it"};
+    /**
+     * @brief name of a file being mapped into the memory at address 0, evaluated during construction
+     */
+    cci::cci_param<std::string> image_file{"image_file", "", "File (e.g. a flash or disk image) to be mapped into the memory at address 0"};
+    /**
+     * @brief if set writes to the image file mapping are written back to the file
+     */
+    cci::cci_param<bool> image_file_shared{"image_file_shared", false, "Map the image file shared (writes go to the file) instead of private"};
+    /**
+     * @brief log2 of the granule size of the dirty bitmap, 0 disables the tracking, evaluated during construction
+     */
+    cci::cci_param<unsigned> dirty_granule_bits{"dirty_granule_bits", 0, "Log2 granule size of the write tracking, 0 disables it"};
+    /**
+     * @fn void enable_dirty_tracking(unsigned)
+     * @brief starts tracking written regions of the memory
+     *
+     * The regions written so far are not known, so all DMI pointers are invalidated to get subsequent DMI writes
+     * recorded.
+     *
+     * @param granule_bits the log2 of the tracking granularity in bytes
+     */
+    void enable_dirty_tracking(unsigned granule_bits = 12) {
+        if(dirty_map)
+            return;
+        dirty_map.reset(new util::dirty_bitmap(SIZE, granule_bits));
+        invalidate_dmi_writers();
+    }
+    /**
+     * @fn bool is_dirty(uint64_t, uint64_t)
+     * @brief checks if an address range has been written since the last clearing
+     *
+     * @param addr the start address
+     * @param len the number of bytes
+     * @return true if dirty tracking is disabled or at least one byte of the range might have been written
+     */
+    bool is_dirty(uint64_t addr, uint64_t len = 1) { return !dirty_map || dirty_map->is_dirty(addr, len); }
+    /**
+     * @fn void for_each_dirty(std::function<void(uint64_t, uint64_t)> const&, bool)
+     * @brief calls a functor for each contiguous written region
+     *
+     * If the regions are cleared, DMI pointers granted for writing are invalidated so that writes via DMI are
+     * recorded again. Therefore this needs to be called from the simulation context.
+     *
+     * @param cb the functor being called with start address and length of each dirty region
+     * @param clear if true the dirty state is cleared
+     */
+    void for_each_dirty(std::function<void(uint64_t, uint64_t)> const& cb, bool clear = false) {
+        if(!dirty_map)
+            return;
+        if(clear)
+            invalidate_dmi_writers();
+        dirty_map->for_each_dirty(cb, clear);
+    }
+    /**
+     * @fn void clear_dirty()
+     * @brief clears the dirty state of the whole memory
+     */
+    void clear_dirty() { for_each_dirty([](uint64_t, uint64_t) {}, true); }
+    /**
+     * @fn void reserve_host_memory()
+     * @brief backs the whole memory by one anonymous host memory mapping
+     *
+     * Physical host memory is only committed when accessed. This needs to be called before data is written to the
+     * memory or DMI pointers are handed out, usually during elaboration.
+     */
+    void reserve_host_memory() {
+        if(host_region)
+            return;
+        try {
+            host_region.reset(new util::mmap_region(SIZE));
+            map_host_memory(0, SIZE, host_region->data());
+        } catch(std::runtime_error& e) {
+            SCCERR(SCMOD) << "Cannot reserve host memory of size=0x" << std::hex << SIZE << " because: " << e.what();
+            host_region.reset();
+        }
+    }
+    /**
+     * @fn void map_image_file(const std::string&, bool, uint64_t, uint64_t, uint64_t)
+     * @brief maps a file into the memory without copying it
+     *
+     * The whole memory is backed by a host memory mapping (see reserve_host_memory()) and the file is mapped into it
+     * at the given address. Base address and file offset need to be aligned to the host page size.
+     *
+     * @param path the name of the file
+     * @param shared if true the file is mapped MAP_SHARED so writes are written back to the file, otherwise MAP_PRIVATE
+     * @param base the address in the memory where the file shall be mapped
+     * @param offset the offset in the file
+     * @param size the number of bytes to map, 0 means the remainder of the file
+     */
+    void map_image_file(std::string const& path, bool shared = false, uint64_t base = 0, uint64_t offset = 0, uint64_t size = 0) {
+        reserve_host_memory();
+        if(!host_region)
+            return;
+        try {
+            auto len = host_region->map_file(base, path, shared, offset, size);
+            SCCDEBUG(SCMOD) << "Mapped 0x" << std::hex << len << " bytes of " << path << " to address=0x" << base;
+        } catch(std::runtime_error& e) {
+            SCCERR(SCMOD) << "Cannot map " << path << " to address=0x" << std::hex << base << " because: " << e.what();
+        }
+    }
+    /**
+     * @fn bool write_direct(uint64_t, uint64_t, const uint8_t*)
+     * @brief writes data directly into the backing store bypassing the operation callback
+     *
+     * This is used for bulk loading of images (see tlm::scc::bulk_loader). The function may be called concurrently
+     * from several threads as long as the address ranges do not overlap.
+     *
+     * @param addr the start address
+     * @param len the number of bytes to write
+     * @param data the data to write
+     * @return true if the address range is within the memory
+     */
+    bool write_direct(uint64_t addr, uint64_t len, const uint8_t* data) {
+        if(addr >= SIZE || len > SIZE - addr)
+            return false;
+        fault_in(addr, len);
+        monitor.clear(addr, len);
+        if(dirty_map)
+            dirty_map->mark(addr, len);
+        while(len) {
+            auto hm_entry = host_mem_lut.getEntry(addr);
+            uint64_t count = 0;
+            if(hm_entry.ptr) {
+                count = std::min(len, hm_entry.base + hm_entry.size - addr);
+                std::copy(data, data + count, hm_entry.ptr + (addr - hm_entry.base));
+            } else {
+                auto offs = addr & mem.page_addr_mask;
+                count = std::min(len, mem.page_size - offs);
+                std::copy(data, data + count, mem(addr / mem.page_size).data() + offs);
+            }
+            addr += count;
+            data += count;
+            len -= count;
+        }
+        return true;
+    }
     /**
      * @fn void map_host_memory(uint64_t, uint64_t, uint8_t*)
      * @brief maps a given memory into the address range of the TLM memory
@@ -149,6 +321,16 @@ public:
             SCCERR(SCMOD) << "Cannot unmap memory at address=0x" << std::hex << base << " with size=0x" << size;
         }
     }
+    /**
+     * @fn void save_state(util::checkpoint_writer&, const std::string&)
+     * @brief writes the allocated pages into a checkpoint, see @ref scc::checkpointable_if
+     */
+    void save_state(util::checkpoint_writer& writer, std::string const& prefix) override;
+    /**
+     * @fn void restore_state(const std::shared_ptr<util::checkpoint_reader>&, const std::string&)
+     * @brief restores the pages of a checkpoint, see @ref scc::checkpointable_if
+     */
+    void restore_state(std::shared_ptr<util::checkpoint_reader> const& reader, std::string const& prefix) override;
 
 protected:
     //! the real memory structure
@@ -161,6 +343,41 @@ protected:
         bool operator!=(host_map_entry const& o) { return !operator==(o); }
     };
     util::range_lut<host_map_entry> host_mem_lut{host_map_entry{nullptr, 0, 0}};
+    std::unique_ptr<util::mmap_region> host_region;
+    //! the reservations of LR/SC and exclusive accesses
+    util::exclusive_monitor<> monitor;
+    //! the written regions if dirty tracking is enabled
+    std::unique_ptr<util::dirty_bitmap> dirty_map;
+    //! set if DMI write access has been granted since the last invalidation
+    bool dmi_write_granted{false};
+
+    //! the checkpoint image and the pages not yet restored from it
+    std::shared_ptr<util::checkpoint_reader> restore_reader;
+    std::string restore_prefix;
+    std::unordered_set<uint64_t> restore_pages;
+    std::atomic<bool> restore_pending{false};
+    std::mutex restore_mtx;
+
+    static std::string record_name(std::string const& prefix, char const* kind, uint64_t idx) {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(idx));
+        return prefix + kind + buf;
+    }
+    //! restores the pages of an address range from a checkpoint if they have not been accessed yet
+    void fault_in(uint64_t addr, uint64_t len) {
+        if(LIKELY(!restore_pending.load(std::memory_order_acquire)) || !len)
+            return;
+        fault_in_pages(addr / mem.page_size, (addr + len - 1) / mem.page_size);
+    }
+
+    void fault_in_pages(uint64_t first, uint64_t last);
+
+    void invalidate_dmi_writers() {
+        if(dmi_write_granted) {
+            dmi_write_granted = false;
+            target->invalidate_direct_mem_ptr(0, SIZE - 1);
+        }
+    }
 
     void set_clock_period(sc_core::sc_time period) { clk_period = period; }
     sc_core::sc_time clk_period;
@@ -168,8 +385,15 @@ protected:
 public:
     //!! handle the memory operation independent on interface function used
     int handle_operation(tlm::tlm_generic_payload& trans, sc_core::sc_time& delay);
+    //! handle an atomic memory operation
+    int handle_atomic(tlm::tlm_generic_payload& trans, tlm::scc::atomic_extension& ext, sc_core::sc_time& delay);
     //! handle the dmi functionality
     bool handle_dmi(tlm::tlm_generic_payload& gp, tlm::tlm_dmi& dmi_data);
+
+private:
+    template <typename T> void atomic_access(uint8_t* loc, tlm::tlm_generic_payload& trans, tlm::scc::atomic_extension& ext);
+
+public:
     std::function<int(memory<SIZE, BUSWIDTH>&, tlm::tlm_generic_payload&, sc_core::sc_time& delay)> operation_cb;
     std::function<bool(memory<SIZE, BUSWIDTH>&, tlm::tlm_generic_payload&, tlm::tlm_dmi&)> dmi_cb;
 };
@@ -206,6 +430,9 @@ memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::memory(const sc_core::sc_mod
         if(gp.get_command() == tlm::TLM_IGNORE_COMMAND)
             if(auto ext = gp.get_extension<tlm::scc::memory_map_extension>()) {
                 ext->node.name = name();
+                ext->node.direct_write = [this](uint64_t addr, uint64_t len, const uint8_t* data) -> bool {
+                    return write_direct(addr, len, data);
+                };
                 return 0;
             }
         sc_core::sc_time z = sc_core::SC_ZERO_TIME;
@@ -222,6 +449,12 @@ memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::memory(const sc_core::sc_mod
     target.register_get_direct_mem_ptr([this](tlm::tlm_generic_payload& gp, tlm::tlm_dmi& dmi_data) -> bool {
         return dmi_cb ? dmi_cb(*this, gp, dmi_data) : handle_dmi(gp, dmi_data);
     });
+    if(image_file.get_value().size())
+        map_image_file(image_file.get_value(), image_file_shared.get_value());
+    else if(host_mapped.get_value())
+        reserve_host_memory();
+    if(dirty_granule_bits.get_value())
+        enable_dirty_tracking(dirty_granule_bits.get_value());
 }
 
 template <unsigned long long SIZE, unsigned BUSWIDTH, unsigned PAGE_ADDR_BITS, bool USE_CYCLES>
@@ -245,6 +478,9 @@ int memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::handle_operation(tlm::tl
         trans.set_response_status(tlm::TLM_GENERIC_ERROR_RESPONSE);
         return 0;
     }
+    fault_in(adr, len);
+    if(auto ext = trans.get_extension<tlm::scc::atomic_extension>())
+        return handle_atomic(trans, *ext, delay);
     auto scattered =
         byt ? std::accumulate(byt, byt + trans.get_byte_enable_length(), 0xff, [](uint8_t a, uint8_t b) { return a & b; }) != 0xff : false;
     tlm::tlm_command cmd = trans.get_command();
@@ -287,6 +523,9 @@ int memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::handle_operation(tlm::tl
         }
     } else if(cmd == tlm::TLM_WRITE_COMMAND) {
         delay += delay_spec_type<USE_CYCLES>::get_effective_value(clk_period, wr_resp_delay);
+        monitor.clear(adr, len);
+        if(dirty_map)
+            dirty_map->mark(adr, len);
         if(UNLIKELY(hm_entry.ptr)) {
             auto hm_start_offs = adr - hm_entry.base;
             auto hm_end_offs = adr + len - hm_entry.base;
@@ -329,9 +568,83 @@ int memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::handle_operation(tlm::tl
     return len;
 }
 
+template <unsigned long long SIZE, unsigned BUSWIDTH, unsigned PAGE_ADDR_BITS, bool USE_CYCLES>
+int memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::handle_atomic(tlm::tlm_generic_payload& trans, tlm::scc::atomic_extension& ext,
+                                                                      sc_core::sc_time& delay) {
+    auto const adr = trans.get_address();
+    auto const len = trans.get_data_length();
+    if((len != 1 && len != 2 && len != 4 && len != 8) || adr % len || trans.get_byte_enable_ptr()) {
+        SCCERR(SCMOD) << "unsupported atomic access of " << len << " bytes to addr 0x" << std::hex << adr;
+        trans.set_response_status(tlm::TLM_GENERIC_ERROR_RESPONSE);
+        return 0;
+    }
+    uint8_t* loc{nullptr};
+    auto hm_entry = host_mem_lut.getEntry(adr);
+    if(hm_entry.ptr) {
+        loc = hm_entry.ptr + (adr - hm_entry.base);
+    } else {
+        loc = mem(adr / mem.page_size).data() + (adr & mem.page_addr_mask);
+    }
+    switch(len) {
+    case 1:
+        atomic_access<uint8_t>(loc, trans, ext);
+        break;
+    case 2:
+        atomic_access<uint16_t>(loc, trans, ext);
+        break;
+    case 4:
+        atomic_access<uint32_t>(loc, trans, ext);
+        break;
+    default:
+        atomic_access<uint64_t>(loc, trans, ext);
+        break;
+    }
+    auto const op_delay = ext.op == util::amo_e::LOAD_RESERVED ? rd_resp_delay.get_value() : wr_resp_delay.get_value();
+    delay += delay_spec_type<USE_CYCLES>::get_effective_value(op_delay, clk_period);
+    trans.set_dmi_allowed(allow_dmi.get_value());
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    return len;
+}
+
+template <unsigned long long SIZE, unsigned BUSWIDTH, unsigned PAGE_ADDR_BITS, bool USE_CYCLES>
+template <typename T>
+inline void memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::atomic_access(uint8_t* loc, tlm::tlm_generic_payload& trans,
+                                                                              tlm::scc::atomic_extension& ext) {
+    auto const adr = trans.get_address();
+    auto ptr = reinterpret_cast<T*>(loc);
+    T operand;
+    std::memcpy(&operand, trans.get_data_ptr(), sizeof(T));
+    T old{0};
+    switch(ext.op) {
+    case util::amo_e::LOAD_RESERVED:
+        old = util::atomic_rmw<T>(ptr, ext.op, 0, 0, ext.success);
+        monitor.reserve(ext.initiator_id, adr, old);
+        break;
+    case util::amo_e::STORE_CONDITIONAL: {
+        // the compare-and-swap with the reserved value also catches writes bypassing the monitor like DMI writes
+        uint64_t reserved{0};
+        ext.success = monitor.check_and_clear(ext.initiator_id, adr, reserved);
+        if(ext.success)
+            old = util::atomic_rmw<T>(ptr, ext.op, operand, static_cast<T>(reserved), ext.success);
+        if(ext.success)
+            monitor.clear(adr, sizeof(T));
+        break;
+    }
+    default:
+        old = util::atomic_rmw<T>(ptr, ext.op, operand, static_cast<T>(ext.compare), ext.success);
+        if(ext.success)
+            monitor.clear(adr, sizeof(T));
+        break;
+    }
+    if(dirty_map && ext.success && ext.op != util::amo_e::LOAD_RESERVED)
+        dirty_map->mark(adr, sizeof(T));
+    std::memcpy(trans.get_data_ptr(), &old, sizeof(T));
+}
+
 template <unsigned long long SIZE, unsigned BUSWIDTH, unsigned PAGE_ADDR_BITS, bool USE_CYCLES>
 inline bool memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::handle_dmi(tlm::tlm_generic_payload& gp, tlm::tlm_dmi& dmi_data) {
     if(allow_dmi.get_value()) {
+        fault_in(gp.get_address(), 1);
         auto hm_entry = host_mem_lut.getEntry(gp.get_address());
         if(hm_entry.ptr) {
             dmi_data.set_start_address(hm_entry.base);
@@ -345,13 +658,135 @@ inline bool memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::handle_dmi(tlm::
             dmi_data.set_end_address(end_address - 1);
             dmi_data.set_dmi_ptr(p.data());
         }
-        dmi_data.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ_WRITE);
+        // if writes are tracked only write requests get write access since the whole granted region becomes dirty
+        if(!dirty_map || gp.is_write()) {
+            dmi_data.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ_WRITE);
+            dmi_write_granted = true;
+            if(dirty_map)
+                dirty_map->mark(dmi_data.get_start_address(), dmi_data.get_end_address() - dmi_data.get_start_address() + 1);
+        } else
+            dmi_data.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ);
         dmi_data.set_read_latency(delay_spec_type<USE_CYCLES>::get_effective_value(clk_period, rd_resp_delay));
         dmi_data.set_write_latency(delay_spec_type<USE_CYCLES>::get_effective_value(clk_period, wr_resp_delay));
     }
     return allow_dmi.get_value();
 }
 
+template <unsigned long long SIZE, unsigned BUSWIDTH, unsigned PAGE_ADDR_BITS, bool USE_CYCLES>
+void memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::save_state(util::checkpoint_writer& writer, std::string const& prefix) {
+    // pages not accessed since the last restore are still only in the old image
+    fault_in(0, SIZE);
+    uint64_t const page_size = mem.page_size;
+    if(host_region) {
+        // only chunks containing non-zero data are stored
+        uint64_t const chunk_size = std::min<uint64_t>(page_size, 1 << 20);
+        auto const* base = host_region->data();
+        for(uint64_t offs = 0; offs < SIZE; offs += chunk_size) {
+            auto len = std::min<uint64_t>(chunk_size, SIZE - offs);
+            if(std::any_of(base + offs, base + offs + len, [](uint8_t v) { return v != 0; }))
+                writer.add_async(record_name(prefix, "host/", offs), base + offs, len);
+        }
+    } else {
+        for(uint64_t idx = 0; idx < mem.page_count; ++idx)
+            if(mem.is_page_allocated(idx))
+                writer.add_async(record_name(prefix, "page/", idx), mem(idx).data(),
+                                 std::min<uint64_t>(page_size, SIZE - idx * page_size));
+    }
+}
+
+template <unsigned long long SIZE, unsigned BUSWIDTH, unsigned PAGE_ADDR_BITS, bool USE_CYCLES>
+void memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::restore_state(std::shared_ptr<util::checkpoint_reader> const& reader,
+                                                                       std::string const& prefix) {
+    // the content changes underneath all DMI pointers, pages of the sparse array are even released
+    target->invalidate_direct_mem_ptr(0, SIZE - 1);
+    dmi_write_granted = false;
+    monitor.reset();
+    if(dirty_map)
+        dirty_map->clear();
+    std::lock_guard<std::mutex> lock(restore_mtx);
+    restore_pages.clear();
+    restore_reader.reset();
+    restore_pending.store(false, std::memory_order_release);
+    uint64_t const page_size = mem.page_size;
+    auto host_records = reader->names(prefix + "host/");
+    if(host_records.size() || host_region) {
+        reserve_host_memory();
+        if(!host_region) {
+            SCCERR(SCMOD) << "Cannot restore the host memory mapping from the checkpoint";
+            return;
+        }
+        // the records with their offsets, pages of a sparse array are restored at their position as well
+        std::vector<std::pair<std::string, uint64_t>> records;
+        for(auto const& name : host_records)
+            records.emplace_back(name, std::stoull(name.substr(prefix.size() + 5), nullptr, 16));
+        for(auto const& name : reader->names(prefix + "page/"))
+            records.emplace_back(name, std::stoull(name.substr(prefix.size() + 5), nullptr, 16) * page_size);
+        util::thread_pool pool;
+        pool.start(std::max(1U, std::thread::hardware_concurrency()));
+        // chunks not stored in the checkpoint are zero, they are only written if they are not zero already
+        uint64_t const chunk_size = std::min<uint64_t>(page_size, 1 << 20);
+        std::vector<std::future<void>> cleared;
+        for(uint64_t offs = 0; offs < SIZE; offs += chunk_size)
+            cleared.emplace_back(pool.enqueue([this, offs, chunk_size]() {
+                auto* chunk = host_region->data() + offs;
+                auto len = std::min<uint64_t>(chunk_size, SIZE - offs);
+                if(std::any_of(chunk, chunk + len, [](uint8_t v) { return v != 0; }))
+                    std::memset(chunk, 0, len);
+            }));
+        for(auto& c : cleared)
+            c.get();
+        std::vector<std::pair<std::string, std::future<bool>>> results;
+        for(auto const& r : records) {
+            auto const& name = r.first;
+            auto offs = r.second;
+            auto len = reader->size(name);
+            if(offs >= SIZE || len > SIZE - offs)
+                SCCERR(SCMOD) << "Ignoring checkpoint record " << name << " outside of the memory";
+            else
+                results.emplace_back(
+                    name, pool.enqueue([this, reader, name, offs, len]() { return reader->read(name, host_region->data() + offs, len); }));
+        }
+        for(auto& r : results)
+            if(!r.second.get())
+                SCCERR(SCMOD) << "Cannot restore checkpoint record " << r.first;
+        return;
+    }
+    // pages not in the checkpoint read as zero, the others are faulted in upon their first access
+    mem.clear();
+    for(auto const& name : reader->names(prefix + "page/")) {
+        auto idx = std::stoull(name.substr(prefix.size() + 5), nullptr, 16);
+        if(idx < mem.page_count)
+            restore_pages.insert(idx);
+        else
+            SCCERR(SCMOD) << "Ignoring checkpoint record " << name << " outside of the memory";
+    }
+    if(restore_pages.size()) {
+        restore_reader = reader;
+        restore_prefix = prefix;
+        restore_pending.store(true, std::memory_order_release);
+    }
+}
+
+template <unsigned long long SIZE, unsigned BUSWIDTH, unsigned PAGE_ADDR_BITS, bool USE_CYCLES>
+void memory<SIZE, BUSWIDTH, PAGE_ADDR_BITS, USE_CYCLES>::fault_in_pages(uint64_t first, uint64_t last) {
+    std::lock_guard<std::mutex> lock(restore_mtx);
+    for(auto idx = first; idx <= last && restore_pages.size(); ++idx) {
+        auto it = restore_pages.find(idx);
+        if(it == restore_pages.end())
+            continue;
+        restore_pages.erase(it);
+        auto* page = &mem(idx);
+        auto name = record_name(restore_prefix, "page/", idx);
+        uint64_t const page_size = mem.page_size;
+        if(!restore_reader->read(name, page->data(), std::min<uint64_t>(page_size, SIZE - idx * page_size)))
+            SCCERR(SCMOD) << "Cannot restore checkpoint record " << name;
+    }
+    if(restore_pages.empty()) {
+        restore_pending.store(false, std::memory_order_release);
+        restore_reader.reset();
+    }
+}
+
 } // namespace scc
 
 #endif /* _SYSC_MEMORY_H_ */
@@ -17,8 +17,13 @@
 #ifndef _SYSC_REGISTER_H_
 #define _SYSC_REGISTER_H_
 
+#include <algorithm>
+#include <array>
+#include <bitset>
 #include <cstddef>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "resetable.h"
 #include "resource_access_if.h"
@@ -620,6 +625,247 @@ private:
     std::function<bool(const this_type&, size_t offset, DATATYPE&, sc_core::sc_time&)> rd_cb;
     std::function<bool(this_type&, size_t offset, DATATYPE&, sc_core::sc_time&)> wr_cb;
 };
+/**
+ * @class sc_register_bank
+ * @brief a bank of registers of the same type sharing one contiguous storage
+ *
+ * Unlike sc_register_indexed the registers are no sc_objects and have no callbacks and trace hooks of their own.
+ * The bank holds the reset values and masks in arrays parallel to the storage, so a reset is a single copy of the
+ * reset image and registers are accessed without indirection if no write callback is enabled for them. This is intended for
+ * peripherals having large numbers of registers like interrupt controllers or descriptor tables.
+ *
+ * The indexed interface (used by tlm_target::addResource()) provides the individual registers. The bank itself is
+ * registered as a single resource with the reset domain and implements resource_access_if as a view of the whole
+ * storage: debug accesses are plain memory copies while other accesses are split into register accesses. Note that
+ * the indexed size() returns the number of registers while resource_access_if::size() const returns the size in
+ * bytes. In contrast to sc_register the write callback is not invoked upon reset.
+ *
+ * @tparam DATATYPE the integral type of the registers
+ * @tparam SIZE the number of registers
+ */
+template <typename DATATYPE, size_t SIZE>
+class sc_register_bank : public sc_core::sc_object, public indexed_resource_access_if, public resource_access_if {
+    static_assert(std::is_integral<DATATYPE>::value, "sc_register_bank needs an integral register type");
+
+    struct element : public resource_access_if {
+        char const* full_name() const override { return bank.name(); }
+        std::size_t size() const override { return sizeof(DATATYPE); }
+        void reset() override { bank.storage[idx] = bank.reset_image[idx]; }
+        bool write(const uint8_t* data, std::size_t length, uint64_t offset, sc_core::sc_time& d) override {
+            return bank.write_reg(idx, data, length, offset, d);
+        }
+        bool read(uint8_t* data, std::size_t length, uint64_t offset, sc_core::sc_time& d) const override {
+            return bank.read_reg(idx, data, length, offset, d);
+        }
+        bool write_dbg(const uint8_t* data, std::size_t length, uint64_t offset = 0) override {
+            if(offset + length > sizeof(DATATYPE))
+                return false;
+            std::copy(data, data + length, reinterpret_cast<uint8_t*>(&bank.storage[idx]) + offset);
+            return true;
+        }
+        bool read_dbg(uint8_t* data, std::size_t length, uint64_t offset = 0) const override {
+            if(offset + length > sizeof(DATATYPE))
+                return false;
+            auto beg = reinterpret_cast<uint8_t const*>(&bank.storage[idx]) + offset;
+            std::copy(beg, beg + length, data);
+            return true;
+        }
+
+        element(sc_register_bank& bank, size_t idx)
+        : bank(bank)
+        , idx(idx) {}
+
+        sc_register_bank& bank;
+        size_t const idx;
+    };
+
+public:
+    using this_type = sc_register_bank<DATATYPE, SIZE>;
+    /**
+     * @fn  sc_register_bank(sc_core::sc_module_name, std::array<DATATYPE, SIZE>&, const DATATYPE, resetable&, DATATYPE,
+     * DATATYPE)
+     * @brief the constructor
+     *
+     * @param nm the instance name
+     * @param storage the storage of the registers
+     * @param reset_val the reset value of all registers
+     * @param owner the owning object which needs to implement the resettable interface
+     * @param rdmask the SW read mask of all registers
+     * @param wrmask the SW write mask of all registers
+     */
+    sc_register_bank(sc_core::sc_module_name nm, std::array<DATATYPE, SIZE>& storage, const DATATYPE reset_val, resetable& owner,
+                     DATATYPE rdmask = impl::get_max_uval<DATATYPE>(), DATATYPE wrmask = impl::get_max_uval<DATATYPE>())
+    : sc_core::sc_object(nm)
+    , storage(storage) {
+        reset_image.fill(reset_val);
+        rdmasks.fill(rdmask);
+        wrmasks.fill(wrmask);
+        elements.reserve(SIZE);
+        for(size_t idx = 0; idx < SIZE; ++idx)
+            elements.emplace_back(*this, idx);
+        owner.register_resource(this);
+    }
+
+    ~sc_register_bank() override = default;
+    /**
+     * @fn void set_reset_value(size_t, DATATYPE)
+     * @brief set the reset value of a single register
+     */
+    void set_reset_value(size_t idx, DATATYPE val) { reset_image.at(idx) = val; }
+    /**
+     * @fn void set_masks(size_t, DATATYPE, DATATYPE)
+     * @brief set the SW read and write mask of a single register
+     */
+    void set_masks(size_t idx, DATATYPE rdmask, DATATYPE wrmask) {
+        rdmasks.at(idx) = rdmask;
+        wrmasks.at(idx) = wrmask;
+    }
+    /**
+     * @brief set the read callback triggered upon a read request of any register
+     *
+     * @param read_cb the callback functor getting the index of the register
+     */
+    void set_read_cb(std::function<bool(const this_type&, size_t idx, DATATYPE&, sc_core::sc_time&)> read_cb) { rd_cb = read_cb; }
+    /**
+     * @brief set the write callback triggered upon a write request of any register
+     *
+     * The callback is responsible to update the storage (using value()) if the access shall be applied. It is enabled
+     * for all registers, use enable_write_cb() to restrict it to the registers needing it so that the others are
+     * written using the fast path.
+     *
+     * @param write_cb the callback functor getting the index of the register
+     */
+    void set_write_cb(std::function<bool(this_type&, size_t idx, const DATATYPE&, sc_core::sc_time&)> write_cb) {
+        wr_cb = write_cb;
+        wr_cb_regs.set();
+    }
+    /**
+     * @fn void enable_write_cb(size_t, bool)
+     * @brief enable or disable the write callback for a single register
+     *
+     * @param idx the index of the register
+     * @param enable if true writes to the register invoke the write callback
+     */
+    void enable_write_cb(size_t idx, bool enable = true) { wr_cb_regs.set(idx, enable); }
+    /**
+     * @fn DATATYPE& value(size_t)
+     * @brief access the storage of a register
+     */
+    DATATYPE& value(size_t idx) { return storage[idx]; }
+
+    DATATYPE value(size_t idx) const { return storage[idx]; }
+    /**
+     * @fn DATATYPE* data()
+     * @brief returns the contiguous storage, e.g. to hand out a DMI pointer for debug accesses
+     */
+    DATATYPE* data() { return storage.data(); }
+    // the indexed interface
+    size_t size() override { return SIZE; }
+
+    reference operator[](size_t idx) noexcept override { return elements[idx]; }
+
+    const_reference operator[](size_t idx) const noexcept override { return elements[idx]; }
+
+    reference at(size_t idx) override {
+        assert("access out of bound" && idx < SIZE);
+        return elements[idx];
+    }
+
+    const_reference at(size_t idx) const override {
+        assert("access out of bound" && idx < SIZE);
+        return elements[idx];
+    }
+    // the view of the complete bank
+    char const* full_name() const override { return name(); }
+
+    std::size_t size() const override { return SIZE * sizeof(DATATYPE); }
+
+    void reset() override { std::copy(reset_image.begin(), reset_image.end(), storage.begin()); }
+
+    bool write(const uint8_t* data, std::size_t length, uint64_t offset, sc_core::sc_time& d) override {
+        return for_each_reg(offset, length, [this, data, offset, &d](size_t idx, size_t pos, size_t len) {
+            return write_reg(idx, data + idx * sizeof(DATATYPE) + pos - offset, len, pos, d);
+        });
+    }
+
+    bool read(uint8_t* data, std::size_t length, uint64_t offset, sc_core::sc_time& d) const override {
+        return for_each_reg(offset, length, [this, data, offset, &d](size_t idx, size_t pos, size_t len) {
+            return read_reg(idx, data + idx * sizeof(DATATYPE) + pos - offset, len, pos, d);
+        });
+    }
+
+    bool write_dbg(const uint8_t* data, std::size_t length, uint64_t offset = 0) override {
+        if(offset + length > SIZE * sizeof(DATATYPE))
+            return false;
+        std::copy(data, data + length, reinterpret_cast<uint8_t*>(storage.data()) + offset);
+        return true;
+    }
+
+    bool read_dbg(uint8_t* data, std::size_t length, uint64_t offset = 0) const override {
+        if(offset + length > SIZE * sizeof(DATATYPE))
+            return false;
+        auto beg = reinterpret_cast<uint8_t const*>(storage.data()) + offset;
+        std::copy(beg, beg + length, data);
+        return true;
+    }
+
+private:
+    const char* kind() const override { return "sc_register_bank"; }
+
+    bool write_reg(size_t idx, const uint8_t* data, std::size_t length, uint64_t offset, sc_core::sc_time& d) {
+        SCC_ASSERT("Access out of range" && offset + length <= sizeof(DATATYPE));
+        auto& reg = storage[idx];
+        auto const use_cb = wr_cb && wr_cb_regs[idx];
+        if(!use_cb && length == sizeof(DATATYPE)) { // the fast path without callback
+            DATATYPE temp;
+            std::memcpy(&temp, data, sizeof(DATATYPE));
+            reg = (temp & wrmasks[idx]) | (reg & ~wrmasks[idx]);
+            return true;
+        }
+        auto temp(reg);
+        std::copy(data, data + length, reinterpret_cast<uint8_t*>(&temp) + offset);
+        if(use_cb)
+            return wr_cb(*this, idx, temp, d);
+        reg = (temp & wrmasks[idx]) | (reg & ~wrmasks[idx]);
+        return true;
+    }
+
+    bool read_reg(size_t idx, uint8_t* data, std::size_t length, uint64_t offset, sc_core::sc_time& d) const {
+        SCC_ASSERT("Access out of range" && offset + length <= sizeof(DATATYPE));
+        DATATYPE temp = storage[idx];
+        if(rd_cb) {
+            if(!rd_cb(*this, idx, temp, d))
+                return false;
+        } else
+            temp &= rdmasks[idx];
+        auto beg = reinterpret_cast<uint8_t*>(&temp) + offset;
+        std::copy(beg, beg + length, data);
+        return true;
+    }
+    //! splits an access to the bank into accesses to single registers
+    template <typename FUNC> bool for_each_reg(uint64_t offset, std::size_t length, FUNC const& func) const {
+        if(offset + length > SIZE * sizeof(DATATYPE))
+            return false;
+        for(auto pos = offset; pos < offset + length;) {
+            auto idx = pos / sizeof(DATATYPE);
+            auto reg_offs = pos % sizeof(DATATYPE);
+            auto len = std::min<uint64_t>(sizeof(DATATYPE) - reg_offs, offset + length - pos);
+            if(!func(idx, reg_offs, len))
+                return false;
+            pos += len;
+        }
+        return true;
+    }
+
+    std::array<DATATYPE, SIZE>& storage;
+    std::array<DATATYPE, SIZE> reset_image;
+    std::array<DATATYPE, SIZE> rdmasks;
+    std::array<DATATYPE, SIZE> wrmasks;
+    std::vector<element> elements;
+    std::function<bool(const this_type&, size_t idx, DATATYPE&, sc_core::sc_time&)> rd_cb;
+    std::function<bool(this_type&, size_t idx, const DATATYPE&, sc_core::sc_time&)> wr_cb;
+    std::bitset<SIZE> wr_cb_regs;
+};
 } // namespace scc
 
 #endif /* _SYSC_REGISTER_H_ */
@@ -21,12 +21,14 @@
 #include <scc/report.h>
 #include <scc/utilities.h>
 #include <sysc/utils/sc_vector.h>
+#include <tlm/scc/flat_route_extension.h>
 #include <tlm/scc/initiator_mixin.h>
 #include <tlm/scc/memory_map_collector.h>
 #include <tlm/scc/scv/tlm_rec_initiator_socket.h>
 #include <tlm/scc/scv/tlm_rec_target_socket.h>
 #include <tlm/scc/target_mixin.h>
 #include <tlm>
+#include <type_traits>
 #include <unordered_map>
 #include <util/range_lut.h>
 
@@ -37,11 +39,48 @@ namespace scc {
  *
  * It uses the tlm::scc::scv::tlm_rec_initiator_socket so that incoming and outgoing accesses can be traced using SCV
  *
+ * If built with ENABLE_TLM_STATS the accesses of each port are counted, see tlm::scc::socket_stats::dump_all().
+ *
  * @tparam BUSWIDTH the width of the bus
  */
 template <unsigned BUSWIDTH = LT, typename TARGET_SOCKET_TYPE = tlm::tlm_target_socket<BUSWIDTH>> struct router : sc_core::sc_module {
     using intor_sckt = tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<BUSWIDTH>>;
-    using target_sckt = tlm::scc::target_mixin<TARGET_SOCKET_TYPE>;
+    /**
+     * @brief the target socket of the router
+     *
+     * Registering a callback at it, also thru a reference to the mixin, marks the callbacks of the router as replaced
+     * which disables fabric flattening.
+     */
+    struct target_sckt : tlm::scc::target_mixin<TARGET_SOCKET_TYPE> {
+        using base_type = tlm::scc::target_mixin<TARGET_SOCKET_TYPE>;
+        using typename base_type::phase_type;
+        using typename base_type::sync_enum_type;
+        using typename base_type::transaction_type;
+
+        target_sckt(const sc_core::sc_module_name& nm, router& owner)
+        : base_type(nm)
+        , owner(owner) {}
+
+        void register_nb_transport_fw(std::function<sync_enum_type(transaction_type&, phase_type&, sc_core::sc_time&)> cb) override {
+            owner.callbacks_replaced = true;
+            base_type::register_nb_transport_fw(cb);
+        }
+        void register_b_transport(std::function<void(transaction_type&, sc_core::sc_time&)> cb) override {
+            owner.callbacks_replaced = true;
+            base_type::register_b_transport(cb);
+        }
+        void register_transport_dbg(std::function<unsigned int(transaction_type&)> cb) override {
+            owner.callbacks_replaced = true;
+            base_type::register_transport_dbg(cb);
+        }
+        void register_get_direct_mem_ptr(std::function<bool(transaction_type&, tlm::tlm_dmi&)> cb) override {
+            owner.callbacks_replaced = true;
+            base_type::register_get_direct_mem_ptr(cb);
+        }
+
+    private:
+        router& owner;
+    };
     //! \brief the array of target sockets
     sc_core::sc_vector<target_sckt> target;
     //! \brief  the array of initiator sockets
@@ -141,6 +180,30 @@ template <unsigned BUSWIDTH = LT, typename TARGET_SOCKET_TYPE = tlm::tlm_target_
      * @param enable if true enable warning message
      */
     void set_warn_on_address_error(bool enable) { warn_on_address_error = enable; }
+    /**
+     * @fn void set_flattening(bool)
+     * @brief enable fabric flattening, needs to be called before the end of elaboration
+     *
+     * At the end of elaboration the router resolves the complete path to the final targets including nested routers
+     * which have flattening enabled as well. LT and debug accesses are then forwarded directly to the final target
+     * using a single lookup. Nested routers with target socket types other than tlm::tlm_target_socket (e.g.
+     * recording sockets) or an initiator base for the input are not flattened and accessed as usual.
+     * If callbacks are registered at the target sockets of the router it neither flattens nor answers the queries
+     * of upstream routers so that the registered callbacks stay in the path. The accesses still lock the mutexes of
+     * all routers along the path.
+     * If built with ENABLE_TLM_STATS only the target socket of this router and the socket of the final target count
+     * the flattened accesses, the sockets in between are bypassed and do not see them.
+     *
+     * @param enable if true flattening is enabled
+     */
+    void set_flattening(bool enable) { flatten = enable; }
+    /**
+     * @fn bool is_flattened() const
+     * @brief check if LT and debug accesses are forwarded using the flattened routes
+     *
+     * @return true if the routes have been flattened
+     */
+    bool is_flattened() const { return flat_routes.size(); }
     /**
      * @fn void b_transport(int, tlm::tlm_generic_payload&, sc_core::sc_time&)
      * @brief tagged blocking transport method
@@ -197,13 +260,19 @@ protected:
     std::unordered_map<std::string, size_t> target_name_lut;
     bool check_overlap_on_add_target;
     bool warn_on_address_error{false};
+    bool flatten{false};
+    bool callbacks_replaced{false};
+    bool flat_routes_built{false};
+    tlm::scc::flat_route_table flat_routes;
+    void build_flat_routes();
+    void forward_flat(int i, tlm::tlm_generic_payload& trans, sc_core::sc_time* delay, unsigned* count);
 };
 
 template <unsigned BUSWIDTH, typename TARGET_SOCKET_TYPE>
 router<BUSWIDTH, TARGET_SOCKET_TYPE>::router(const sc_core::sc_module_name& nm, size_t slave_cnt, size_t master_cnt,
                                              bool check_overlap_on_add_target)
 : sc_module(nm)
-, target("target", master_cnt)
+, target("target", master_cnt, [this](char const* nm, size_t) { return new target_sckt(nm, *this); })
 , initiator("intor", slave_cnt)
 , ibases(master_cnt)
 , tranges(slave_cnt)
@@ -211,12 +280,14 @@ router<BUSWIDTH, TARGET_SOCKET_TYPE>::router(const sc_core::sc_module_name& nm,
 , addr_decoder(std::numeric_limits<unsigned>::max())
 , check_overlap_on_add_target(check_overlap_on_add_target) {
     for(size_t i = 0; i < target.size(); ++i) {
-        target[i].register_b_transport(
+        // the qualified calls bypass the overrides marking the callbacks as replaced
+        auto& sckt = target[i];
+        sckt.target_sckt::base_type::register_b_transport(
             [this, i](tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) -> void { this->b_transport(i, trans, delay); });
-        target[i].register_get_direct_mem_ptr([this, i](tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi_data) -> bool {
-            return this->get_direct_mem_ptr(i, trans, dmi_data);
-        });
-        target[i].register_transport_dbg([this, i](tlm::tlm_generic_payload& trans) -> unsigned { return this->transport_dbg(i, trans); });
+        sckt.target_sckt::base_type::register_get_direct_mem_ptr(
+            [this, i](tlm::tlm_generic_payload& trans, tlm::tlm_dmi& dmi_data) -> bool { return this->get_direct_mem_ptr(i, trans, dmi_data); });
+        sckt.target_sckt::base_type::register_transport_dbg(
+            [this, i](tlm::tlm_generic_payload& trans) -> unsigned { return this->transport_dbg(i, trans); });
         ibases[i] = 0ULL;
     }
     for(size_t i = 0; i < initiator.size(); ++i) {
@@ -264,6 +335,10 @@ void router<BUSWIDTH, TARGET_SOCKET_TYPE>::add_target_range(std::string name, ui
 
 template <unsigned BUSWIDTH, typename TARGET_SOCKET_TYPE>
 void router<BUSWIDTH, TARGET_SOCKET_TYPE>::b_transport(int i, tlm::tlm_generic_payload& trans, sc_core::sc_time& delay) {
+    if(flat_routes.size()) {
+        forward_flat(i, trans, &delay, nullptr);
+        return;
+    }
     ::sc_dt::uint64 address = trans.get_address();
     if(ibases[i]) {
         address += ibases[i];
@@ -340,9 +415,11 @@ unsigned router<BUSWIDTH, TARGET_SOCKET_TYPE>::transport_dbg(int i, tlm::tlm_gen
                 case util::range_lut<unsigned>::SINGLE_BYTE_RANGE:
                     start_addr = addr;
                 case util::range_lut<unsigned>::END_RANGE: {
-                    ext->node.elemets.emplace_back(start_addr, ext->offset + addr);
+                    auto const& trange = tranges[entry.index];
+                    ext->node.elemets.emplace_back(start_addr, addr);
+                    ext->node.elemets.back().target_start = trange.remap ? 0 : start_addr - ext->offset;
                     auto new_ext = tlm::scc::memory_map_extension(ext->node.elemets.back());
-                    new_ext.offset = start_addr;
+                    new_ext.offset = trange.remap ? start_addr : ext->offset;
                     trans.set_extension(&new_ext);
                     initiator[entry.index]->transport_dbg(trans);
                     trans.set_extension(ext);
@@ -352,6 +429,18 @@ unsigned router<BUSWIDTH, TARGET_SOCKET_TYPE>::transport_dbg(int i, tlm::tlm_gen
             }
             return 0;
         }
+        if(auto ext = trans.get_extension<tlm::scc::flat_route_extension>()) {
+            if(flatten && !callbacks_replaced && !ibases[i] && std::is_same<TARGET_SOCKET_TYPE, tlm::tlm_target_socket<BUSWIDTH>>::value) {
+                build_flat_routes();
+                ext->routes = flat_routes;
+            }
+            return 0;
+        }
+    }
+    if(flat_routes.size()) {
+        unsigned count = 0;
+        forward_flat(i, trans, nullptr, &count);
+        return count;
     }
     ::sc_dt::uint64 address = trans.get_address();
     if(ibases[i]) {
@@ -391,6 +480,80 @@ void router<BUSWIDTH, TARGET_SOCKET_TYPE>::invalidate_direct_mem_ptr(int id, ::s
 }
 template <unsigned BUSWIDTH, typename TARGET_SOCKET_TYPE> void router<BUSWIDTH, TARGET_SOCKET_TYPE>::end_of_elaboration() {
     addr_decoder.validate();
+    if(flatten && callbacks_replaced)
+        SCCWARN(SCMOD) << "callbacks have been registered at the target sockets, fabric flattening is disabled";
+    else if(flatten)
+        build_flat_routes();
+}
+
+template <unsigned BUSWIDTH, typename TARGET_SOCKET_TYPE> void router<BUSWIDTH, TARGET_SOCKET_TYPE>::build_flat_routes() {
+    if(flat_routes_built)
+        return;
+    flat_routes_built = true;
+    tlm::scc::flat_route_table default_routes;
+    if(default_idx != std::numeric_limits<size_t>::max())
+        default_routes = tlm::scc::query_flat_routes(initiator[default_idx]);
+    // unmapped ranges go to the default target w/o address modification or result in an address error
+    auto add_unmapped = [this, &default_routes](uint64_t lo, uint64_t hi) {
+        if(default_routes.size())
+            tlm::scc::add_flat_routes(flat_routes, default_routes, lo, hi, 0, &mutexes[default_idx]);
+        else
+            flat_routes.push_back(tlm::scc::flat_route{lo, hi, 0, nullptr, {}});
+    };
+    uint64_t next = 0;
+    bool covered = false;
+    uint64_t start_addr = 0;
+    for(auto e : addr_decoder) {
+        auto entry = e.second;
+        if(entry.index == addr_decoder.null_entry)
+            continue;
+        switch(entry.type) {
+        case util::range_lut<unsigned>::BEGIN_RANGE:
+            start_addr = e.first;
+            break;
+        case util::range_lut<unsigned>::SINGLE_BYTE_RANGE:
+            start_addr = e.first;
+        case util::range_lut<unsigned>::END_RANGE: {
+            auto idx = entry.index;
+            if(start_addr > next)
+                add_unmapped(next, start_addr - 1);
+            auto child_routes = tlm::scc::query_flat_routes(initiator[idx]);
+            tlm::scc::add_flat_routes(flat_routes, child_routes, start_addr, e.first, tranges[idx].remap ? tranges[idx].base : 0,
+                                      &mutexes[idx]);
+            covered = e.first == std::numeric_limits<uint64_t>::max();
+            next = e.first + 1;
+            break;
+        }
+        }
+    }
+    if(!covered)
+        add_unmapped(next, std::numeric_limits<uint64_t>::max());
+    SCCDEBUG(SCMOD) << "flattened fabric into " << flat_routes.size() << " routes";
+}
+
+template <unsigned BUSWIDTH, typename TARGET_SOCKET_TYPE>
+void router<BUSWIDTH, TARGET_SOCKET_TYPE>::forward_flat(int i, tlm::tlm_generic_payload& trans, sc_core::sc_time* delay, unsigned* count) {
+    ::sc_dt::uint64 address = trans.get_address() + ibases[i];
+    auto const& route = tlm::scc::find_route(flat_routes, address);
+    if(!route.fw) {
+        if(warn_on_address_error) {
+            SCCWARN(SCMOD) << "target address=0x" << std::hex << address << " not found for "
+                           << (trans.get_command() == tlm::TLM_READ_COMMAND ? "read" : "write") << " transaction.";
+        }
+        trans.set_response_status(tlm::TLM_ADDRESS_ERROR_RESPONSE);
+        return;
+    }
+    trans.set_address(address - route.offset);
+    if(count) {
+        *count = route.fw->transport_dbg(trans);
+        return;
+    }
+    // lock the mutexes of all routers along the path in the order the unflattened access would do
+    for(auto mtx : route.mtxs)
+        mtx->lock();
+    route.fw->b_transport(trans, *delay);
+    for(auto it = route.mtxs.rbegin(); it != route.mtxs.rend(); ++it)
+        (*it)->unlock();
 }
 
 } // namespace scc
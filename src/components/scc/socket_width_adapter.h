@@ -17,7 +17,11 @@
 #ifndef _SCC_SOCKET_WIDTH_ADAPTER_H_
 #define _SCC_SOCKET_WIDTH_ADAPTER_H_
 
+#include <algorithm>
+#include <cci_configuration>
+#include <scc/report.h>
 #include <tlm>
+#include <vector>
 
 //! @brief SCC TLM utilities
 namespace scc {
@@ -27,6 +31,19 @@ namespace scc {
  * The socket_width_adapter class is a template class that adapts the width of a TLM socket.
  * It allows the connection of modules with different bus widths by converting the data width between the initiator and target sockets.
  *
+ * Blocking transactions are converted as follows:
+ * - wide to narrow (TGT_BUSWIDTH > INTOR_BUSWIDTH): transactions longer than max_burst_len beats of the initiator socket
+ *   are split into a sequence of bursts which do not cross a boundary of the maximum burst size. The bursts reuse the
+ *   payload and its data and byte enable buffers so no data is copied.
+ * - narrow to wide (TGT_BUSWIDTH < INTOR_BUSWIDTH): if write_merge_window is not zero sequential writes are posted and
+ *   coalesced into one write as long as they start within the time window and fit into max_burst_len beats. All other
+ *   accesses first flush the pending write. The merged write is forwarded using b_transport and carries no extensions.
+ *   As the posted writes have already been completed an error of the merged write is reported as warning and returned
+ *   by the next blocking transaction passing the adapter. Debug accesses see the data of a pending write and update it,
+ *   DMI requests are denied while a write is pending and trigger its flush.
+ *
+ * Non-blocking transactions are forwarded unchanged, debug transactions and DMI requests apart from the pending write handling.
+ *
  * @tparam TGT_WIDTH The width of the target socket.
  * @tparam INTOR_BUSWIDTH The width of the initiator socket.
  * @tparam TYPES The TLM protocol types.
@@ -34,9 +51,6 @@ namespace scc {
  * @tparam POL The port binding policy.
  *
  * @note The socket_width_adapter class is a part of the SystemC Component (SCC) library.
- *
- * @author Your Name
- * @date YYYY-MM-DD
  */
 template <unsigned int TGT_BUSWIDTH = 32, unsigned int INTOR_BUSWIDTH = 32, typename TYPES = tlm::tlm_base_protocol_types, int N = 1,
           sc_core::sc_port_policy POL = sc_core::SC_ONE_OR_MORE_BOUND>
@@ -58,6 +72,11 @@ public:
      * This socket is used to connect the initiator module with the adapter.
      */
     initiator_socket_type isck{"isck"};
+    //! the maximum number of beats of a burst on the initiator side, 0 disables splitting and merging
+    cci::cci_param<unsigned> max_burst_len{"max_burst_len", 16, "Maximum number of beats of a burst on the initiator side"};
+    //! the time window to coalesce sequential writes in, zero disables merging
+    cci::cci_param<sc_core::sc_time> write_merge_window{"write_merge_window", sc_core::SC_ZERO_TIME,
+                                                        "Time window to coalesce sequential writes in"};
     /**
      * @brief Constructor for the socket_width_adapter class.
      *
@@ -65,8 +84,12 @@ public:
      */
     socket_width_adapter(sc_core::sc_module_name const& nm)
     : sc_core::sc_module(nm) {
+        SC_HAS_PROCESS(socket_width_adapter);
         tsck.bind(*this);
         isck.bind(*this);
+        if(TGT_BUSWIDTH < INTOR_BUSWIDTH) {
+            SC_THREAD(merge_flush_t);
+        }
     }
 
     socket_width_adapter() = delete;
@@ -84,11 +107,35 @@ private:
         return isck->nb_transport_fw(trans, phase, t);
     };
 
-    void b_transport(tlm_payload_type& trans, sc_core::sc_time& t) override { isck->b_transport(trans, t); }
+    void b_transport(tlm_payload_type& trans, sc_core::sc_time& t) override {
+        if(TGT_BUSWIDTH > INTOR_BUSWIDTH)
+            split_transport(trans, t);
+        else if(TGT_BUSWIDTH < INTOR_BUSWIDTH && write_merge_window.get_value() > sc_core::SC_ZERO_TIME)
+            merge_transport(trans, t);
+        else
+            isck->b_transport(trans, t);
+        if(merge_error != tlm::TLM_OK_RESPONSE) {
+            if(!trans.is_response_error())
+                trans.set_response_status(merge_error);
+            merge_error = tlm::TLM_OK_RESPONSE;
+        }
+    }
 
-    bool get_direct_mem_ptr(tlm_payload_type& trans, tlm::tlm_dmi& dmi_data) override { return isck->get_direct_mem_ptr(trans, dmi_data); }
+    bool get_direct_mem_ptr(tlm_payload_type& trans, tlm::tlm_dmi& dmi_data) override {
+        // a direct access would bypass the pending write so it is flushed first
+        if(merge_data.size()) {
+            merge_flush_evt.notify(sc_core::SC_ZERO_TIME);
+            return false;
+        }
+        return isck->get_direct_mem_ptr(trans, dmi_data);
+    }
 
-    unsigned int transport_dbg(tlm_payload_type& trans) override { return isck->transport_dbg(trans); }
+    unsigned int transport_dbg(tlm_payload_type& trans) override {
+        auto const count = isck->transport_dbg(trans);
+        if(merge_data.size())
+            apply_pending_write(trans, count);
+        return count;
+    }
 
     tlm::tlm_sync_enum nb_transport_bw(tlm_payload_type& trans, tlm_phase_type& phase, sc_core::sc_time& t) override {
         return tsck->nb_transport_bw(trans, phase, t);
@@ -97,6 +144,151 @@ private:
     void invalidate_direct_mem_ptr(sc_dt::uint64 start_range, sc_dt::uint64 end_range) override {
         tsck->invalidate_direct_mem_ptr(start_range, end_range);
     }
+
+    uint64_t max_burst_bytes() const { return static_cast<uint64_t>(max_burst_len.get_value()) * (INTOR_BUSWIDTH / 8); }
+
+    void split_transport(tlm_payload_type& trans, sc_core::sc_time& t);
+
+    void merge_transport(tlm_payload_type& trans, sc_core::sc_time& t);
+
+    void flush_pending_write(sc_core::sc_time& t);
+
+    void apply_pending_write(tlm_payload_type& trans, unsigned count);
+
+    void merge_flush_t() {
+        while(true) {
+            wait(merge_flush_evt);
+            sc_core::sc_time t;
+            flush_pending_write(t);
+        }
+    }
+
+    uint64_t merge_addr{0};
+    sc_core::sc_time merge_start;
+    std::vector<uint8_t> merge_data, merge_be;
+    sc_core::sc_event merge_flush_evt;
+    tlm::tlm_response_status merge_error{tlm::TLM_OK_RESPONSE};
 };
+
+template <unsigned int TGT_BUSWIDTH, unsigned int INTOR_BUSWIDTH, typename TYPES, int N, sc_core::sc_port_policy POL>
+void socket_width_adapter<TGT_BUSWIDTH, INTOR_BUSWIDTH, TYPES, N, POL>::split_transport(tlm_payload_type& trans, sc_core::sc_time& t) {
+    auto const max_bytes = max_burst_bytes();
+    auto const len = trans.get_data_length();
+    auto const be_len = trans.get_byte_enable_length();
+    // streaming accesses and repeating byte enable patterns are not split
+    if(!max_bytes || len <= max_bytes || trans.get_command() == tlm::TLM_IGNORE_COMMAND || trans.get_streaming_width() < len ||
+       (be_len && be_len != len)) {
+        isck->b_transport(trans, t);
+        return;
+    }
+    auto const addr = trans.get_address();
+    auto const data = trans.get_data_ptr();
+    auto const be = trans.get_byte_enable_ptr();
+    auto const width = trans.get_streaming_width();
+    auto dmi_allowed = true;
+    for(unsigned offs = 0; offs < len;) {
+        auto const burst_len = static_cast<unsigned>(std::min<uint64_t>(len - offs, max_bytes - (addr + offs) % max_bytes));
+        trans.set_address(addr + offs);
+        trans.set_data_ptr(data + offs);
+        trans.set_data_length(burst_len);
+        trans.set_streaming_width(burst_len);
+        if(be_len) {
+            trans.set_byte_enable_ptr(be + offs);
+            trans.set_byte_enable_length(burst_len);
+        }
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        isck->b_transport(trans, t);
+        dmi_allowed &= trans.is_dmi_allowed();
+        offs += burst_len;
+        if(trans.is_response_error())
+            break;
+    }
+    trans.set_address(addr);
+    trans.set_data_ptr(data);
+    trans.set_data_length(len);
+    trans.set_streaming_width(width);
+    trans.set_byte_enable_ptr(be);
+    trans.set_byte_enable_length(be_len);
+    trans.set_dmi_allowed(dmi_allowed);
+}
+
+template <unsigned int TGT_BUSWIDTH, unsigned int INTOR_BUSWIDTH, typename TYPES, int N, sc_core::sc_port_policy POL>
+void socket_width_adapter<TGT_BUSWIDTH, INTOR_BUSWIDTH, TYPES, N, POL>::merge_transport(tlm_payload_type& trans, sc_core::sc_time& t) {
+    auto const len = trans.get_data_length();
+    auto const be_len = trans.get_byte_enable_length();
+    auto const max_bytes = max_burst_bytes();
+    if(!trans.is_write() || !max_bytes || len > max_bytes || trans.get_streaming_width() < len || (be_len && be_len != len)) {
+        flush_pending_write(t);
+        isck->b_transport(trans, t);
+        return;
+    }
+    auto const now = sc_core::sc_time_stamp() + t;
+    if(merge_data.size() && (merge_addr + merge_data.size() != trans.get_address() || merge_data.size() + len > max_bytes ||
+                             now >= merge_start + write_merge_window.get_value()))
+        flush_pending_write(t);
+    if(merge_data.empty()) {
+        merge_addr = trans.get_address();
+        merge_start = now;
+        merge_flush_evt.notify(t + write_merge_window.get_value());
+    }
+    merge_data.insert(merge_data.end(), trans.get_data_ptr(), trans.get_data_ptr() + len);
+    if(be_len)
+        merge_be.insert(merge_be.end(), trans.get_byte_enable_ptr(), trans.get_byte_enable_ptr() + len);
+    else
+        merge_be.insert(merge_be.end(), len, uint8_t(0xff));
+    trans.set_response_status(tlm::TLM_OK_RESPONSE);
+}
+
+template <unsigned int TGT_BUSWIDTH, unsigned int INTOR_BUSWIDTH, typename TYPES, int N, sc_core::sc_port_policy POL>
+void socket_width_adapter<TGT_BUSWIDTH, INTOR_BUSWIDTH, TYPES, N, POL>::flush_pending_write(sc_core::sc_time& t) {
+    if(merge_data.empty())
+        return;
+    merge_flush_evt.cancel();
+    // take the buffers so that new writes can be posted while the merged write is in flight
+    std::vector<uint8_t> data, be;
+    data.swap(merge_data);
+    be.swap(merge_be);
+    auto const addr = merge_addr;
+    tlm_payload_type gp;
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_address(addr);
+    gp.set_data_ptr(data.data());
+    gp.set_data_length(data.size());
+    gp.set_streaming_width(data.size());
+    if(std::any_of(be.begin(), be.end(), [](uint8_t b) { return b != 0xff; })) {
+        gp.set_byte_enable_ptr(be.data());
+        gp.set_byte_enable_length(be.size());
+    }
+    gp.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    isck->b_transport(gp, t);
+    if(gp.is_response_error()) {
+        SCCWARN(SCMOD) << "merged write of " << data.size() << " bytes to 0x" << std::hex << addr
+                       << " failed: " << gp.get_response_string();
+        merge_error = gp.get_response_status();
+    }
+}
+
+template <unsigned int TGT_BUSWIDTH, unsigned int INTOR_BUSWIDTH, typename TYPES, int N, sc_core::sc_port_policy POL>
+void socket_width_adapter<TGT_BUSWIDTH, INTOR_BUSWIDTH, TYPES, N, POL>::apply_pending_write(tlm_payload_type& trans, unsigned count) {
+    if(trans.get_command() == tlm::TLM_IGNORE_COMMAND || trans.get_streaming_width() < trans.get_data_length())
+        return;
+    auto const addr = trans.get_address();
+    auto const start = std::max<uint64_t>(addr, merge_addr);
+    auto const end = std::min<uint64_t>(addr + count, merge_addr + merge_data.size());
+    auto const data = trans.get_data_ptr();
+    auto const be = trans.get_byte_enable_ptr();
+    auto const be_len = trans.get_byte_enable_length();
+    for(auto a = start; a < end; ++a) {
+        auto const idx = a - addr;
+        auto const merge_idx = a - merge_addr;
+        if(!merge_be[merge_idx] || (be && !be[idx % be_len]))
+            continue;
+        // reads see the pending data, writes update it so that the flush does not revert them
+        if(trans.is_read())
+            data[idx] = merge_data[merge_idx];
+        else
+            merge_data[merge_idx] = data[idx];
+    }
+}
 } // namespace scc
 #endif // _SCC_SOCKET_WIDTH_ADAPTER_H_
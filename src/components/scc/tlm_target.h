@@ -23,6 +23,8 @@
 #include <tlm/scc/scv/tlm_rec_target_socket.h>
 #include <tlm/scc/target_mixin.h>
 #include <tlm_core/tlm_2/tlm_generic_payload/tlm_gp.h>
+#include <memory>
+#include <util/dirty_bitmap.h>
 #include <util/range_lut.h>
 
 namespace scc {
@@ -101,6 +103,28 @@ public:
         }
         return res;
     }
+    /**
+     * @fn void enable_dirty_tracking(unsigned)
+     * @brief starts tracking which parts of the register bank are written
+     *
+     * This needs to be called after all resources have been added.
+     *
+     * @param granule_bits the log2 of the tracking granularity in address units
+     */
+    void enable_dirty_tracking(unsigned granule_bits = 0) {
+        uint64_t size = 0; // the keys of the lut are the first and last address of each resource
+        for(auto& e : socket_map)
+            size = std::max<uint64_t>(size, e.first + 1);
+        if(size)
+            dirty_map.reset(new util::dirty_bitmap(size, granule_bits));
+    }
+    /**
+     * @fn util::dirty_bitmap* get_dirty_map()
+     * @brief returns the bitmap of written addresses to query and clear it
+     *
+     * @return the bitmap or nullptr if dirty tracking is not enabled
+     */
+    util::dirty_bitmap* get_dirty_map() { return dirty_map.get(); }
 
 private:
     sc_core::sc_time& clk;
@@ -109,6 +133,7 @@ private:
 protected:
     using resource_access_t = std::pair<resource_access_if*, uint64_t>;
     util::range_lut<resource_access_t> socket_map;
+    std::unique_ptr<util::dirty_bitmap> dirty_map;
     template <typename T> T* get_payload_extension() {
         if(current_payload)
             return current_payload->get_extension<T>();
@@ -206,8 +231,11 @@ void scc::tlm_target<BUSWIDTH, ADDR_UNIT_BITWIDTH>::b_tranport_cb(tlm::tlm_gener
                     gp.set_response_status(tlm::TLM_OK_RESPONSE);
                 break;
             case tlm::TLM_WRITE_COMMAND:
-                if(ra->write(gp.get_data_ptr() + offset, len, (gp.get_address() - base + offset), delay))
+                if(ra->write(gp.get_data_ptr() + offset, len, (gp.get_address() - base + offset), delay)) {
                     gp.set_response_status(tlm::TLM_OK_RESPONSE);
+                    if(dirty_map)
+                        dirty_map->mark(gp.get_address() + offset, len);
+                }
                 break;
             case tlm::TLM_IGNORE_COMMAND:
                 break;
@@ -237,7 +265,7 @@ unsigned int scc::tlm_target<BUSWIDTH, ADDR_UNIT_BITWIDTH>::tranport_dbg_cb(tlm:
                 case util::range_lut<resource_access_t>::SINGLE_BYTE_RANGE:
                     start_addr = addr;
                 case util::range_lut<resource_access_t>::END_RANGE: {
-                    ext->node.elemets.emplace_back(start_addr, ext->offset + addr);
+                    ext->node.elemets.emplace_back(start_addr, addr);
                     ext->node.elemets.back().name = entry.index.first->full_name();
                     break;
                 }
@@ -255,8 +283,11 @@ unsigned int scc::tlm_target<BUSWIDTH, ADDR_UNIT_BITWIDTH>::tranport_dbg_cb(tlm:
                 if(ra->read_dbg(gp.get_data_ptr(), gp.get_data_length(), (gp.get_address() - base) / ra->size()))
                     return gp.get_data_length();
             } else if(gp.get_command() == tlm::TLM_WRITE_COMMAND) {
-                if(ra->write_dbg(gp.get_data_ptr(), gp.get_data_length(), (gp.get_address() - base) / ra->size()))
+                if(ra->write_dbg(gp.get_data_ptr(), gp.get_data_length(), (gp.get_address() - base) / ra->size())) {
+                    if(dirty_map)
+                        dirty_map->mark(gp.get_address(), gp.get_data_length());
                     return gp.get_data_length();
+                }
             }
             current_payload = nullptr;
         }
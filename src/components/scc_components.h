@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include "scc/checkpointable_if.h"
+#include "scc/checkpointer.h"
 #include "scc/clock_if_mixins.h"
+#include "scc/fidelity_switch.h"
+#include "scc/line_buffer.h"
 #include "scc/memory.h"
 #include "scc/register.h"
 #include "scc/resetable.h"
@@ -132,6 +132,9 @@ template <unsigned DATA_WIDTH, unsigned ADDR_WIDTH> void target<DATA_WIDTH, ADDR
                     gp->set_read();
                 }
                 tx_in_flight.notify(*gp);
+            } else if(!hsel || htrans < 2) {
+                // sleep while the bus is idle instead of sampling it every clock cycle
+                wait(HSEL_i.value_changed_event() | HTRANS_i.value_changed_event() | HRESETn_i.negedge_event());
             }
         }
     }
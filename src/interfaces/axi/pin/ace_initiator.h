@@ -22,6 +22,7 @@
 #include <axi/fsm/protocol_fsm.h>
 #include <axi/signal_if.h>
 #include <cci_configuration>
+#include <scc/delayed_clock_event.h>
 #include <scc/fifo_w_cb.h>
 #include <systemc>
 #include <tlm/scc/tlm_mm.h>
@@ -110,7 +111,7 @@ private:
 
     void setup_callbacks(fsm_handle* fsm_hndl);
 
-    void clk_delay() { clk_delayed.notify(axi::CLK_DELAY); }
+    void clk_delay() { clk_delayed.on_clock(); }
 
     void ar_t();
     void r_t();
@@ -143,7 +144,8 @@ private:
     std::array<fsm_handle*, 3> active_req{nullptr, nullptr, nullptr};
     std::array<fsm_handle*, 4> active_resp_beat{nullptr, nullptr, nullptr};
     sc_core::sc_clock* clk_if{nullptr};
-    sc_core::sc_event clk_delayed, clk_self, r_end_resp_evt, w_end_resp_evt, ac_end_req_evt;
+    sc_core::sc_event clk_self, r_end_resp_evt, w_end_resp_evt, ac_end_req_evt;
+    scc::delayed_clock_event clk_delayed{clk_i, axi::CLK_DELAY};
     void nb_fw(payload_type& trans, const phase_type& phase) {
         auto t = sc_core::SC_ZERO_TIME;
         base::nb_fw(trans, phase, t);
@@ -516,7 +518,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::ar_t() {
         write_ar(*val.gp);
         this->ar_valid.write(true);
         do {
-            wait(this->ar_ready.posedge_event() | clk_delayed);
+            wait(this->ar_ready.posedge_event() | clk_delayed.get());
             if(this->ar_ready.read())
                 react(axi::fsm::protocol_time_point_e::EndReqE, val.gp);
         } while(!this->ar_ready.read());
@@ -529,7 +531,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::r_t() {
     this->r_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->r_valid.read()) {
             wait(this->r_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -599,7 +601,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::aw_t() {
         write_aw(*val.gp);
         this->aw_valid.write(true);
         do {
-            wait(this->aw_ready.posedge_event() | clk_delayed);
+            wait(this->aw_ready.posedge_event() | clk_delayed.get());
         } while(!this->aw_ready.read());
         if(axi::is_dataless(val.gp->template get_extension<axi::ace_extension>()))
             schedule(axi::fsm::protocol_time_point_e::EndReqE, val.gp, sc_core::SC_ZERO_TIME);
@@ -632,7 +634,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::wdata_t() {
         if(!CFG::IS_LITE)
             this->w_last->write(val.last);
         do {
-            wait(this->w_ready.posedge_event() | clk_delayed);
+            wait(this->w_ready.posedge_event() | clk_delayed.get());
             if(!pipelined_wrreq && this->w_ready.read()) {
                 auto evt = val.last ? axi::fsm::protocol_time_point_e::EndReqE : axi::fsm::protocol_time_point_e::EndPartReqE;
                 schedule(evt, val.gp, sc_core::SC_ZERO_TIME);
@@ -647,7 +649,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::b_t() {
     this->b_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->b_valid.read()) {
             wait(this->b_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -679,7 +681,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::ac_t() {
     // here +1 because last beat in Resp transmitted
     auto data_len = (1 << arsize) * (arlen + 1);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->ac_valid.read()) {
             wait(this->ac_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -731,7 +733,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::cd_t() {
         SCCTRACE(SCMOD) << __FUNCTION__ << "() write cd_valid high ";
         this->cd_last->write(val & 0x2);
         do {
-            wait(this->cd_ready.posedge_event() | clk_delayed);
+            wait(this->cd_ready.posedge_event() | clk_delayed.get());
             if(this->cd_ready.read()) {
                 auto evt =
                     CFG::IS_LITE || (val & 0x2) ? axi::fsm::protocol_time_point_e::EndRespE : axi::fsm::protocol_time_point_e::EndPartRespE;
@@ -765,7 +767,7 @@ template <typename CFG> inline void axi::pin::ace_initiator<CFG>::cr_resp_t() {
         this->cr_resp.write((ext->get_cresp()));
         this->cr_valid.write(true);
         do {
-            wait(this->cr_ready.posedge_event() | clk_delayed);
+            wait(this->cr_ready.posedge_event() | clk_delayed.get());
             if(this->cr_ready.read()) {
                 auto evt = axi::fsm::protocol_time_point_e::EndRespE;
                 SCCTRACE(SCMOD) << __FUNCTION__ << "(), schedule EndRespE ";
@@ -22,6 +22,7 @@
 #include <axi/fsm/protocol_fsm.h>
 #include <axi/signal_if.h>
 #include <cci_configuration>
+#include <scc/delayed_clock_event.h>
 #include <scc/fifo_w_cb.h>
 #include <systemc>
 #include <tlm/scc/tlm_mm.h>
@@ -98,7 +99,7 @@ private:
 
     void setup_callbacks(fsm_handle* fsm_hndl);
 
-    void clk_delay() { clk_delayed.notify(axi::CLK_DELAY); }
+    void clk_delay() { clk_delayed.on_clock(); }
 
     void ar_t();
     void r_t();
@@ -115,7 +116,8 @@ private:
     static typename CFG::data_t get_cache_data_for_beat(fsm::fsm_handle* fsm_hndl);
     std::array<unsigned, 3> outstanding_cnt{0, 0, 0};
     sc_core::sc_clock* clk_if{nullptr};
-    sc_core::sc_event clk_delayed, clk_self, r_end_resp_evt, w_end_resp_evt;
+    sc_core::sc_event clk_self, r_end_resp_evt, w_end_resp_evt;
+    scc::delayed_clock_event clk_delayed{clk_i, axi::CLK_DELAY};
     void nb_fw(payload_type& trans, const phase_type& phase) {
         auto t = sc_core::SC_ZERO_TIME;
         base::nb_fw(trans, phase, t);
@@ -423,7 +425,7 @@ template <typename CFG> inline void axi::pin::ace_lite_initiator<CFG>::ar_t() {
         write_ar(*val.gp);
         this->ar_valid.write(true);
         do {
-            wait(this->ar_ready.posedge_event() | clk_delayed);
+            wait(this->ar_ready.posedge_event() | clk_delayed.get());
             if(this->ar_ready.read())
                 react(axi::fsm::protocol_time_point_e::EndReqE, val.gp);
         } while(!this->ar_ready.read());
@@ -436,7 +438,7 @@ template <typename CFG> inline void axi::pin::ace_lite_initiator<CFG>::r_t() {
     this->r_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->r_valid.read()) {
             wait(this->r_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -505,7 +507,7 @@ template <typename CFG> inline void axi::pin::ace_lite_initiator<CFG>::aw_t() {
         write_aw(*val.gp);
         this->aw_valid.write(true);
         do {
-            wait(this->aw_ready.posedge_event() | clk_delayed);
+            wait(this->aw_ready.posedge_event() | clk_delayed.get());
         } while(!this->aw_ready.read());
         if(axi::is_dataless(val.gp->template get_extension<axi::ace_extension>()))
             schedule(axi::fsm::protocol_time_point_e::EndReqE, val.gp, sc_core::SC_ZERO_TIME);
@@ -538,7 +540,7 @@ template <typename CFG> inline void axi::pin::ace_lite_initiator<CFG>::wdata_t()
         if(!CFG::IS_LITE)
             this->w_last->write(val.last);
         do {
-            wait(this->w_ready.posedge_event() | clk_delayed);
+            wait(this->w_ready.posedge_event() | clk_delayed.get());
             if(!pipelined_wrreq && this->w_ready.read()) {
                 auto evt = val.last ? axi::fsm::protocol_time_point_e::EndReqE : axi::fsm::protocol_time_point_e::EndPartReqE;
                 schedule(evt, val.gp, sc_core::SC_ZERO_TIME);
@@ -553,7 +555,7 @@ template <typename CFG> inline void axi::pin::ace_lite_initiator<CFG>::b_t() {
     this->b_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->b_valid.read()) {
             wait(this->b_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
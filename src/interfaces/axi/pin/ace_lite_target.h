@@ -21,6 +21,7 @@
 #include <axi/fsm/base.h>
 #include <axi/fsm/protocol_fsm.h>
 #include <axi/signal_if.h>
+#include <scc/delayed_clock_event.h>
 #include <systemc>
 #include <tlm/scc/tlm_mm.h>
 #include <util/ities.h>
@@ -85,7 +86,7 @@ private:
         } else
             clk_delayed.notify(sc_core::SC_ZERO_TIME /*clk_if ? clk_if->period() - 1_ps : 1_ps*/);
 #else
-        clk_delayed.notify(axi::CLK_DELAY);
+        clk_delayed.on_clock();
 #endif
     }
     void ar_t();
@@ -117,7 +118,8 @@ private:
     std::deque<axi::fsm::fsm_handle*> snp_resp_queue;
 
     sc_core::sc_clock* clk_if{nullptr};
-    sc_core::sc_event clk_delayed, clk_self, ar_end_req_evt, wdata_end_req_evt;
+    sc_core::sc_event clk_self, ar_end_req_evt, wdata_end_req_evt;
+    scc::delayed_clock_event clk_delayed{clk_i, axi::CLK_DELAY};
     std::array<fsm_handle*, 3> active_req_beat{nullptr, nullptr, nullptr};
     std::array<fsm_handle*, 3> active_req{nullptr, nullptr, nullptr};
     std::array<fsm_handle*, 3> active_resp_beat{nullptr, nullptr, nullptr};
@@ -263,7 +265,7 @@ template <typename CFG> inline void axi::pin::ace_lite_target<CFG>::ar_t() {
     auto arsize = util::ilog2(CFG::BUSWIDTH / 8);
     auto data_len = (1 << arsize) * (arlen + 1);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->ar_valid.read()) {
             wait(this->ar_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -319,7 +321,7 @@ template <typename CFG> inline void axi::pin::ace_lite_target<CFG>::rresp_t() {
         this->r_id->write(ext->get_id());
         this->r_last->write(val & 0x2);
         do {
-            wait(this->r_ready.posedge_event() | clk_delayed);
+            wait(this->r_ready.posedge_event() | clk_delayed.get());
             if(this->r_ready.read()) {
                 auto evt = (val & 0x2) ? axi::fsm::protocol_time_point_e::EndRespE : axi::fsm::protocol_time_point_e::EndPartRespE;
                 react(evt, active_resp_beat[tlm::TLM_READ_COMMAND]);
@@ -337,7 +339,7 @@ template <typename CFG> inline void axi::pin::ace_lite_target<CFG>::aw_t() {
     wait(sc_core::SC_ZERO_TIME);
     const auto awsize = util::ilog2(CFG::BUSWIDTH / 8);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->aw_valid.read()) {
             wait(this->aw_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -373,7 +375,7 @@ template <typename CFG> inline void axi::pin::ace_lite_target<CFG>::wdata_t() {
     this->w_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(this->w_valid.read() ? clk_delayed : this->w_valid.posedge_event());
+        wait(this->w_valid.read() ? clk_delayed.get() : this->w_valid.posedge_event());
         if(this->w_valid.read()) {
             if(!active_req[tlm::TLM_WRITE_COMMAND]) {
                 if(!aw_que.has_next())
@@ -482,7 +484,7 @@ template <typename CFG> inline void axi::pin::ace_lite_target<CFG>::bresp_t() {
         this->b_id->write(ext->get_id());
         SCCTRACE(SCMOD) << "got write response";
         do {
-            wait(this->b_ready.posedge_event() | clk_delayed);
+            wait(this->b_ready.posedge_event() | clk_delayed.get());
             if(this->b_ready.read()) {
                 react(axi::fsm::protocol_time_point_e::EndRespE, active_resp_beat[tlm::TLM_WRITE_COMMAND]);
             }
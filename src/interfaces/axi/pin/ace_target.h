@@ -21,6 +21,7 @@
 #include <axi/fsm/base.h>
 #include <axi/fsm/protocol_fsm.h>
 #include <axi/signal_if.h>
+#include <scc/delayed_clock_event.h>
 #include <systemc>
 #include <tlm/scc/tlm_mm.h>
 #include <util/ities.h>
@@ -101,7 +102,7 @@ private:
         } else
             clk_delayed.notify(sc_core::SC_ZERO_TIME /*clk_if ? clk_if->period() - 1_ps : 1_ps*/);
 #else
-        clk_delayed.notify(axi::CLK_DELAY);
+        clk_delayed.on_clock();
 #endif
     }
     void ar_t();
@@ -134,7 +135,8 @@ private:
     std::deque<axi::fsm::fsm_handle*> snp_resp_queue;
 
     sc_core::sc_clock* clk_if{nullptr};
-    sc_core::sc_event clk_delayed, clk_self, ar_end_req_evt, wdata_end_req_evt, ac_evt, cd_end_req_evt, cr_end_req_evt;
+    sc_core::sc_event clk_self, ar_end_req_evt, wdata_end_req_evt, ac_evt, cd_end_req_evt, cr_end_req_evt;
+    scc::delayed_clock_event clk_delayed{clk_i, axi::CLK_DELAY};
     std::array<fsm_handle*, 3> active_req_beat{nullptr, nullptr, nullptr};
     std::array<fsm_handle*, 4> active_req{nullptr, nullptr, nullptr};
     std::array<fsm_handle*, 3> active_resp_beat{nullptr, nullptr, nullptr};
@@ -355,7 +357,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::ar_t() {
 
     auto data_len = (1 << arsize) * (arlen + 1);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->ar_valid.read()) {
             wait(this->ar_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -415,7 +417,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::rresp_t() {
             this->r_last->write(val & 0x2);
         }
         do {
-            wait(this->r_ready.posedge_event() | clk_delayed);
+            wait(this->r_ready.posedge_event() | clk_delayed.get());
             if(this->r_ready.read()) {
                 auto evt =
                     CFG::IS_LITE || (val & 0x2) ? axi::fsm::protocol_time_point_e::EndRespE : axi::fsm::protocol_time_point_e::EndPartRespE;
@@ -435,7 +437,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::aw_t() {
     wait(sc_core::SC_ZERO_TIME);
     const auto awsize = util::ilog2(CFG::BUSWIDTH / 8);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->aw_valid.read()) {
             wait(this->aw_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -469,7 +471,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::wdata_t() {
     this->w_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(this->w_valid.posedge_event() | clk_delayed);
+        wait(this->w_valid.read() ? clk_delayed.get() : this->w_valid.posedge_event());
         this->w_ready.write(false);
         if(this->w_valid.event() || (!active_req_beat[tlm::TLM_WRITE_COMMAND] && this->w_valid.read())) {
             if(!active_req[tlm::TLM_WRITE_COMMAND]) {
@@ -581,7 +583,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::bresp_t() {
             this->b_id->write(ext->get_id());
         SCCTRACE(SCMOD) << "got write response";
         do {
-            wait(this->b_ready.posedge_event() | clk_delayed);
+            wait(this->b_ready.posedge_event() | clk_delayed.get());
             if(this->b_ready.read()) {
                 react(axi::fsm::protocol_time_point_e::EndRespE, active_resp_beat[tlm::TLM_WRITE_COMMAND]);
             }
@@ -609,7 +611,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::ac_t() {
         wait(ac_evt);
         this->ac_valid.write(true);
         do {
-            wait(this->ac_ready.posedge_event() | clk_delayed);
+            wait(this->ac_ready.posedge_event() | clk_delayed.get());
             if(this->ac_ready.read()) {
                 SCCTRACE(SCMOD) << "in ac_t() detect ac_ready high , schedule EndReq";
                 react(axi::fsm::protocol_time_point_e::EndReqE, active_req[SNOOP]);
@@ -624,7 +626,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::cd_t() {
     this->cd_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(this->cd_valid.posedge_event() | clk_delayed);
+        wait(this->cd_valid.read() ? clk_delayed.get() : this->cd_valid.posedge_event());
         if(this->cd_valid.read()) {
             SCCTRACE(SCMOD) << "in cd_t(), received cd_valid high ";
             wait(sc_core::SC_ZERO_TIME);
@@ -683,7 +685,7 @@ template <typename CFG> inline void axi::pin::ace_target<CFG>::cr_t() {
     this->cr_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(this->cr_valid.posedge_event() | clk_delayed);
+        wait(this->cr_valid.read() ? clk_delayed.get() : this->cr_valid.posedge_event());
         if(this->cr_valid.read()) {
             SCCTRACE(SCMOD) << "in cr_t()  received cr_valid high ";
             wait(sc_core::SC_ZERO_TIME);
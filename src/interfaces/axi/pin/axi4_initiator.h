@@ -20,8 +20,10 @@
 #include <axi/axi_tlm.h>
 #include <axi/fsm/base.h>
 #include <axi/fsm/protocol_fsm.h>
+#include <axi/pin/beat_lanes.h>
 #include <axi/signal_if.h>
 #include <cci_configuration>
+#include <scc/delayed_clock_event.h>
 #include <scc/fifo_w_cb.h>
 #include <systemc>
 #include <tlm_utils/peq_with_cb_and_phase.h>
@@ -78,8 +80,7 @@ private:
 
     tlm::tlm_sync_enum nb_transport_fw(payload_type& trans, phase_type& phase, sc_core::sc_time& t) override {
         assert(trans.get_extension<axi::axi4_extension>() && "missing AXI4 extension");
-        sc_core::sc_time delay; // FIXME: calculate delay correctly
-        fw_peq.notify(trans, phase, delay);
+        fw_peq.notify(trans, phase, get_cycle_delay(clk_if, t));
         return tlm::TLM_ACCEPTED;
     }
 
@@ -96,7 +97,7 @@ private:
 
     void setup_callbacks(fsm_handle* fsm_hndl);
 
-    void clk_delay() { clk_delayed.notify(axi::CLK_DELAY); }
+    void clk_delay() { clk_delayed.on_clock(); }
 
     void ar_t();
     void r_t();
@@ -105,7 +106,8 @@ private:
     void b_t();
     std::array<unsigned, 3> outstanding_cnt{0, 0, 0};
     sc_core::sc_clock* clk_if{nullptr};
-    sc_core::sc_event clk_delayed, clk_self, r_end_resp_evt, w_end_resp_evt;
+    sc_core::sc_event clk_self, r_end_resp_evt, w_end_resp_evt;
+    scc::delayed_clock_event clk_delayed{clk_i, axi::CLK_DELAY};
     void nb_fw(payload_type& trans, const phase_type& phase) {
         auto t = sc_core::SC_ZERO_TIME;
         base::nb_fw(trans, phase, t);
@@ -209,56 +211,22 @@ template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::write_aw(tlm:
     }
 }
 
-// FIXME: strb not yet correct
 template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::write_wdata(tlm::tlm_generic_payload& trans, unsigned beat) {
     typename CFG::data_t data{0};
     typename CFG::strb_t strb{0};
     auto ext = trans.get_extension<axi::axi4_extension>();
-    auto size = 1u << ext->get_size();
-    auto byte_offset = beat * size;
-    auto offset = (trans.get_address() + byte_offset) & (CFG::BUSWIDTH / 8 - 1);
-    auto beptr = trans.get_byte_enable_length() ? trans.get_byte_enable_ptr() + byte_offset : nullptr;
-    if(offset && (size + offset) > (CFG::BUSWIDTH / 8)) { // un-aligned multi-beat access
-        if(beat == 0) {
-            auto dptr = trans.get_data_ptr();
-            if(dptr)
-                for(size_t i = offset; i < size; ++i, ++dptr) {
-                    auto bit_offs = i * 8;
-                    data(bit_offs + 7, bit_offs) = *dptr;
-                    if(beptr) {
-                        strb[i] = *beptr == 0xff;
-                        ++beptr;
-                    } else
-                        strb[i] = true;
-                }
-        } else {
-            auto beat_start_idx = byte_offset - offset;
-            auto data_len = trans.get_data_length();
-            auto dptr = trans.get_data_ptr() + beat_start_idx;
-            if(dptr)
-                for(size_t i = 0; i < size && (beat_start_idx + i) < data_len; ++i, ++dptr) {
-                    auto bit_offs = i * 8;
-                    data(bit_offs + 7, bit_offs) = *dptr;
-                    if(beptr) {
-                        strb[i] = *beptr == 0xff;
-                        ++beptr;
-                    } else
-                        strb[i] = true;
-                }
+    auto lanes = get_beat_lanes(trans.get_address(), 1u << ext->get_size(), ext->get_length(), ext->get_burst(), beat, CFG::BUSWIDTH / 8);
+    auto dptr = trans.get_data_ptr();
+    auto data_len = trans.get_data_length();
+    auto beptr = trans.get_byte_enable_ptr();
+    auto be_len = trans.get_byte_enable_length();
+    if(dptr)
+        for(size_t lane = lanes.first, idx = lanes.data_idx; lane < lanes.end && idx < data_len; ++lane, ++idx) {
+            auto bit_offs = lane * 8;
+            data(bit_offs + 7, bit_offs) = dptr[idx];
+            // the byte enables may be a pattern shorter than the data
+            strb[lane] = !beptr || !be_len || beptr[idx % be_len] == tlm::TLM_BYTE_ENABLED;
         }
-    } else { // aligned or single beat access
-        auto dptr = trans.get_data_ptr() + byte_offset;
-        if(dptr)
-            for(size_t i = 0; i < size; ++i, ++dptr) {
-                auto bit_offs = (offset + i) * 8;
-                data(bit_offs + 7, bit_offs) = *dptr;
-                if(beptr) {
-                    strb[offset + i] = *beptr == 0xff;
-                    ++beptr;
-                } else
-                    strb[offset + i] = true;
-            }
-    }
     this->w_data.write(data);
     this->w_strb.write(strb);
     if(!CFG::IS_LITE) {
@@ -362,7 +330,7 @@ template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::ar_t() {
         write_ar(*val.gp);
         this->ar_valid.write(true);
         do {
-            wait(this->ar_ready.posedge_event() | clk_delayed);
+            wait(this->ar_ready.posedge_event() | clk_delayed.get());
             if(this->ar_ready.read())
                 react(axi::fsm::protocol_time_point_e::EndReqE, val.gp);
         } while(!this->ar_ready.read());
@@ -375,7 +343,7 @@ template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::r_t() {
     this->r_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->r_valid.read()) {
             wait(this->r_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -386,40 +354,18 @@ template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::r_t() {
         auto& q = rd_resp_by_id[id];
         sc_assert(q.size() && "No transaction found for received id");
         auto* fsm_hndl = q.front();
-        auto beat_count = fsm_hndl->beat_count;
-        auto size = axi::get_burst_size(*fsm_hndl->trans);
-        auto byte_offset = beat_count * size;
-        auto offset = (fsm_hndl->trans->get_address() + byte_offset) & (CFG::BUSWIDTH / 8 - 1);
-        if(offset && (size + offset) > (CFG::BUSWIDTH / 8)) { // un-aligned multi-beat access
-            if(beat_count == 0) {
-                auto dptr = fsm_hndl->trans->get_data_ptr();
-                if(dptr)
-                    for(size_t i = offset; i < size; ++i, ++dptr) {
-                        auto bit_offs = i * 8;
-                        *dptr = data(bit_offs + 7, bit_offs).to_uint();
-                    }
-            } else {
-                auto beat_start_idx = beat_count * size - offset;
-                auto data_len = fsm_hndl->trans->get_data_length();
-                auto dptr = fsm_hndl->trans->get_data_ptr() + beat_start_idx;
-                if(dptr)
-                    for(size_t i = 0; i < size && (beat_start_idx + i) < data_len; ++i, ++dptr) {
-                        auto bit_offs = i * 8;
-                        *dptr = data(bit_offs + 7, bit_offs).to_uint();
-                    }
+        auto ext = fsm_hndl->trans->get_extension<axi::axi4_extension>();
+        auto lanes = get_beat_lanes(fsm_hndl->trans->get_address(), 1u << ext->get_size(), ext->get_length(), ext->get_burst(),
+                                    fsm_hndl->beat_count, CFG::BUSWIDTH / 8);
+        auto dptr = fsm_hndl->trans->get_data_ptr();
+        auto data_len = fsm_hndl->trans->get_data_length();
+        if(dptr)
+            for(size_t lane = lanes.first, idx = lanes.data_idx; lane < lanes.end && idx < data_len; ++lane, ++idx) {
+                auto bit_offs = lane * 8;
+                dptr[idx] = data(bit_offs + 7, bit_offs).to_uint();
             }
-        } else { // aligned or single beat access
-            auto dptr = fsm_hndl->trans->get_data_ptr() + beat_count * size;
-            if(dptr)
-                for(size_t i = 0; i < size; ++i, ++dptr) {
-                    auto bit_offs = (offset + i) * 8;
-                    *dptr = data(bit_offs + 7, bit_offs).to_uint();
-                }
-        }
-        axi::axi4_extension* e;
-        fsm_hndl->trans->get_extension(e);
-        e->set_resp(axi::into<axi::resp_e>(resp));
-        e->add_to_response_array(*e);
+        ext->set_resp(axi::into<axi::resp_e>(resp));
+        ext->add_to_response_array(*ext);
         auto tp = CFG::IS_LITE || this->r_last->read() ? axi::fsm::protocol_time_point_e::BegRespE
                                                        : axi::fsm::protocol_time_point_e::BegPartRespE;
         react(tp, fsm_hndl);
@@ -438,7 +384,7 @@ template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::aw_t() {
         write_aw(*val.gp);
         this->aw_valid.write(true);
         do {
-            wait(this->aw_ready.posedge_event() | clk_delayed);
+            wait(this->aw_ready.posedge_event() | clk_delayed.get());
         } while(!this->aw_ready.read());
         wait(clk_i.posedge_event());
         this->aw_valid.write(false);
@@ -469,7 +415,7 @@ template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::wdata_t() {
         if(!CFG::IS_LITE)
             this->w_last->write(val.last);
         do {
-            wait(this->w_ready.posedge_event() | clk_delayed);
+            wait(this->w_ready.posedge_event() | clk_delayed.get());
             if(!pipelined_wrreq && this->w_ready.read()) {
                 auto evt =
                     CFG::IS_LITE || (val.last) ? axi::fsm::protocol_time_point_e::EndReqE : axi::fsm::protocol_time_point_e::EndPartReqE;
@@ -485,7 +431,7 @@ template <typename CFG> inline void axi::pin::axi4_initiator<CFG>::b_t() {
     this->b_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->b_valid.read()) {
             wait(this->b_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -0,0 +1,539 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _BUS_AXI_PIN_AXI4_METHOD_TARGET_H_
+#define _BUS_AXI_PIN_AXI4_METHOD_TARGET_H_
+
+#include <axi/axi_tlm.h>
+#include <axi/fsm/base.h>
+#include <axi/fsm/protocol_fsm.h>
+#include <axi/pin/beat_lanes.h>
+#include <axi/signal_if.h>
+#include <scc/delayed_clock_event.h>
+#include <scc/utilities.h>
+#include <systemc>
+#include <tlm/scc/tlm_mm.h>
+#include <util/ities.h>
+
+//! TLM2.0 components modeling AXI
+namespace axi {
+//! pin level adapters
+namespace pin {
+
+using namespace axi::fsm;
+/**
+ * @class axi4_method_target
+ * @brief pin-level AXI4 target BFM implementing the channel state machines as SC_METHODs
+ *
+ * The BFM is a drop-in replacement for axi4_target with the same ports, the same pin-level timing and the same TLM
+ * behavior. Each channel is a SC_METHOD with an explicit state instead of a SC_THREAD so that no thread context switch
+ * happens on a clock edge. Each wait() of the thread implementation corresponds to a next_trigger() with the same
+ * event.
+ */
+template <typename CFG>
+struct axi4_method_target : public sc_core::sc_module,
+                            public aw_axi<CFG, typename CFG::slave_types>,
+                            public wdata_axi<CFG, typename CFG::slave_types>,
+                            public b_axi<CFG, typename CFG::slave_types>,
+                            public ar_axi<CFG, typename CFG::slave_types>,
+                            public rresp_axi<CFG, typename CFG::slave_types>,
+                            protected axi::fsm::base,
+                            public axi::axi_bw_transport_if<axi::axi_protocol_types> {
+    SC_HAS_PROCESS(axi4_method_target);
+
+    using payload_type = axi::axi_protocol_types::tlm_payload_type;
+    using phase_type = axi::axi_protocol_types::tlm_phase_type;
+
+    sc_core::sc_in<bool> clk_i{"clk_i"};
+
+    axi::axi_initiator_socket<CFG::BUSWIDTH> isckt{"isckt"};
+
+    axi4_method_target(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm)
+    , base(CFG::BUSWIDTH) {
+        instance_name = name();
+        isckt.bind(*this);
+        SC_METHOD(clk_delay);
+        sensitive << clk_i.pos();
+        dont_initialize();
+        SC_METHOD(ar_m);
+        SC_METHOD(rresp_m);
+        SC_METHOD(aw_m);
+        SC_METHOD(wdata_m);
+        SC_METHOD(bresp_m);
+    }
+
+private:
+    //! the state of a channel method, it names the trigger the method is waiting for
+    enum state_e { INIT, START, WAIT_CLK, WAIT_VALID, WAIT_VALID_DLY, WAIT_QUEUE, WAIT_END_REQ, WAIT_READY, WAIT_EDGE };
+
+    tlm::tlm_sync_enum nb_transport_bw(payload_type& trans, phase_type& phase, sc_core::sc_time& t) override;
+
+    void invalidate_direct_mem_ptr(sc_dt::uint64 start_range, sc_dt::uint64 end_range) override {}
+
+    void end_of_elaboration() override { clk_if = dynamic_cast<sc_core::sc_clock*>(clk_i.get_interface()); }
+
+    axi::fsm::fsm_handle* create_fsm_handle() override { return new fsm_handle(); }
+
+    void setup_callbacks(axi::fsm::fsm_handle*) override;
+
+    void clk_delay() {
+#ifdef DELTA_SYNC
+        if(sc_core::sc_delta_count_at_current_time() < 5) {
+            clk_self.notify(sc_core::SC_ZERO_TIME);
+            next_trigger(clk_self);
+        } else
+            clk_delayed.notify(sc_core::SC_ZERO_TIME);
+#else
+        clk_delayed.on_clock();
+#endif
+    }
+    template <typename T> void suspend(state_e& state, state_e next, T const& trigger) {
+        state = next;
+        next_trigger(trigger);
+    }
+    template <typename SIG> bool sample_valid(state_e& state, SIG const& valid);
+    void ar_m();
+    void rresp_m();
+    void aw_m();
+    void wdata_m();
+    void bresp_m();
+    void start_write_req();
+    void write_beat();
+    static typename CFG::data_t get_read_data_for_beat(fsm::fsm_handle* fsm_hndl);
+    struct aw_data {
+        unsigned id;
+        uint64_t addr;
+        unsigned prot;
+        unsigned size;
+        unsigned cache;
+        unsigned burst;
+        unsigned qos;
+        unsigned region;
+        unsigned len;
+        bool lock;
+        uint64_t user;
+        unsigned atop;
+    };
+    sc_core::sc_clock* clk_if{nullptr};
+    sc_core::sc_event clk_self, ar_end_req_evt, wdata_end_req_evt;
+    scc::delayed_clock_event clk_delayed{clk_i, axi::CLK_DELAY};
+    std::array<fsm_handle*, 3> active_req_beat{nullptr, nullptr, nullptr};
+    std::array<fsm_handle*, 3> active_req{nullptr, nullptr, nullptr};
+    std::array<fsm_handle*, 3> active_resp_beat{nullptr, nullptr, nullptr};
+    scc::peq<aw_data> aw_que;
+    scc::peq<std::tuple<uint8_t, fsm_handle*>> rresp_vl;
+    scc::peq<std::tuple<uint8_t, fsm_handle*>> wresp_vl;
+    state_e ar_state{INIT}, rresp_state{INIT}, aw_state{INIT}, wdata_state{INIT}, bresp_state{INIT};
+    std::tuple<uint8_t, fsm_handle*> rresp_beat{0, nullptr}, bresp_beat{0, nullptr};
+    bool wdata_last{false};
+};
+
+} // namespace pin
+} // namespace axi
+
+template <typename CFG>
+inline tlm::tlm_sync_enum axi::pin::axi4_method_target<CFG>::nb_transport_bw(payload_type& trans, phase_type& phase, sc_core::sc_time& t) {
+    auto ret = tlm::TLM_ACCEPTED;
+    auto delay = get_cycle_delay(clk_if, t);
+    SCCTRACE(SCMOD) << "nb_transport_bw " << phase << " of trans " << trans;
+    if(phase == axi::END_PARTIAL_REQ || phase == tlm::END_REQ) { // read/write
+        schedule(phase == tlm::END_REQ ? EndReqE : EndPartReqE, &trans, delay, false);
+    } else if(phase == axi::BEGIN_PARTIAL_RESP || phase == tlm::BEGIN_RESP) { // read/write response
+        schedule(phase == tlm::BEGIN_RESP ? BegRespE : BegPartRespE, &trans, delay, false);
+    } else
+        SCCFATAL(SCMOD) << "Illegal phase received: " << phase;
+    return ret;
+}
+
+template <typename CFG> typename CFG::data_t axi::pin::axi4_method_target<CFG>::get_read_data_for_beat(fsm_handle* fsm_hndl) {
+    auto ext = fsm_hndl->trans->get_extension<axi::axi4_extension>();
+    auto lanes = get_beat_lanes(fsm_hndl->trans->get_address(), 1u << ext->get_size(), ext->get_length(), ext->get_burst(),
+                                fsm_hndl->beat_count, CFG::BUSWIDTH / 8);
+    auto dptr = fsm_hndl->trans->get_data_ptr();
+    auto data_len = fsm_hndl->trans->get_data_length();
+    typename CFG::data_t data{0};
+    for(size_t lane = lanes.first, idx = lanes.data_idx; lane < lanes.end && idx < data_len; ++lane, ++idx) {
+        auto bit_offs = lane * 8;
+        data(bit_offs + 7, bit_offs) = dptr[idx];
+    }
+    return data;
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::setup_callbacks(fsm_handle* fsm_hndl) {
+    fsm_hndl->fsm->cb[RequestPhaseBeg] = [this, fsm_hndl]() -> void { fsm_hndl->beat_count = 0; };
+    fsm_hndl->fsm->cb[BegPartReqE] = [this, fsm_hndl]() -> void {
+        sc_assert(fsm_hndl->trans->get_command() == tlm::TLM_WRITE_COMMAND);
+        tlm::tlm_phase phase = axi::BEGIN_PARTIAL_REQ;
+        sc_core::sc_time t(sc_core::SC_ZERO_TIME);
+        auto ret = isckt->nb_transport_fw(*fsm_hndl->trans, phase, t);
+        if(ret == tlm::TLM_UPDATED) {
+            schedule(EndPartReqE, fsm_hndl->trans, t, true);
+        }
+    };
+    fsm_hndl->fsm->cb[EndPartReqE] = [this, fsm_hndl]() -> void {
+        wdata_end_req_evt.notify();
+        active_req_beat[tlm::TLM_WRITE_COMMAND] = nullptr;
+        fsm_hndl->beat_count++;
+    };
+    fsm_hndl->fsm->cb[BegReqE] = [this, fsm_hndl]() -> void {
+        tlm::tlm_phase phase = tlm::BEGIN_REQ;
+        sc_core::sc_time t(sc_core::SC_ZERO_TIME);
+        auto ret = isckt->nb_transport_fw(*fsm_hndl->trans, phase, t);
+        if(ret == tlm::TLM_UPDATED) {
+            schedule(EndReqE, fsm_hndl->trans, t, true);
+        }
+    };
+    fsm_hndl->fsm->cb[EndReqE] = [this, fsm_hndl]() -> void {
+        switch(fsm_hndl->trans->get_command()) {
+        case tlm::TLM_READ_COMMAND:
+            ar_end_req_evt.notify();
+            active_req_beat[tlm::TLM_READ_COMMAND] = nullptr;
+            break;
+        case tlm::TLM_WRITE_COMMAND:
+            wdata_end_req_evt.notify();
+            active_req_beat[tlm::TLM_WRITE_COMMAND] = nullptr;
+            fsm_hndl->beat_count++;
+            break;
+        default:
+            break;
+        }
+    };
+    fsm_hndl->fsm->cb[BegPartRespE] = [this, fsm_hndl]() -> void {
+        assert(fsm_hndl->trans->is_read());
+        active_resp_beat[tlm::TLM_READ_COMMAND] = fsm_hndl;
+        rresp_vl.notify({1, fsm_hndl});
+    };
+    fsm_hndl->fsm->cb[EndPartRespE] = [this, fsm_hndl]() -> void {
+        // scheduling the response
+        assert(fsm_hndl->trans->is_read());
+        tlm::tlm_phase phase = axi::END_PARTIAL_RESP;
+        sc_core::sc_time t(clk_if ? ::scc::time_to_next_posedge(clk_if) - 1_ps : sc_core::SC_ZERO_TIME);
+        auto ret = isckt->nb_transport_fw(*fsm_hndl->trans, phase, t);
+        active_resp_beat[tlm::TLM_READ_COMMAND] = nullptr;
+        fsm_hndl->beat_count++;
+    };
+    fsm_hndl->fsm->cb[BegRespE] = [this, fsm_hndl]() -> void {
+        SCCTRACE(SCMOD) << "processing event BegRespE for trans " << *fsm_hndl->trans;
+        active_resp_beat[fsm_hndl->trans->get_command()] = fsm_hndl;
+        switch(fsm_hndl->trans->get_command()) {
+        case tlm::TLM_READ_COMMAND:
+            rresp_vl.notify({3, fsm_hndl});
+            break;
+        case tlm::TLM_WRITE_COMMAND:
+            wresp_vl.notify({3, fsm_hndl});
+            break;
+        default:
+            break;
+        }
+    };
+    fsm_hndl->fsm->cb[EndRespE] = [this, fsm_hndl]() -> void {
+        // scheduling the response
+        tlm::tlm_phase phase = tlm::END_RESP;
+        sc_core::sc_time t(clk_if ? ::scc::time_to_next_posedge(clk_if) - 1_ps : sc_core::SC_ZERO_TIME);
+        auto ret = isckt->nb_transport_fw(*fsm_hndl->trans, phase, t);
+        fsm_hndl->finish.notify();
+        active_resp_beat[fsm_hndl->trans->get_command()] = nullptr;
+    };
+}
+/*
+ * Handles the states WAIT_CLK, WAIT_VALID and WAIT_VALID_DLY of a request channel. Returns true if VALID is asserted
+ * after the delayed clock edge, otherwise the next trigger is set up.
+ */
+template <typename CFG>
+template <typename SIG>
+inline bool axi::pin::axi4_method_target<CFG>::sample_valid(state_e& state, SIG const& valid) {
+    if(state == WAIT_VALID) {
+        suspend(state, WAIT_VALID_DLY, CLK_DELAY); // verilator might create spurious events
+        return false;
+    }
+    if(!valid.read()) {
+        suspend(state, WAIT_VALID, valid.posedge_event());
+        return false;
+    }
+    return true;
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::ar_m() {
+    switch(ar_state) {
+    case INIT:
+        this->ar_ready.write(false);
+        suspend(ar_state, START, sc_core::SC_ZERO_TIME);
+        return;
+    case WAIT_END_REQ:
+        this->ar_ready.write(true);
+        suspend(ar_state, WAIT_EDGE, clk_i.posedge_event());
+        return;
+    case WAIT_EDGE:
+        this->ar_ready.write(false);
+        // fall through
+    case START:
+        suspend(ar_state, WAIT_CLK, clk_delayed.get());
+        return;
+    default:
+        break;
+    }
+    if(!sample_valid(ar_state, this->ar_valid))
+        return;
+    SCCTRACE(SCMOD) << "ARVALID detected for 0x" << std::hex << this->ar_addr.read();
+    auto arid = CFG::IS_LITE ? 0U : this->ar_id->read().to_uint();
+    auto arlen = CFG::IS_LITE ? 0U : this->ar_len->read().to_uint();
+    auto arsize = CFG::IS_LITE ? util::ilog2(CFG::BUSWIDTH / 8) : this->ar_size->read().to_uint();
+    auto data_len = get_burst_bytes(this->ar_addr.read().to_uint64(), 1u << arsize, arlen);
+    auto gp = tlm::scc::tlm_mm<>::get().allocate<axi::axi4_extension>(data_len);
+    gp->set_address(this->ar_addr.read());
+    gp->set_command(tlm::TLM_READ_COMMAND);
+    gp->set_streaming_width(data_len);
+    axi::axi4_extension* ext;
+    gp->get_extension(ext);
+    ext->set_id(arid);
+    ext->set_length(arlen);
+    ext->set_size(arsize);
+    ext->set_burst(CFG::IS_LITE ? axi::burst_e::INCR : axi::into<axi::burst_e>(this->ar_burst->read()));
+    ext->set_exclusive(!CFG::IS_LITE && this->ar_lock->read());
+    ext->set_prot(this->ar_prot->read());
+    ext->set_qos(CFG::IS_LITE ? 0U : this->ar_qos->read().to_uint());
+    ext->set_region(CFG::IS_LITE ? 0U : this->ar_region->read().to_uint());
+
+    active_req_beat[tlm::TLM_READ_COMMAND] = find_or_create(gp);
+    react(axi::fsm::protocol_time_point_e::BegReqE, active_req_beat[tlm::TLM_READ_COMMAND]);
+    suspend(ar_state, WAIT_END_REQ, ar_end_req_evt);
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::rresp_m() {
+    switch(rresp_state) {
+    case INIT:
+        this->r_valid.write(false);
+        suspend(rresp_state, START, sc_core::SC_ZERO_TIME);
+        return;
+    case WAIT_READY: {
+        if(!this->r_ready.read()) {
+            suspend(rresp_state, WAIT_READY, this->r_ready.posedge_event() | clk_delayed.get());
+            return;
+        }
+        auto val = std::get<0>(rresp_beat);
+        auto evt = CFG::IS_LITE || (val & 0x2) ? axi::fsm::protocol_time_point_e::EndRespE : axi::fsm::protocol_time_point_e::EndPartRespE;
+        react(evt, active_resp_beat[tlm::TLM_READ_COMMAND]);
+        SCCTRACE(SCMOD) << "finished read response beat of trans [" << std::get<1>(rresp_beat)->trans << "]";
+        suspend(rresp_state, WAIT_EDGE, clk_i.posedge_event());
+        return;
+    }
+    case WAIT_EDGE:
+        this->r_valid.write(false);
+        if(!CFG::IS_LITE)
+            this->r_last->write(false);
+        // fall through
+    default:
+        break;
+    }
+    if(!rresp_vl.has_next()) {
+        suspend(rresp_state, WAIT_QUEUE, rresp_vl.event());
+        return;
+    }
+    rresp_beat = rresp_vl.get();
+    uint8_t val;
+    fsm_handle* fsm_hndl;
+    std::tie(val, fsm_hndl) = rresp_beat;
+    SCCTRACE(SCMOD) << "got read response beat of trans " << *fsm_hndl->trans;
+    auto ext = fsm_hndl->trans->get_extension<axi::axi4_extension>();
+    this->r_data.write(get_read_data_for_beat(fsm_hndl));
+    this->r_resp.write(axi::to_int(ext->get_resp()));
+    this->r_valid.write(val & 0x1);
+    if(!CFG::IS_LITE) {
+        this->r_id->write(ext->get_id());
+        this->r_last->write(val & 0x2);
+    }
+    suspend(rresp_state, WAIT_READY, this->r_ready.posedge_event() | clk_delayed.get());
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::aw_m() {
+    switch(aw_state) {
+    case INIT:
+        this->aw_ready.write(false);
+        suspend(aw_state, START, sc_core::SC_ZERO_TIME);
+        return;
+    case WAIT_EDGE:
+        this->aw_ready.write(false);
+        // fall through
+    case START:
+        suspend(aw_state, WAIT_CLK, clk_delayed.get());
+        return;
+    default:
+        break;
+    }
+    if(!sample_valid(aw_state, this->aw_valid))
+        return;
+    SCCTRACE(SCMOD) << "AWVALID detected for 0x" << std::hex << this->aw_addr.read();
+    // clang-format off
+    aw_data awd = {CFG::IS_LITE ? 0U : this->aw_id->read().to_uint(),
+        this->aw_addr.read().to_uint64(),
+        this->aw_prot.read().to_uint(),
+        CFG::IS_LITE ? util::ilog2(CFG::BUSWIDTH / 8) : this->aw_size->read().to_uint(),
+        CFG::IS_LITE ? 0U : this->aw_cache->read().to_uint(),
+        CFG::IS_LITE ? 0U : this->aw_burst->read().to_uint(),
+        CFG::IS_LITE ? 0U : this->aw_qos->read().to_uint(),
+        CFG::IS_LITE ? 0U : this->aw_region->read().to_uint(),
+        CFG::IS_LITE ? 0U : this->aw_len->read().to_uint(),
+        CFG::IS_LITE ? false : this->aw_lock->read(),
+        0,   // aw_user
+        CFG::IS_LITE ? 0U : this->aw_atop->read().to_uint()
+    };
+    // clang-format on
+    aw_que.notify(std::move(awd));
+    this->aw_ready.write(true);
+    suspend(aw_state, WAIT_EDGE, clk_i.posedge_event());
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::wdata_m() {
+    switch(wdata_state) {
+    case INIT:
+        this->w_ready.write(false);
+        suspend(wdata_state, START, sc_core::SC_ZERO_TIME);
+        return;
+    case WAIT_END_REQ:
+        this->w_ready.write(true);
+        suspend(wdata_state, WAIT_EDGE, clk_i.posedge_event());
+        return;
+    case WAIT_EDGE:
+        this->w_ready.write(false);
+        if(wdata_last)
+            active_req[tlm::TLM_WRITE_COMMAND] = nullptr;
+        // fall through
+    case START:
+        suspend(wdata_state, WAIT_VALID, this->w_valid.read() ? clk_delayed.get() : this->w_valid.posedge_event());
+        return;
+    case WAIT_VALID:
+        if(!this->w_valid.read()) {
+            suspend(wdata_state, WAIT_VALID, this->w_valid.posedge_event());
+            return;
+        }
+        if(active_req[tlm::TLM_WRITE_COMMAND])
+            break;
+    case WAIT_QUEUE:
+        if(!aw_que.has_next()) {
+            suspend(wdata_state, WAIT_QUEUE, aw_que.event());
+            return;
+        }
+        start_write_req();
+        break;
+    default:
+        break;
+    }
+    write_beat();
+    suspend(wdata_state, WAIT_END_REQ, wdata_end_req_evt);
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::start_write_req() {
+    auto awd = aw_que.get();
+    auto data_len = (1 << awd.size) * (awd.len + 1);
+    auto gp = tlm::scc::tlm_mm<>::get().allocate<axi::axi4_extension>(data_len, true);
+    gp->set_address(awd.addr);
+    gp->set_command(tlm::TLM_WRITE_COMMAND);
+    axi::axi4_extension* ext;
+    gp->get_extension(ext);
+    ext->set_id(awd.id);
+    ext->set_length(awd.len);
+    ext->set_size(awd.size);
+    ext->set_burst(axi::into<axi::burst_e>(awd.burst));
+    ext->set_prot(awd.prot);
+    ext->set_qos(awd.qos);
+    ext->set_cache(awd.cache);
+    ext->set_region(awd.region);
+    ext->set_exclusive(awd.lock);
+    ext->set_atop(awd.atop);
+    if(CFG::USERWIDTH)
+        ext->set_user(axi::common::id_type::CTRL, awd.user);
+
+    active_req_beat[tlm::TLM_WRITE_COMMAND] = find_or_create(gp);
+    active_req[tlm::TLM_WRITE_COMMAND] = active_req_beat[tlm::TLM_WRITE_COMMAND];
+    active_req_beat[tlm::TLM_WRITE_COMMAND]->aux.i32.i0 = 0;
+    active_req_beat[tlm::TLM_WRITE_COMMAND]->aux.i32.i1 = 0;
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::write_beat() {
+    auto* fsm_hndl = active_req[tlm::TLM_WRITE_COMMAND];
+    SCCTRACE(SCMOD) << "WDATA detected for 0x" << std::hex << this->ar_addr.read();
+    auto& gp = fsm_hndl->trans;
+    auto data = this->w_data.read();
+    auto strb = this->w_strb.read();
+    auto last = CFG::IS_LITE ? true : this->w_last->read();
+    auto ext = gp->get_extension<axi::axi4_extension>();
+    auto lanes = get_beat_lanes(gp->get_address(), 1u << ext->get_size(), ext->get_length(), ext->get_burst(), fsm_hndl->beat_count,
+                                CFG::BUSWIDTH / 8);
+    auto dptr = gp->get_data_ptr();
+    auto beptr = gp->get_byte_enable_ptr();
+    auto burst_len = get_burst_bytes(gp->get_address(), 1u << ext->get_size(), ext->get_length());
+    // aux.i32.i0 holds the number of the bytes up to the last enabled one, aux.i32.i1 the number of enabled bytes
+    for(size_t lane = lanes.first, idx = lanes.data_idx; lane < lanes.end && idx < burst_len; ++lane, ++idx) {
+        auto bit_offs = lane * 8;
+        dptr[idx] = data(bit_offs + 7, bit_offs).to_uint();
+        beptr[idx] = strb[lane] ? tlm::TLM_BYTE_ENABLED : tlm::TLM_BYTE_DISABLED;
+        if(strb[lane]) {
+            fsm_hndl->aux.i32.i0 = idx + 1;
+            fsm_hndl->aux.i32.i1++;
+        }
+    }
+    if(last) {
+        // the payload ends with the last enabled byte, disabled bytes in between are signaled by the byte enables
+        auto act_data_len = fsm_hndl->aux.i32.i1 ? fsm_hndl->aux.i32.i0 : burst_len;
+        gp->set_data_length(act_data_len);
+        gp->set_streaming_width(act_data_len);
+        gp->set_byte_enable_length(fsm_hndl->aux.i32.i1 == act_data_len ? 0 : act_data_len);
+    }
+    wdata_last = last;
+    auto tp = CFG::IS_LITE || this->w_last->read() ? axi::fsm::protocol_time_point_e::BegReqE
+                                                   : axi::fsm::protocol_time_point_e::BegPartReqE;
+    react(tp, fsm_hndl);
+}
+
+template <typename CFG> inline void axi::pin::axi4_method_target<CFG>::bresp_m() {
+    switch(bresp_state) {
+    case INIT:
+        this->b_valid.write(false);
+        suspend(bresp_state, START, sc_core::SC_ZERO_TIME);
+        return;
+    case WAIT_READY:
+        if(!this->b_ready.read()) {
+            suspend(bresp_state, WAIT_READY, this->b_ready.posedge_event() | clk_delayed.get());
+            return;
+        }
+        react(axi::fsm::protocol_time_point_e::EndRespE, active_resp_beat[tlm::TLM_WRITE_COMMAND]);
+        SCCTRACE(SCMOD) << "finished write response of trans [" << std::get<1>(bresp_beat)->trans << "]";
+        suspend(bresp_state, WAIT_EDGE, clk_i.posedge_event());
+        return;
+    case WAIT_EDGE:
+        this->b_valid.write(false);
+        // fall through
+    default:
+        break;
+    }
+    if(!wresp_vl.has_next()) {
+        suspend(bresp_state, WAIT_QUEUE, wresp_vl.event());
+        return;
+    }
+    bresp_beat = wresp_vl.get();
+    auto* fsm_hndl = std::get<1>(bresp_beat);
+    SCCTRACE(SCMOD) << "got write response of trans " << *fsm_hndl->trans;
+    auto ext = fsm_hndl->trans->get_extension<axi::axi4_extension>();
+    this->b_resp.write(axi::to_int(ext->get_resp()));
+    this->b_valid.write(true);
+    if(!CFG::IS_LITE)
+        this->b_id->write(ext->get_id());
+    SCCTRACE(SCMOD) << "got write response for b_id= " << this->b_id;
+    suspend(bresp_state, WAIT_READY, this->b_ready.posedge_event() | clk_delayed.get());
+}
+
+#endif /* _BUS_AXI_PIN_AXI4_METHOD_TARGET_H_ */
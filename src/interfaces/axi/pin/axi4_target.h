@@ -20,7 +20,9 @@
 #include <axi/axi_tlm.h>
 #include <axi/fsm/base.h>
 #include <axi/fsm/protocol_fsm.h>
+#include <axi/pin/beat_lanes.h>
 #include <axi/signal_if.h>
+#include <scc/delayed_clock_event.h>
 #include <scc/utilities.h>
 #include <systemc>
 #include <tlm/scc/tlm_mm.h>
@@ -85,7 +87,7 @@ private:
         } else
             clk_delayed.notify(sc_core::SC_ZERO_TIME /*clk_if ? clk_if->period() - 1_ps : 1_ps*/);
 #else
-        clk_delayed.notify(axi::CLK_DELAY);
+        clk_delayed.on_clock();
 #endif
     }
     void ar_t();
@@ -109,7 +111,8 @@ private:
         unsigned atop;
     };
     sc_core::sc_clock* clk_if{nullptr};
-    sc_core::sc_event clk_delayed, clk_self, ar_end_req_evt, wdata_end_req_evt;
+    sc_core::sc_event clk_self, ar_end_req_evt, wdata_end_req_evt;
+    scc::delayed_clock_event clk_delayed{clk_i, axi::CLK_DELAY};
     std::array<fsm_handle*, 3> active_req_beat{nullptr, nullptr, nullptr};
     std::array<fsm_handle*, 3> active_req{nullptr, nullptr, nullptr};
     std::array<fsm_handle*, 3> active_resp_beat{nullptr, nullptr, nullptr};
@@ -126,7 +129,7 @@ template <typename CFG> using axi5_target = axi4_target<CFG>;
 template <typename CFG>
 inline tlm::tlm_sync_enum axi::pin::axi4_target<CFG>::nb_transport_bw(payload_type& trans, phase_type& phase, sc_core::sc_time& t) {
     auto ret = tlm::TLM_ACCEPTED;
-    sc_core::sc_time delay = (clk_if && t < clk_if->period()) ? sc_core::SC_ZERO_TIME : t; // FIXME: calculate correct time
+    auto delay = get_cycle_delay(clk_if, t);
     SCCTRACE(SCMOD) << "nb_transport_bw " << phase << " of trans " << trans;
     if(phase == axi::END_PARTIAL_REQ || phase == tlm::END_REQ) { // read/write
         schedule(phase == tlm::END_REQ ? EndReqE : EndPartReqE, &trans, delay, false);
@@ -141,33 +144,15 @@ template <typename CFG>
 inline void axi::pin::axi4_target<CFG>::invalidate_direct_mem_ptr(sc_dt::uint64 start_range, sc_dt::uint64 end_range) {}
 
 template <typename CFG> typename CFG::data_t axi::pin::axi4_target<CFG>::get_read_data_for_beat(fsm_handle* fsm_hndl) {
-    auto beat_count = fsm_hndl->beat_count;
-    auto size = axi::get_burst_size(*fsm_hndl->trans);
-    auto byte_offset = beat_count * size;
-    auto offset = (fsm_hndl->trans->get_address() + byte_offset) & (CFG::BUSWIDTH / 8 - 1);
+    auto ext = fsm_hndl->trans->get_extension<axi::axi4_extension>();
+    auto lanes = get_beat_lanes(fsm_hndl->trans->get_address(), 1u << ext->get_size(), ext->get_length(), ext->get_burst(),
+                                fsm_hndl->beat_count, CFG::BUSWIDTH / 8);
+    auto dptr = fsm_hndl->trans->get_data_ptr();
+    auto data_len = fsm_hndl->trans->get_data_length();
     typename CFG::data_t data{0};
-    if(offset && (size + offset) > (CFG::BUSWIDTH / 8)) { // un-aligned multi-beat access
-        if(beat_count == 0) {
-            auto dptr = fsm_hndl->trans->get_data_ptr();
-            for(size_t i = offset; i < size; ++i, ++dptr) {
-                auto bit_offs = i * 8;
-                data(bit_offs + 7, bit_offs) = *dptr;
-            }
-        } else {
-            auto beat_start_idx = byte_offset - offset;
-            auto data_len = fsm_hndl->trans->get_data_length();
-            auto dptr = fsm_hndl->trans->get_data_ptr() + beat_start_idx;
-            for(size_t i = 0; i < size && (beat_start_idx + i) < data_len; ++i, ++dptr) {
-                auto bit_offs = i * 8;
-                data(bit_offs + 7, bit_offs) = *dptr;
-            }
-        }
-    } else { // aligned or single beat access
-        auto dptr = fsm_hndl->trans->get_data_ptr() + byte_offset;
-        for(size_t i = 0; i < size; ++i, ++dptr) {
-            auto bit_offs = (offset + i) * 8;
-            data(bit_offs + 7, bit_offs) = *dptr;
-        }
+    for(size_t lane = lanes.first, idx = lanes.data_idx; lane < lanes.end && idx < data_len; ++lane, ++idx) {
+        auto bit_offs = lane * 8;
+        data(bit_offs + 7, bit_offs) = dptr[idx];
     }
     return data;
 }
@@ -256,9 +241,9 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::ar_t() {
     auto arid = 0U;
     auto arlen = 0U;
     auto arsize = util::ilog2(CFG::BUSWIDTH / 8);
-    auto data_len = (1 << arsize) * (arlen + 1);
+    size_t data_len = 0;
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->ar_valid.read()) {
             wait(this->ar_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -269,7 +254,7 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::ar_t() {
             arlen = this->ar_len->read().to_uint();
             arsize = this->ar_size->read().to_uint();
         }
-        data_len = (1 << arsize) * (arlen + 1);
+        data_len = get_burst_bytes(this->ar_addr.read().to_uint64(), 1u << arsize, arlen);
         auto gp = tlm::scc::tlm_mm<>::get().allocate<axi::axi4_extension>(data_len);
         gp->set_address(this->ar_addr.read());
         gp->set_command(tlm::TLM_READ_COMMAND);
@@ -311,7 +296,7 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::rresp_t() {
             this->r_last->write(val & 0x2);
         }
         do {
-            wait(this->r_ready.posedge_event() | clk_delayed);
+            wait(this->r_ready.posedge_event() | clk_delayed.get());
             if(this->r_ready.read()) {
                 auto evt =
                     CFG::IS_LITE || (val & 0x2) ? axi::fsm::protocol_time_point_e::EndRespE : axi::fsm::protocol_time_point_e::EndPartRespE;
@@ -331,7 +316,7 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::aw_t() {
     wait(sc_core::SC_ZERO_TIME);
     const auto awsize = util::ilog2(CFG::BUSWIDTH / 8);
     while(true) {
-        wait(clk_delayed);
+        wait(clk_delayed.get());
         while(!this->aw_valid.read()) {
             wait(this->aw_valid.posedge_event());
             wait(CLK_DELAY); // verilator might create spurious events
@@ -363,7 +348,7 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::wdata_t() {
     this->w_ready.write(false);
     wait(sc_core::SC_ZERO_TIME);
     while(true) {
-        wait(this->w_valid.read() ? clk_delayed : this->w_valid.posedge_event());
+        wait(this->w_valid.read() ? clk_delayed.get() : this->w_valid.posedge_event());
         if(this->w_valid.read()) {
             if(!active_req[tlm::TLM_WRITE_COMMAND]) {
                 if(!aw_que.has_next())
@@ -391,6 +376,7 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::wdata_t() {
                 active_req_beat[tlm::TLM_WRITE_COMMAND] = find_or_create(gp);
                 active_req[tlm::TLM_WRITE_COMMAND] = active_req_beat[tlm::TLM_WRITE_COMMAND];
                 active_req_beat[tlm::TLM_WRITE_COMMAND]->aux.i32.i0 = 0;
+                active_req_beat[tlm::TLM_WRITE_COMMAND]->aux.i32.i1 = 0;
             }
             auto* fsm_hndl = active_req[tlm::TLM_WRITE_COMMAND];
             SCCTRACE(SCMOD) << "WDATA detected for 0x" << std::hex << this->ar_addr.read();
@@ -398,55 +384,28 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::wdata_t() {
             auto data = this->w_data.read();
             auto strb = this->w_strb.read();
             auto last = CFG::IS_LITE ? true : this->w_last->read();
-            auto beat_count = fsm_hndl->beat_count;
-            auto size = axi::get_burst_size(*fsm_hndl->trans);
-            auto byte_offset = beat_count * size;
-            auto offset = (fsm_hndl->trans->get_address() + byte_offset) & (CFG::BUSWIDTH / 8 - 1);
-            if(offset && (size + offset) > (CFG::BUSWIDTH / 8)) { // un-aligned multi-beat access
-                if(beat_count == 0) {
-                    auto dptr = fsm_hndl->trans->get_data_ptr();
-                    auto beptr = fsm_hndl->trans->get_byte_enable_ptr();
-                    for(size_t i = offset; i < size; ++i, ++dptr, ++beptr) {
-                        auto bit_offs = i * 8;
-                        *dptr = data(bit_offs + 7, bit_offs).to_uint();
-                        *beptr = strb[i] ? 0xff : 0;
-                        fsm_hndl->aux.i32.i0 += strb[i] ? 1 : 0;
-                    }
-                } else {
-                    auto beat_start_idx = byte_offset - offset;
-                    auto data_len = fsm_hndl->trans->get_data_length();
-                    auto dptr = fsm_hndl->trans->get_data_ptr() + beat_start_idx;
-                    auto beptr = fsm_hndl->trans->get_byte_enable_ptr() + beat_start_idx;
-                    for(size_t i = 0; i < size && (beat_start_idx + i) < data_len; ++i, ++dptr, ++beptr) {
-                        auto bit_offs = i * 8;
-                        *dptr = data(bit_offs + 7, bit_offs).to_uint();
-                        *beptr = strb[i] ? 0xff : 0;
-                        fsm_hndl->aux.i32.i0 += strb[i] ? 1 : 0;
-                    }
-                }
-            } else { // aligned or single beat access
-                auto dptr = fsm_hndl->trans->get_data_ptr() + byte_offset;
-                auto beptr = fsm_hndl->trans->get_byte_enable_ptr() + byte_offset;
-                for(size_t i = 0; i < size; ++i, ++dptr, ++beptr) {
-                    auto bit_offs = (offset + i) * 8;
-                    *dptr = data(bit_offs + 7, bit_offs).to_uint();
-                    *beptr = strb[offset + i] ? 0xff : 0;
-                    fsm_hndl->aux.i32.i0 += strb[offset + i] ? 1 : 0;
+            auto ext = gp->get_extension<axi::axi4_extension>();
+            auto lanes = get_beat_lanes(gp->get_address(), 1u << ext->get_size(), ext->get_length(), ext->get_burst(),
+                                        fsm_hndl->beat_count, CFG::BUSWIDTH / 8);
+            auto dptr = gp->get_data_ptr();
+            auto beptr = gp->get_byte_enable_ptr();
+            auto burst_len = get_burst_bytes(gp->get_address(), 1u << ext->get_size(), ext->get_length());
+            // aux.i32.i0 holds the number of the bytes up to the last enabled one, aux.i32.i1 the number of enabled bytes
+            for(size_t lane = lanes.first, idx = lanes.data_idx; lane < lanes.end && idx < burst_len; ++lane, ++idx) {
+                auto bit_offs = lane * 8;
+                dptr[idx] = data(bit_offs + 7, bit_offs).to_uint();
+                beptr[idx] = strb[lane] ? tlm::TLM_BYTE_ENABLED : tlm::TLM_BYTE_DISABLED;
+                if(strb[lane]) {
+                    fsm_hndl->aux.i32.i0 = idx + 1;
+                    fsm_hndl->aux.i32.i1++;
                 }
             }
-            // TODO: assuming consecutive write (not scattered)
-            auto strobe = strb.to_uint();
             if(last) {
-                // If it is axi lite, number of strobes define the size, for axi4 aligned accesses, axsize & axburst determine size,
-                // for unaligned accesses strobe count determines size
-                auto act_data_len = CFG::IS_LITE ? util::bit_count(strobe) : offset == 0 ? (beat_count + 1) * size : fsm_hndl->aux.i32.i0;
+                // the payload ends with the last enabled byte, disabled bytes in between are signaled by the byte enables
+                auto act_data_len = fsm_hndl->aux.i32.i1 ? fsm_hndl->aux.i32.i0 : burst_len;
                 gp->set_data_length(act_data_len);
                 gp->set_streaming_width(act_data_len);
-                if(fsm_hndl->aux.i32.i0 == act_data_len) {
-                    gp->set_byte_enable_length(0);
-                } else {
-                    gp->set_byte_enable_length(act_data_len);
-                }
+                gp->set_byte_enable_length(fsm_hndl->aux.i32.i1 == act_data_len ? 0 : act_data_len);
             }
             auto tp = CFG::IS_LITE || this->w_last->read() ? axi::fsm::protocol_time_point_e::BegReqE
                                                            : axi::fsm::protocol_time_point_e::BegPartReqE;
@@ -476,7 +435,7 @@ template <typename CFG> inline void axi::pin::axi4_target<CFG>::bresp_t() {
             this->b_id->write(ext->get_id());
         SCCTRACE(SCMOD) << "got write response for b_id= " << this->b_id;
         do {
-            wait(this->b_ready.posedge_event() | clk_delayed);
+            wait(this->b_ready.posedge_event() | clk_delayed.get());
             if(this->b_ready.read()) {
                 react(axi::fsm::protocol_time_point_e::EndRespE, active_resp_beat[tlm::TLM_WRITE_COMMAND]);
             }
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _BUS_AXI_PIN_BEAT_LANES_H_
+#define _BUS_AXI_PIN_BEAT_LANES_H_
+
+#include <axi/axi_tlm.h>
+#include <cstdint>
+#include <systemc>
+
+//! TLM2.0 components modeling AXI
+namespace axi {
+//! pin level adapters
+namespace pin {
+/**
+ * @struct beat_lanes
+ * @brief the active byte lanes of a beat of an AXI burst
+ *
+ * The data buffer of the payload holds the bytes of a burst in beat order beginning with the byte at the start address.
+ * Hence only the first beat of a burst with an unaligned start address carries less than the transfer size.
+ */
+struct beat_lanes {
+    //! the first active byte lane
+    unsigned first;
+    //! the byte lane following the last active one
+    unsigned end;
+    //! the index in the data buffer of the byte transferred on the first active lane
+    size_t data_idx;
+};
+/**
+ * @brief calculates the byte lanes of a beat as defined by the AXI specification for FIXED, INCR and WRAP bursts
+ *
+ * @param addr the start address of the burst
+ * @param size the number of bytes of a transfer (2^AxSIZE)
+ * @param len the burst length as signaled on the AxLEN pins
+ * @param burst the burst type
+ * @param beat the index of the beat within the burst
+ * @param bus_bytes the width of the data bus in bytes
+ */
+inline beat_lanes get_beat_lanes(uint64_t addr, unsigned size, unsigned len, axi::burst_e burst, unsigned beat, unsigned bus_bytes) {
+    uint64_t const misalign = addr & (size - 1);
+    uint64_t beat_addr = addr;
+    if(beat && burst == axi::burst_e::WRAP) {
+        uint64_t const wrap_size = uint64_t(size) * (len + 1);
+        uint64_t const lower = addr - addr % wrap_size;
+        beat_addr = lower + (addr - lower + uint64_t(beat) * size) % wrap_size;
+    } else if(beat && burst == axi::burst_e::INCR)
+        beat_addr = addr - misalign + uint64_t(beat) * size;
+    auto const first = static_cast<unsigned>(beat_addr & (bus_bytes - 1));
+    auto const end = static_cast<unsigned>((beat_addr - (beat_addr & (size - 1))) & (bus_bytes - 1)) + size;
+    return {first, end, beat ? beat * size - misalign : 0};
+}
+/**
+ * @brief returns the number of bytes of a burst, the bytes below the start address in the first beat are not counted
+ */
+inline size_t get_burst_bytes(uint64_t addr, unsigned size, unsigned len) { return size_t(size) * (len + 1) - (addr & (size - 1)); }
+/**
+ * @brief returns the delay annotated to a TLM phase in whole clock periods
+ *
+ * The channels of the pin-level BFMs synchronize to the clock, so a delay within a period does not change the cycle
+ * a phase is handled in while longer delays postpone it by the respective number of cycles.
+ */
+inline sc_core::sc_time get_cycle_delay(sc_core::sc_clock const* clk, sc_core::sc_time const& t) {
+    if(!clk)
+        return t;
+    auto const period = clk->period();
+    return period * static_cast<double>(t.value() / period.value());
+}
+} // namespace pin
+} // namespace axi
+
+#endif /* _BUS_AXI_PIN_BEAT_LANES_H_ */
@@ -16,6 +16,8 @@
 
 #include "cci_broker.h"
 #include "report.h"
+#include "startup_profiler.h"
+#include <algorithm>
 #include <string>
 #include <util/ities.h>
 namespace {}
@@ -56,23 +58,15 @@ cci_originator cci_broker::get_value_origin(const std::string& parname) const {
 }
 
 void cci_broker::insert_matching_preset_value(const std::string& parname) {
-    bool match = false;
-    for(auto const& e : wildcard_presets) {
-        if(std::regex_match(parname, e.second.rr)) {
-            consuming_broker::set_preset_cci_value(parname, e.second.value, e.second.originator);
-            match = true;
-            break;
-        }
+    if(auto* e = wildcard_presets.find(parname)) {
+        consuming_broker::set_preset_cci_value(parname, e->value, e->originator);
+        if(wildcard_locks.matches(parname))
+            consuming_broker::lock_preset_value(parname);
     }
-    if(match)
-        for(auto const& e : wildcard_locks) {
-            if(std::regex_match(parname, e.second)) {
-                consuming_broker::lock_preset_value(parname);
-            }
-        }
 }
 
 bool cci_broker::has_preset_value(const std::string& parname) const {
+    startup_profiler::tally profile("broker", "has_preset_value");
     if(sendToParent(parname)) {
         return m_parent.has_preset_value(parname);
     } else if(consuming_broker::has_preset_value(parname)) {
@@ -119,6 +113,7 @@ void cci_broker::remove_param(cci_param_if* par) {
 }
 
 cci_param_untyped_handle cci_broker::get_param_handle(const std::string& parname, const cci_originator& originator) const {
+    startup_profiler::tally profile("broker", "get_param_handle");
     if(sendToParent(parname)) {
         return m_parent.get_param_handle(parname, originator);
     }
@@ -126,6 +121,14 @@ cci_param_untyped_handle cci_broker::get_param_handle(const std::string& parname
     if(orig_param) {
         return cci_param_untyped_handle(*orig_param, originator);
     }
+    if(!creating_param && !param_factories.empty()) {
+        creating_param = true;
+        auto created = std::any_of(std::begin(param_factories), std::end(param_factories),
+                                   [&parname](decltype(param_factories)::value_type const& f) { return f.second(parname); });
+        creating_param = false;
+        if(created && (orig_param = get_orig_param(parname)))
+            return cci_param_untyped_handle(*orig_param, originator);
+    }
     if(has_parent) {
         return m_parent.get_param_handle(parname, originator);
     }
@@ -143,6 +146,16 @@ std::vector<cci_param_untyped_handle> cci_broker::get_param_handles(const cci_or
     }
 }
 
+void cci_broker::add_param_factory(void const* owner, std::function<bool(std::string const&)> factory) {
+    param_factories.emplace_back(owner, std::move(factory));
+}
+
+void cci_broker::remove_param_factory(void const* owner) {
+    param_factories.erase(std::remove_if(std::begin(param_factories), std::end(param_factories),
+                                         [owner](decltype(param_factories)::value_type const& f) { return f.first == owner; }),
+                          std::end(param_factories));
+}
+
 bool cci_broker::is_global_broker() const { return (!has_parent); }
 
 void cci_broker::set_preset_cci_value(const std::string& parname, const cci_value& value, const cci_originator& originator) {
@@ -150,12 +163,8 @@ void cci_broker::set_preset_cci_value(const std::string& parname, const cci_valu
         return m_parent.set_preset_cci_value(parname, value, originator);
     } else {
         try {
-            if(parname.find_first_of("*?[") != std::string::npos) {
-                wildcard_presets.insert(std::pair<std::string, wildcard_entry>(
-                    parname, wildcard_entry{std::regex(util::glob_to_regex(parname)), value, originator}));
-            } else if(parname[0] == '^') {
-                wildcard_presets.insert(
-                    std::pair<std::string, wildcard_entry>(parname, wildcard_entry{std::regex(parname), value, originator}));
+            if(parname.find_first_of("*?[") != std::string::npos || parname[0] == '^') {
+                wildcard_presets.insert(parname, wildcard_entry{value, originator});
             } else
                 consuming_broker::set_preset_cci_value(parname, value, originator);
         } catch(std::regex_error& e) {
@@ -169,10 +178,8 @@ void cci_broker::lock_preset_value(const std::string& parname) {
         m_parent.lock_preset_value(parname);
     } else {
         try {
-            if(parname.find_first_of("*?[") != std::string::npos) {
-                wildcard_locks.insert(std::pair<std::string, std::regex>(parname, std::regex(util::glob_to_regex(parname))));
-            } else if(parname[0] == '^') {
-                wildcard_locks.insert(std::pair<std::string, std::regex>(parname, std::regex(parname)));
+            if(parname.find_first_of("*?[") != std::string::npos || parname[0] == '^') {
+                wildcard_locks.insert(parname, true);
             } else
                 consuming_broker::lock_preset_value(parname);
         } catch(std::regex_error& e) {
@@ -21,10 +21,11 @@
 #if CCI_VERSION_MAJOR == 1 && CCI_VERSION_MINOR == 0 && CCI_VERSION_PATCH == 0
 #include <cci_utils/consuming_broker.h>
 #endif
-#include <regex>
+#include <functional>
 #include <string>
-#include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <util/glob_index.h>
 #include <vector>
 
 namespace scc {
@@ -50,14 +51,40 @@ class cci_broker : public cci_utils::consuming_broker {
     void insert_matching_preset_value(const std::string& parname);
 
     struct wildcard_entry {
-        std::regex rr;
         cci::cci_value value;
         cci::cci_originator originator;
     };
-    std::unordered_map<std::string, wildcard_entry> wildcard_presets;
-    std::unordered_map<std::string, std::regex> wildcard_locks;
+    util::glob_index<wildcard_entry> wildcard_presets;
+    util::glob_index<bool> wildcard_locks;
+
+    std::vector<std::pair<void const*, std::function<bool(std::string const&)>>> param_factories;
+    mutable bool creating_param{false};
 
 public:
+    /**
+     * @brief returns the scc::cci_broker behind a broker handle
+     *
+     * @param handle the broker handle
+     * @return the broker or nullptr if the handle refers to a different broker implementation
+     */
+    static cci_broker* get(cci::cci_broker_handle handle) { return dynamic_cast<cci_broker*>(&unwrap_broker(handle)); }
+    /**
+     * @brief registers a factory creating parameters on demand
+     *
+     * If get_param_handle() does not find a parameter the factories are called with its name. A factory returns true if
+     * it created the parameter. Parameters not yet created this way are not part of the result of get_param_handles().
+     *
+     * @param owner the owner of the factory used to remove it
+     * @param factory the function creating the parameter
+     */
+    void add_param_factory(void const* owner, std::function<bool(std::string const&)> factory);
+    /**
+     * @brief removes the parameter factories of an owner
+     *
+     * @param owner the owner of the factories
+     */
+    void remove_param_factory(void const* owner);
+
     cci::cci_originator get_value_origin(const std::string& parname) const override;
 
     cci_broker(const std::string& name);
@@ -77,6 +104,7 @@ public:
      * The globbing supports ?,*,**, and character classes ([a-z] as well as [!a-z]). '.' acts as
      * hierarchy delimiter and is only matched with **
      * Regular expression must start with a carret ('^') so that it can be identified as regex.
+     * If several expressions match a parameter name the one being set first is applied.
      *
      * The preset value has priority to the default value being set by the owner!
      *
@@ -15,8 +15,11 @@
  *******************************************************************************/
 
 #include "configurable_tracer.h"
+#include "cci_broker.h"
+#include "startup_profiler.h"
 #include "traceable.h"
 #include <cstdio>
+#include <cstring>
 #include <fmt/format.h>
 using namespace sc_core;
 using namespace scc;
@@ -24,18 +27,28 @@ using namespace scc;
 #define EN_TRACING_STR "enableTracing"
 
 configurable_tracer::configurable_tracer(std::string const&& name, bool enable_tx, bool enable_vcd, sc_core::sc_object* top)
-: tracer(std::move(name), enable_tx ? ENABLE : NONE, enable_vcd ? ENABLE : NONE, top) {}
+: tracer(std::move(name), enable_tx ? ENABLE : NONE, enable_vcd ? ENABLE : NONE, top) {
+    add_param_factory();
+}
 
 configurable_tracer::configurable_tracer(std::string const&& name, file_type type, bool enable_vcd, sc_core::sc_object* top)
-: tracer(std::move(name), type, enable_vcd ? ENABLE : NONE, top) {}
+: tracer(std::move(name), type, enable_vcd ? ENABLE : NONE, top) {
+    add_param_factory();
+}
 
 configurable_tracer::configurable_tracer(std::string const&& name, file_type tx_type, file_type sig_type, sc_core::sc_object* top)
-: tracer(std::move(name), tx_type, sig_type, top) {}
+: tracer(std::move(name), tx_type, sig_type, top) {
+    add_param_factory();
+}
 
 configurable_tracer::configurable_tracer(std::string const&& name, file_type type, sc_core::sc_trace_file* tf, sc_core::sc_object* top)
-: tracer(std::move(name), type, tf, top) {}
+: tracer(std::move(name), type, tf, top) {
+    add_param_factory();
+}
 
 scc::configurable_tracer::~configurable_tracer() {
+    if(auto* broker = scc::cci_broker::get(cci_broker))
+        broker->remove_param_factory(this);
     for(auto ptr : params)
         delete ptr;
 }
@@ -90,10 +103,43 @@ auto scc::configurable_tracer::get_trace_enabled(const sc_core::sc_object* obj,
         auto h = cci_broker.get_param_handle(hier_name.append("." EN_TRACING_STR));
         if(h.is_valid())
             return h.get_cci_value().get_bool();
+        // objects without a materialized param use the value add_control() would have created it with
+        if(control_added && strncmp(obj->name(), "$$$", 3) != 0)
+            return control_default;
     }
     return fall_back;
 }
 
+cci::cci_param_handle configurable_tracer::get_trace_enable_handle(const sc_core::sc_object* obj) {
+    auto hier_name = fmt::format("{}." EN_TRACING_STR, obj->name());
+    auto h = cci_broker.get_param_handle(hier_name);
+    if(!h.is_valid()) {
+        auto enabled = get_trace_enabled(obj, default_trace_enable_handle.get_cci_value().get<bool>());
+        params.push_back(new cci::cci_param<bool>(hier_name, enabled, cci_broker, "Enables the signal tracing of this module",
+                                                  cci::CCI_ABSOLUTE_NAME, cci_broker.get_originator()));
+        h = cci_broker.get_param_handle(hier_name);
+    }
+    return h;
+}
+
+void configurable_tracer::add_param_factory() {
+    if(auto* broker = scc::cci_broker::get(cci_broker))
+        broker->add_param_factory(this, [this](std::string const& parname) -> bool {
+            static const std::string suffix{"." EN_TRACING_STR};
+            if(parname.size() <= suffix.size() || parname.compare(parname.size() - suffix.size(), suffix.size(), suffix) != 0 ||
+               parname.compare(0, 3, "$$$") == 0)
+                return false;
+            auto* obj = sc_core::sc_find_object(parname.substr(0, parname.size() - suffix.size()).c_str());
+            if(obj == nullptr || (dynamic_cast<sc_core::sc_module*>(obj) == nullptr && dynamic_cast<scc::traceable*>(obj) == nullptr))
+                return false;
+            // objects controlled by an sc_attribute do not get a param
+            if(dynamic_cast<const sc_core::sc_attribute<bool>*>(obj->get_attribute(EN_TRACING_STR)) != nullptr)
+                return false;
+            get_trace_enable_handle(obj);
+            return true;
+        });
+}
+
 void configurable_tracer::augment_object_hierarchical(sc_core::sc_object* obj, bool trace_enable) {
     if(dynamic_cast<sc_core::sc_module*>(obj) != nullptr || dynamic_cast<scc::traceable*>(obj) != nullptr) {
         auto* attr = obj->get_attribute(EN_TRACING_STR);
@@ -102,12 +148,12 @@ void configurable_tracer::augment_object_hierarchical(sc_core::sc_object* obj, b
             if(hier_name.substr(0, 3) != "$$$") {
                 hier_name += "." EN_TRACING_STR;
                 auto h = cci_broker.get_param_handle(hier_name);
-                if(!h.is_valid()) // we have no cci_param so create one
+                if(h.is_valid())
+                    h.set_cci_value(cci::cci_value{default_trace_enable_handle.get_cci_value().get<bool>()});
+                else if(cci_broker.has_preset_value(hier_name)) // only create a cci_param if there is a value for it
                     params.push_back(new cci::cci_param<bool>(hier_name, trace_enable, cci_broker,
                                                               "Enables the signal tracing of this module", cci::CCI_ABSOLUTE_NAME,
                                                               cci_broker.get_originator()));
-                else
-                    h.set_cci_value(cci::cci_value{default_trace_enable_handle.get_cci_value().get<bool>()});
             }
         } else if(auto battr = dynamic_cast<sc_core::sc_attribute<bool>*>(attr)) {
             battr->value = default_trace_enable_handle.get_cci_value().get<bool>();
@@ -118,6 +164,9 @@ void configurable_tracer::augment_object_hierarchical(sc_core::sc_object* obj, b
 }
 
 void configurable_tracer::end_of_elaboration() {
-    add_control();
+    if(trf) { // the controls are only evaluated when tracing signals
+        startup_profiler::scope profile("tracer", "add_control");
+        add_control();
+    }
     tracer::end_of_elaboration();
 }
@@ -30,7 +30,10 @@ namespace scc {
  *
  * This class traverses the SystemC object hierarchy and registers all signals and ports found with the tracing
  * infrastructure. Using a sc_core::sc_attribute or a CCI param named "enableTracing" this can be switch on or off
- * on a per module basis
+ * on a per module basis. The CCI params are only created for modules having a preset value (e.g. from a configuration
+ * file) or when being requested to keep the broker small for large designs. A param is requested either using
+ * get_trace_enable_handle() or by looking it up by name at the scc::cci_broker. Hence the params not being created yet
+ * are not listed by cci::cci_broker_handle::get_param_handles().
  */
 class configurable_tracer : public tracer {
 public:
@@ -118,23 +121,36 @@ public:
     void add_control(bool trace_default) {
         if(control_added)
             return;
+        control_default = trace_default;
         for(auto* o : sc_core::sc_get_top_level_objects())
             augment_object_hierarchical(o, trace_default);
         control_added = true;
     }
+    /**
+     * returns the handle of the 'enableTracing' CCI param of an object. Since add_control() only creates the params
+     * for objects having a preset value, the param is created on demand if it does not exist yet.
+     *
+     * @param obj the sc_module or traceable object
+     * @return the handle of the param
+     */
+    cci::cci_param_handle get_trace_enable_handle(const sc_core::sc_object* obj);
 
 protected:
     //! depth-first walk thru the design hierarchy and trace signals resp. call trace() function
     void descend(const sc_core::sc_object*, bool trace_all = false) override;
     //! check for existence of 'enableTracing' attribute and return value of default otherwise
     bool get_trace_enabled(const sc_core::sc_object*, bool = false);
-    //! add the 'enableTracing' attribute to sc_module
+    //! set the 'enableTracing' attributes of the sc_modules and create the CCI params having a preset value
     void augment_object_hierarchical(sc_core::sc_object*, bool);
+    //! register the creation of the 'enableTracing' params on lookup at the scc::cci_broker
+    void add_param_factory();
 
     void end_of_elaboration() override;
     //! array of created cci parameter
     std::vector<cci::cci_param_untyped*> params;
     bool control_added{false};
+    //! the trace enable of all objects without an sc_attribute or a CCI param after add_control()
+    bool control_default{false};
 };
 
 } /* namespace scc */
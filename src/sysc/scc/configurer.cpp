@@ -18,17 +18,25 @@
 #include "rapidjson/document.h"
 #include "rapidjson/error/en.h"
 #include "report.h"
+#include "startup_profiler.h"
+#include <algorithm>
+#include <atomic>
 #include <cci_configuration>
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <fmt/format.h>
 #include <fstream>
+#include <future>
 #include <limits>
 #include <rapidjson/istreamwrapper.h>
+#include <rapidjson/memorystream.h>
 #include <rapidjson/ostreamwrapper.h>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/reader.h>
+#include <thread>
 #include <unordered_map>
+#include <util/mmap_region.h>
 #ifdef HAS_YAMPCPP
 #include <yaml-cpp/exceptions.h>
 #include <yaml-cpp/node/parse.h>
@@ -94,6 +102,22 @@ inline auto get_sc_objects(sc_core::sc_object* obj = nullptr) -> const std::vect
 
 struct config_reader {
     std::vector<std::string> includes{"."};
+    //! the configurer phases already reached, values of sections for these phases are applied immediately
+    unsigned reached_phases{0};
+    /**
+     * returns the phase a configuration section key refers to, values of such a section are applied when the
+     * configurer reaches the phase
+     */
+    static unsigned phase_of(std::string const& key) {
+        if(key == "!before_end_of_elaboration")
+            return configurer::BEFORE_END_OF_ELABORATION;
+        if(key == "!end_of_elaboration")
+            return configurer::END_OF_ELABORATION;
+        if(key == "!start_of_simulation")
+            return configurer::START_OF_SIMULATION;
+        return 0;
+    }
+
     void add_to_includes(std::string const& path) {
         for(auto& e : includes) {
             if(e == path)
@@ -114,6 +138,25 @@ struct config_reader {
             }
         return file_name;
     }
+    /**
+     * parses an include file in a background thread as long as less than the available hardware threads are busy
+     * parsing includes, otherwise the include is parsed when its result is requested
+     */
+    template <typename RESULT, typename FUNC> std::future<RESULT> launch_include(FUNC&& func) {
+        if(active_includes.fetch_add(1) < max_include_threads)
+            return std::async(std::launch::async, [this, func]() {
+                struct guard {
+                    std::atomic<unsigned>& cnt;
+                    ~guard() { cnt--; }
+                } g{active_includes};
+                return func();
+            });
+        active_includes--;
+        return std::async(std::launch::deferred, std::forward<FUNC>(func));
+    }
+    //! the number of include files currently parsed in background threads
+    std::atomic<unsigned> active_includes{0};
+    unsigned const max_include_threads{std::max(1U, std::thread::hardware_concurrency())};
 };
 /*************************************************************************************************
  * JSON config start
@@ -211,98 +254,278 @@ struct json_config_dumper {
     }
 };
 
+struct json_value {
+    enum { BOOL, INT, INT64, UINT64, DOUBLE, STRING } type;
+    union {
+        bool b;
+        int i;
+        int64_t i64;
+        uint64_t u64;
+        double d;
+    };
+    std::string str;
+
+    cci::cci_value get() const {
+        switch(type) {
+        case BOOL:
+            return cci::cci_value(b);
+        case INT:
+            return cci::cci_value(i);
+        case INT64:
+            return cci::cci_value(i64);
+        case UINT64:
+            return cci::cci_value(u64);
+        case DOUBLE:
+            return cci::cci_value(d);
+        default:
+            return cci::cci_value(str);
+        }
+    }
+};
+
+struct json_include;
+/**
+ * a value read from a JSON file or an include being parsed in the background. The values are kept as plain data
+ * since cci::cci_value instances must not be created outside of the SystemC thread.
+ */
+struct json_entry {
+    std::string name;
+    json_value value;
+    unsigned phase;
+    std::shared_ptr<json_include> include;
+};
+
+struct json_include {
+    std::future<std::vector<json_entry>> entries;
+};
+
 struct json_config_reader : public config_reader {
     configurer::broker_t& broker;
-    Document document;
-    bool valid{false};
-    bool empty{false};
+    std::unordered_map<unsigned, std::vector<std::pair<std::string, json_value>>> phase_values;
 
     json_config_reader(configurer::broker_t& broker)
     : broker(broker) {}
+    /**
+     * SAX handler flattening the object hierarchy into hierarchical names. Arrays and null values are ignored.
+     * Include files are parsed in parallel, the values of the main file are applied directly to the broker as long as
+     * no include is pending.
+     */
+    struct handler : public BaseReaderHandler<UTF8<>, handler> {
+        json_config_reader& reader;
+        bool direct;
+        std::vector<json_entry> entries;
+        std::vector<std::string> prefixes;
+        std::vector<unsigned> phases;
+        std::string key;
+        unsigned skip_depth{0};
 
-    void parse(std::istream& is) {
-        IStreamWrapper stream(is);
-        document.ParseStream(stream);
-        valid = !document.HasParseError();
-        empty = document.IsNull();
+        handler(json_config_reader& reader, bool direct)
+        : reader(reader)
+        , direct(direct) {}
+
+        bool StartObject() {
+            if(skip_depth)
+                ++skip_depth;
+            else if(prefixes.empty()) {
+                prefixes.emplace_back();
+                phases.push_back(0);
+            } else if(auto phase = phase_of(key)) {
+                prefixes.push_back(prefixes.back());
+                phases.push_back(std::max(phase, phases.back()));
+            } else {
+                prefixes.push_back(hier_name());
+                phases.push_back(phases.back());
+            }
+            return true;
+        }
+        bool EndObject(SizeType) {
+            if(skip_depth)
+                --skip_depth;
+            else {
+                prefixes.pop_back();
+                phases.pop_back();
+            }
+            return true;
+        }
+        bool StartArray() {
+            ++skip_depth;
+            return true;
+        }
+        bool EndArray(SizeType) {
+            --skip_depth;
+            return true;
+        }
+        bool Key(const char* str, SizeType len, bool) {
+            key.assign(str, len);
+            return true;
+        }
+        bool Null() { return true; }
+        bool Bool(bool b) {
+            json_value v{json_value::BOOL};
+            v.b = b;
+            return add(std::move(v));
+        }
+        bool Int(int i) {
+            json_value v{json_value::INT};
+            v.i = i;
+            return add(std::move(v));
+        }
+        // non-negative numbers are stored using the smallest signed type holding them like the DOM did before
+        bool Uint(unsigned u) {
+            if(u <= static_cast<unsigned>(std::numeric_limits<int>::max()))
+                return Int(static_cast<int>(u));
+            return Int64(u);
+        }
+        bool Int64(int64_t i) {
+            json_value v{json_value::INT64};
+            v.i64 = i;
+            return add(std::move(v));
+        }
+        bool Uint64(uint64_t u) {
+            if(u <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+                return Int64(static_cast<int64_t>(u));
+            json_value v{json_value::UINT64};
+            v.u64 = u;
+            return add(std::move(v));
+        }
+        bool Double(double d) {
+            json_value v{json_value::DOUBLE};
+            v.d = d;
+            return add(std::move(v));
+        }
+        bool String(const char* str, SizeType len, bool) {
+            if(skip_depth || prefixes.empty())
+                return true;
+            if(key == "!include") {
+                auto file_name = std::string(str, len);
+                auto path = reader.find_in_include_path(file_name);
+                auto& r = reader;
+                std::shared_ptr<json_include> incl(new json_include);
+                incl->entries =
+                    r.launch_include<std::vector<json_entry>>([&r, path, file_name]() { return r.parse_include(path, file_name); });
+                entries.push_back(json_entry{prefixes.back(), json_value{json_value::STRING}, phases.back(), incl});
+                direct = false;
+                return true;
+            }
+            json_value v{json_value::STRING};
+            v.str.assign(str, len);
+            return add(std::move(v));
+        }
+
+    private:
+        std::string hier_name() const { return prefixes.back().size() ? prefixes.back() + "." + key : key; }
+
+        bool add(json_value&& v) {
+            if(skip_depth || prefixes.empty())
+                return true;
+            if(direct && !phases.back())
+                reader.apply(hier_name(), v);
+            else
+                entries.push_back(json_entry{hier_name(), std::move(v), phases.back(), nullptr});
+            return true;
+        }
+    };
+    /**
+     * parses a JSON document, returns an empty string on success or the error message
+     */
+    template <typename STREAM> std::string parse(STREAM& stream, handler& h) {
+        Reader reader;
+        auto res = reader.Parse<kParseCommentsFlag | kParseTrailingCommasFlag>(stream, h);
+        if(res.IsError() && res.Code() != kParseErrorDocumentEmpty) {
+            std::ostringstream os;
+            os << "location " << (unsigned)res.Offset() << ", reason: " << GetParseError_En(res.Code());
+            return os.str();
+        }
+        return "";
     }
-    std::string get_error_msg() {
-        std::ostringstream os;
-        os << " location " << (unsigned)document.GetErrorOffset() << ", reason: " << GetParseError_En(document.GetParseError());
-        return os.str();
+    /**
+     * parses a JSON file, memory mapped if possible
+     *
+     * @return false if the file cannot be opened
+     * @throw std::runtime_error if the file or one of its includes cannot be parsed
+     */
+    bool parse_file(std::string const& path, handler& h) {
+        std::string error;
+        try {
+            util::mmap_region file(path, false, 0, 0, true);
+            MemoryStream stream(reinterpret_cast<char const*>(file.data()), file.size());
+            error = parse(stream, h);
+        } catch(std::runtime_error&) { // e.g. empty files or platforms without file mappings
+            std::ifstream ifs(path);
+            if(!ifs.is_open())
+                return false;
+            IStreamWrapper stream(ifs);
+            error = parse(stream, h);
+        }
+        if(error.size())
+            throw std::runtime_error(error);
+        return true;
     }
 
-    inline void configure_cci() { configure_cci_hierarchical(document, ""); }
+    std::vector<json_entry> parse_include(std::string const& path, std::string const& file_name) {
+        handler h(*this, false);
+        bool opened;
+        try {
+            opened = parse_file(path, h);
+        } catch(std::runtime_error& e) {
+            throw std::runtime_error("Could not parse include file " + file_name + ", " + e.what());
+        }
+        if(!opened)
+            throw std::runtime_error("Could not open include file " + file_name);
+        return std::move(h.entries);
+    }
+    /**
+     * reads a JSON file and applies its values
+     *
+     * @return false if the file cannot be opened
+     */
+    bool read_file(std::string const& path) {
+        handler h(*this, true);
+        if(!parse_file(path, h))
+            return false;
+        apply(h.entries, "", 0);
+        return true;
+    }
 
-    void configure_cci_hierarchical(Value const& value, std::string prefix) {
-        if(value.IsObject()) {
-            auto o = value.GetObject();
-            for(auto itr = o.MemberBegin(); itr != o.MemberEnd(); ++itr) {
-                if(!itr->name.IsString())
-                    return;
-                std::string key_name = itr->name.GetString();
-                Value const& val = itr->value;
-                auto hier_name = prefix.size() ? prefix + "." + key_name : key_name;
-                if(val.IsNull() || val.IsArray())
-                    return;
-                else if(val.IsObject())
-                    configure_cci_hierarchical(val, hier_name);
-                else {
-                    if(key_name == "!include") {
-                        json_config_reader sub_reader(broker);
-                        std::ifstream ifs(find_in_include_path(val.GetString()));
-                        if(ifs.is_open()) {
-                            sub_reader.parse(ifs);
-                            if(sub_reader.valid) {
-                                sub_reader.configure_cci_hierarchical(sub_reader.document, prefix);
-                            } else {
-                                std::ostringstream os;
-                                os << "Could not parse include file " << val.GetString();
-                                throw std::runtime_error(os.str());
-                            }
-                        } else {
-                            std::ostringstream os;
-                            os << "Could not open include file " << val.GetString();
-                            throw std::runtime_error(os.str());
-                        }
-                    } else {
-                        auto param_handle = broker.get_param_handle(hier_name);
-                        if(param_handle.is_valid()) {
-                            if(val.IsString()) {
-                                param_handle.set_cci_value(cci::cci_value(std::string(val.GetString())));
-                            } else if(val.IsBool()) {
-                                param_handle.set_cci_value(cci::cci_value(val.Get<bool>()));
-                            } else if(val.IsInt()) {
-                                param_handle.set_cci_value(cci::cci_value(val.Get<int>()));
-                            } else if(val.IsInt64()) {
-                                param_handle.set_cci_value(cci::cci_value(val.Get<int64_t>()));
-                            } else if(val.IsUint()) {
-                                param_handle.set_cci_value(cci::cci_value(val.Get<unsigned>()));
-                            } else if(val.IsUint64()) {
-                                param_handle.set_cci_value(cci::cci_value(val.Get<uint64_t>()));
-                            } else if(val.IsDouble()) {
-                                param_handle.set_cci_value(cci::cci_value(val.Get<double>()));
-                            }
-                        } else {
-                            if(val.IsString()) {
-                                broker.set_preset_cci_value(hier_name, cci::cci_value(std::string(val.GetString())));
-                            } else if(val.IsBool()) {
-                                broker.set_preset_cci_value(hier_name, cci::cci_value(val.Get<bool>()));
-                            } else if(val.IsInt()) {
-                                broker.set_preset_cci_value(hier_name, cci::cci_value(val.Get<int>()));
-                            } else if(val.IsInt64()) {
-                                broker.set_preset_cci_value(hier_name, cci::cci_value(val.Get<int64_t>()));
-                            } else if(val.IsUint()) {
-                                broker.set_preset_cci_value(hier_name, cci::cci_value(val.Get<unsigned>()));
-                            } else if(val.IsUint64()) {
-                                broker.set_preset_cci_value(hier_name, cci::cci_value(val.Get<uint64_t>()));
-                            } else if(val.IsDouble()) {
-                                broker.set_preset_cci_value(hier_name, cci::cci_value(val.Get<double>()));
-                            }
-                        }
-                    }
-                }
+    void read(std::istream& is) {
+        handler h(*this, true);
+        IStreamWrapper stream(is);
+        auto error = parse(stream, h);
+        if(error.size())
+            throw std::runtime_error(error);
+        apply(h.entries, "", 0);
+    }
+
+    void apply(std::vector<json_entry>& entries, std::string const& prefix, unsigned phase) {
+        for(auto& e : entries) {
+            auto name = prefix.empty() ? e.name : e.name.empty() ? prefix : prefix + "." + e.name;
+            auto entry_phase = std::max(phase, e.phase);
+            if(e.include) {
+                auto included = e.include->entries.get();
+                apply(included, name, entry_phase);
             }
+            else if(entry_phase && !(entry_phase & reached_phases))
+                phase_values[entry_phase].emplace_back(name, std::move(e.value));
+            else
+                apply(name, e.value);
+        }
+    }
+
+    void apply(std::string const& hier_name, json_value const& val) {
+        auto param_handle = broker.get_param_handle(hier_name);
+        if(param_handle.is_valid())
+            param_handle.set_cci_value(val.get());
+        else
+            broker.set_preset_cci_value(hier_name, val.get());
+    }
+
+    void configure_phase(unsigned phase) {
+        reached_phases |= phase;
+        auto it = phase_values.find(phase);
+        if(it != phase_values.end()) {
+            for(auto& e : it->second)
+                apply(e.first, e.second);
+            phase_values.erase(it);
         }
     }
 };
@@ -412,6 +635,8 @@ struct yaml_config_reader : public config_reader {
     YAML::Node document;
     bool valid{false};
     bool empty{true};
+    std::unordered_map<std::string, std::shared_future<YAML::Node>> prefetched;
+    std::unordered_map<unsigned, std::vector<std::pair<YAML::Node, std::string>>> phase_nodes;
 
     yaml_config_reader(configurer::broker_t& broker)
     : broker(broker) {}
@@ -427,7 +652,9 @@ struct yaml_config_reader : public config_reader {
 
     inline void configure_cci() {
         try {
+            prefetch_includes(document);
             configure_cci_hierarchical(document, "");
+            prefetched.clear();
         } catch(YAML::ParserException& e) {
             throw std::runtime_error(e.what());
         } catch(YAML::BadFile& e) {
@@ -445,27 +672,27 @@ struct yaml_config_reader : public config_reader {
                 auto hier_name = prefix.size() ? prefix + "." + key_name : key_name;
                 if(!val.IsDefined() || val.IsSequence())
                     return;
-                else if(val.IsMap())
-                    configure_cci_hierarchical(val, hier_name);
-                else if(val.IsScalar()) {
+                else if(val.IsMap()) {
+                    auto phase = phase_of(key_name);
+                    if(!phase)
+                        configure_cci_hierarchical(val, hier_name);
+                    else if(phase & reached_phases)
+                        configure_cci_hierarchical(val, prefix);
+                    else
+                        phase_nodes[phase].emplace_back(val, prefix);
+                } else if(val.IsScalar()) {
                     auto& tag = val.Tag();
                     if(tag == "!include") {
-                        yaml_config_reader sub_reader(broker);
-                        std::ifstream ifs(find_in_include_path(val.as<std::string>()));
-                        if(ifs.is_open()) {
-                            sub_reader.parse(ifs);
-                            if(sub_reader.valid) {
-                                sub_reader.configure_cci_hierarchical(sub_reader.document, hier_name);
-                            } else {
-                                std::ostringstream os;
-                                os << "Could not parse include file " << val.as<std::string>();
-                                throw std::runtime_error(os.str());
-                            }
-                        } else {
+                        auto file_name = val.as<std::string>();
+                        auto it = prefetched.find(file_name);
+                        auto include = it != prefetched.end() ? it->second.get() : load(find_in_include_path(file_name), file_name);
+                        if(!include.IsDefined() || !(include.IsMap() || include.IsNull())) {
                             std::ostringstream os;
-                            os << "Could not open include file " << val.as<std::string>();
+                            os << "Could not parse include file " << file_name;
                             throw std::runtime_error(os.str());
                         }
+                        prefetch_includes(include);
+                        configure_cci_hierarchical(include, hier_name);
                     } else if(tag.size() && tag[0] == '?') {
                         auto param_handle = broker.get_param_handle(hier_name);
                         if(param_handle.is_valid()) {
@@ -519,6 +746,44 @@ struct yaml_config_reader : public config_reader {
             }
         }
     }
+
+    static YAML::Node load(std::string const& path, std::string const& file_name) {
+        std::ifstream ifs(path);
+        if(!ifs.is_open()) {
+            std::ostringstream os;
+            os << "Could not open include file " << file_name;
+            throw std::runtime_error(os.str());
+        }
+        return YAML::Load(ifs);
+    }
+    //! starts loading the include files referenced in a document in parallel
+    void prefetch_includes(YAML::Node const& value) {
+        if(!value.IsMap())
+            return;
+        for(auto it = value.begin(); it != value.end(); ++it) {
+            YAML::Node const& val = it->second;
+            if(val.IsMap())
+                prefetch_includes(val);
+            else if(val.IsScalar() && val.Tag() == "!include") {
+                auto file_name = val.as<std::string>();
+                if(!prefetched.count(file_name)) {
+                    auto path = find_in_include_path(file_name);
+                    prefetched[file_name] = launch_include<YAML::Node>([path, file_name]() { return load(path, file_name); });
+                }
+            }
+        }
+    }
+
+    void configure_phase(unsigned phase) {
+        reached_phases |= phase;
+        auto it = phase_nodes.find(phase);
+        if(it != phase_nodes.end()) {
+            auto nodes = std::move(it->second);
+            phase_nodes.erase(it);
+            for(auto& e : nodes)
+                configure_cci_hierarchical(e.first, e.second);
+        }
+    }
 };
 /*************************************************************************************************
  * YAML config end
@@ -657,17 +922,33 @@ bool cci_name_ignore(std::pair<std::string, cci::cci_value> const& preset_value)
     return sc_core::sc_find_object(name.c_str()) != nullptr;
 }
 } // namespace
+struct configurer::ConfigHolder {
+    json_config_reader json;
 #ifdef HAS_YAMPCPP
-struct configurer::ConfigHolder : public yaml_config_reader {
-    ConfigHolder(configurer::broker_t& broker)
-    : yaml_config_reader(broker) {}
-};
-#else
-struct configurer::ConfigHolder : public json_config_reader {
+    yaml_config_reader yaml;
+#endif
     ConfigHolder(configurer::broker_t& broker)
-    : json_config_reader(broker) {}
-};
+    : json(broker)
+#ifdef HAS_YAMPCPP
+    , yaml(broker)
+#endif
+    {
+    }
+
+    void add_to_includes(std::string const& path) {
+        json.add_to_includes(path);
+#ifdef HAS_YAMPCPP
+        yaml.add_to_includes(path);
+#endif
+    }
+
+    void configure_phase(unsigned phase) {
+        json.configure_phase(phase);
+#ifdef HAS_YAMPCPP
+        yaml.configure_phase(phase);
 #endif
+    }
+};
 
 configurer::configurer(const std::string& filename, unsigned config_phases)
 : configurer(filename, config_phases, "$$$configurer$$$") {}
@@ -678,28 +959,66 @@ configurer::configurer(const std::string& filename, unsigned config_phases, sc_c
 , cci_broker(cci::cci_get_broker())
 , cci_originator(cci_broker.get_originator())
 , root(new ConfigHolder(cci_broker)) {
+    for(auto& hndl : cci_broker.get_param_handles())
+        param_index.insert(hndl.name(), hndl);
+    // the handles passed to the callbacks carry the originator of the broker handle
+    param_create_cb =
+        cci_broker.register_create_callback([this](cci::cci_param_untyped_handle const& hndl) { param_index.insert(hndl.name(), hndl); });
+    param_destroy_cb =
+        cci_broker.register_destroy_callback([this](cci::cci_param_untyped_handle const& hndl) { param_index.erase(hndl.name()); });
     if(filename.length() > 0)
         read_input_file(filename);
 }
 
-configurer::~configurer() {}
+configurer::~configurer() {
+    cci_broker.unregister_create_callback(param_create_cb);
+    cci_broker.unregister_destroy_callback(param_destroy_cb);
+}
 
 void configurer::read_input_file(const std::string& filename) {
+    startup_profiler::scope profile("config", filename);
     root->add_to_includes(util::dir_name(filename));
-    std::ifstream is(filename);
-    if(is.is_open()) {
-        try {
-            root->parse(is);
-            if(!root->valid) {
-                SCCERR() << "Could not parse input file " << filename << ", " << root->get_error_msg();
-            } else if(!root->empty) {
-                root->configure_cci();
-            }
-        } catch(std::runtime_error& e) {
-            SCCERR() << "Could not parse input file " << filename << ", reason: " << e.what();
+#ifdef HAS_YAMPCPP
+    if(!util::ends_with(filename, ".json")) {
+        std::ifstream is(filename);
+        if(is.is_open()) {
+            read_input(is, filename);
+        } else {
+            SCCWARN() << "Could not open input file " << filename;
         }
-    } else {
-        SCCWARN() << "Could not open input file " << filename;
+        return;
+    }
+#endif
+    try {
+        if(!root->json.read_file(filename))
+            SCCWARN() << "Could not open input file " << filename;
+    } catch(std::runtime_error& e) {
+        SCCERR() << "Could not parse input file " << filename << ", " << e.what();
+    }
+}
+
+void configurer::read_input(std::istream& is, std::string const& source_name) {
+    try {
+#ifdef HAS_YAMPCPP
+        root->yaml.parse(is);
+        if(!root->yaml.valid) {
+            SCCERR() << "Could not parse input file " << source_name << ", " << root->yaml.get_error_msg();
+        } else if(!root->yaml.empty) {
+            root->yaml.configure_cci();
+        }
+#else
+        root->json.read(is);
+#endif
+    } catch(std::runtime_error& e) {
+        SCCERR() << "Could not parse input file " << source_name << ", " << e.what();
+    }
+}
+
+void configurer::configure_phase(unsigned phase) {
+    try {
+        root->configure_phase(phase);
+    } catch(std::runtime_error& e) {
+        SCCERR() << "Could not apply the configuration, reason: " << e.what();
     }
 }
 
@@ -728,29 +1047,26 @@ void configurer::dump_configuration(std::ostream& os, bool as_yaml, bool with_de
     writer.EndObject();
 }
 
-void configurer::configure() { mirror_sc_attributes(cci_broker, cci2sc_attr, cci_originator); }
+void configurer::configure() {
+    startup_profiler::scope profile("config", "mirror_sc_attributes");
+    mirror_sc_attributes(cci_broker, cci2sc_attr, cci_originator);
+}
 
 void configurer::set_configuration_value(sc_core::sc_attr_base* attr_base, sc_core::sc_object* owner) {
     std::string hier_name = fmt::format("{}.{}", owner->name(), attr_base->name());
     mirror_sc_attribute(cci_broker, cci2sc_attr, cci_originator, hier_name, attr_base);
 }
 
-inline std::string hier_name_as_regex(std::string const& parname) {
-    if(parname.find_first_of("*?[") != std::string::npos) {
-        return util::glob_to_regex(parname);
-    } else if(parname[0] == '^') {
-        return parname;
-    } else
-        return "";
-}
-
 void configurer::set_value(const std::string& hier_name, cci::cci_value value) {
-    auto regex_str = hier_name_as_regex(hier_name);
-    if(regex_str.length()) {
-        auto rr = std::regex(regex_str);
-        cci::cci_param_predicate pred = [rr](cci::cci_param_untyped_handle const& hndl) { return regex_match(hndl.name(), rr); };
-        for(auto& hndl : cci_broker.get_param_handles(pred)) {
-            hndl.set_cci_value(value);
+    if(hier_name.find_first_of("*?[") != std::string::npos || hier_name[0] == '^') {
+        try {
+            param_index.for_each_match(hier_name, [&value](std::string const&, cci::cci_param_untyped_handle hndl) {
+                if(hndl.is_valid())
+                    hndl.set_cci_value(value);
+            });
+        } catch(std::regex_error& e) {
+            SCCERR() << "Invalid parameter name '" << hier_name << "', " << e.what();
+            return;
         }
     } else {
         cci::cci_param_handle param_handle = cci_broker.get_param_handle(hier_name);
@@ -874,6 +1190,7 @@ void configurer::config_check() {
 }
 
 void configurer::start_of_simulation() {
+    configure_phase(START_OF_SIMULATION);
     if(config_phases & START_OF_SIMULATION)
         configure();
     config_check();
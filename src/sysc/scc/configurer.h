@@ -21,6 +21,7 @@
 #include "utilities.h"
 #include <cci_configuration>
 #include <regex>
+#include <util/glob_index.h>
 
 /** \ingroup scc-sysc
  *  @{
@@ -37,6 +38,11 @@ bool init_cci(std::string name = "Global Broker");
  * A class to configure a design hierarchy using a JSON input file. It reads a file and
  * and stores its values into a CCI broker. It can apply the value also to sc_attribute
  * once the design is installed.
+ *
+ * JSON files (and all files if yaml-cpp is not available) are parsed in a streaming fashion directly into the broker,
+ * memory mapped where possible. Files referenced by !include are parsed in parallel. Values of the sections
+ * "!before_end_of_elaboration", "!end_of_elaboration" and "!start_of_simulation" are kept until the respective phase
+ * is reached, the section names do not contribute to the hierarchical names of the values.
  */
 class configurer : public sc_core::sc_module {
     struct ConfigHolder;
@@ -66,6 +72,13 @@ public:
     configurer& operator=(configurer&&) = delete;
 
     void read_input_file(std::string const& filename);
+    /**
+     * read the configuration from a stream, e.g. a configuration stored in a checkpoint
+     *
+     * @param is the input stream
+     * @param source_name the name of the input used in messages
+     */
+    void read_input(std::istream& is, std::string const& source_name = "input stream");
     /**
      * configure the design hierarchy using the input file. Apply the values to
      * sc_core::sc_attribute in th edsign hierarchy
@@ -151,11 +164,14 @@ protected:
     std::vector<std::string> stop_list{};
     configurer(std::string const& filename, unsigned sc_attr_config_phases, sc_core::sc_module_name nm);
     void config_check();
+    void configure_phase(unsigned phase);
     void before_end_of_elaboration() override {
+        configure_phase(BEFORE_END_OF_ELABORATION);
         if(config_phases & BEFORE_END_OF_ELABORATION)
             configure();
     }
     void end_of_elaboration() override {
+        configure_phase(END_OF_ELABORATION);
         if(config_phases & END_OF_ELABORATION)
             configure();
     }
@@ -165,6 +181,10 @@ protected:
     cci_param_cln cci2sc_attr;
     cci::cci_originator cci_originator;
     std::unique_ptr<ConfigHolder> root;
+    //! the parameters of the broker indexed by their hierarchical name, used to resolve wildcards in set_value()
+    util::name_index<cci::cci_param_untyped_handle> param_index;
+    cci::cci_param_create_callback_handle param_create_cb;
+    cci::cci_param_destroy_callback_handle param_destroy_cb;
 };
 
 } // namespace scc
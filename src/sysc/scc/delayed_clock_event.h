@@ -0,0 +1,114 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_DELAYED_CLOCK_EVENT_H_
+#define _SCC_DELAYED_CLOCK_EVENT_H_
+
+#include <systemc>
+
+/** \ingroup scc-sysc
+ *  @{
+ */
+/**@{*/
+//! @brief SCC SystemC utilities
+namespace scc {
+/**
+ * @class delayed_clock_event
+ * @brief an event being notified a fixed delay after the rising clock edge which sleeps while not being used
+ *
+ * Pin-level protocol engines sample signals shortly after the clock edge. Instead of notifying such an event in each
+ * clock cycle the event is only notified if it has been requested (using get()) since the last notification.
+ * Otherwise the driving SC_METHOD falls asleep and is woken up by the next request. This way idle buses do not
+ * cause any kernel activations.
+ *
+ * The timing is the same as with an event being notified in every clock cycle: a request made less than the delay
+ * after a rising edge is served in the same cycle. Since this requires to know the time of the last rising edge the
+ * method only sleeps if the clock is driven by an sc_clock.
+ *
+ * on_clock() needs to be called from an SC_METHOD being statically sensitive to the rising edge of the clock.
+ */
+class delayed_clock_event {
+public:
+    delayed_clock_event(sc_core::sc_in<bool>& clk, sc_core::sc_time const& delay)
+    : clk(clk)
+    , delay(delay) {}
+    /**
+     * @fn void on_clock()
+     * @brief the body of the SC_METHOD driving the event
+     */
+    void on_clock() {
+        if(!clk.posedge()) // woken up between clock edges, continue with the static sensitivity
+            return;
+        if(!requested && get_clock()) {
+            sleeping = true;
+            sc_core::next_trigger(wakeup);
+            return;
+        }
+        requested = false;
+        evt.notify(delay);
+    }
+    /**
+     * @fn const sc_core::sc_event& get()
+     * @brief returns the event to wait for and marks it as being used
+     *
+     * If the driving method sleeps it is woken up. If the delayed edge of the current cycle is still ahead the event
+     * is notified for it so that the timing is the same as with a permanently running method.
+     */
+    sc_core::sc_event const& get() {
+        if(sleeping) {
+            sleeping = false;
+            wakeup.notify();
+            auto const offset = get_time_since_posedge();
+            if(offset < delay)
+                evt.notify(delay - offset);
+            else
+                requested = true;
+        } else
+            requested = true;
+        return evt;
+    }
+    /**
+     * @fn void notify(const sc_core::sc_time&)
+     * @brief notifies the event directly, bypassing the idle detection
+     */
+    void notify(sc_core::sc_time const& t) { evt.notify(t); }
+
+private:
+    sc_core::sc_clock const* get_clock() {
+        if(!clock_checked) {
+            clock = dynamic_cast<sc_core::sc_clock const*>(clk.get_interface());
+            clock_checked = true;
+        }
+        return clock;
+    }
+    //! the time elapsed since the last rising edge of the clock, the clock has passed at least one rising edge
+    sc_core::sc_time get_time_since_posedge() const {
+        auto const& period = clock->period();
+        auto const first_posedge =
+            clock->start_time() + (clock->posedge_first() ? sc_core::SC_ZERO_TIME : period - period * clock->duty_cycle());
+        return sc_core::sc_time::from_value((sc_core::sc_time_stamp() - first_posedge).value() % period.value());
+    }
+    sc_core::sc_in<bool>& clk;
+    sc_core::sc_time const delay;
+    sc_core::sc_event evt, wakeup;
+    sc_core::sc_clock const* clock{nullptr};
+    bool clock_checked{false};
+    bool requested{false};
+    bool sleeping{false};
+};
+} // namespace scc
+/** @} */
+#endif // _SCC_DELAYED_CLOCK_EVENT_H_
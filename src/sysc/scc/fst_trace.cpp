@@ -223,7 +223,13 @@ fst_trace_file::fst_trace_file(const char* name, std::function<bool()>& enable)
     }
     fstWriterSetPackType(m_fst, FST_WR_PT_FASTLZ);
     fstWriterSetRepackOnClose(m_fst, 1);
+#ifdef FST_WRITER_PARALLEL
+    // compress the value change blocks on a separate thread if requested
+    auto* parallel = getenv("SCC_FST_PARALLEL_WRITER");
+    fstWriterSetParallelMode(m_fst, parallel && atoi(parallel) ? 1 : 0);
+#else
     fstWriterSetParallelMode(m_fst, 0);
+#endif
     fstWriterSetTimescale(m_fst, -12); // femto seconds 1*10-12
     fstWriterSetTimezero(m_fst, 0);
     char tbuf[200];
@@ -21,10 +21,14 @@
 #include "configurer.h"
 #include "perf_estimator.h"
 #include "report.h"
+#include "startup_profiler.h"
 #include "tracer.h"
+#include <algorithm>
 #include <deque>
 #include <fmt/format.h>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <rapidjson/istreamwrapper.h>
@@ -34,6 +38,7 @@
 #include <regex>
 #include <scc/utilities.h>
 #include <sstream>
+#include <thread>
 #include <tlm>
 #include <unordered_map>
 #include <unordered_set>
@@ -76,7 +81,8 @@ struct Port {
     bool input{false};
     std::string const type;
     std::string const sig_name;
-    std::string const id{fmt::format("{}", ++object_counter)};
+    //! assigned when written so that the ids follow the output order
+    mutable std::string id;
     Module* const owner;
 
     Port(std::string const& fullname, std::string const& name, void const* ptr, bool input, std::string const& type, Module& owner,
@@ -95,21 +101,29 @@ struct Module {
     std::string const name;
     std::string const type;
     Module* const parent;
-    std::string const id{fmt::format("{}", ++object_counter)};
+    unsigned const depth;
+    //! assigned when written so that the ids follow the output order
+    mutable std::string id;
     std::deque<std::unique_ptr<Module>> submodules;
     std::deque<Port> ports;
+    //! the SystemC module whose children still need to be scanned (streaming mode)
+    sc_core::sc_module const* pending{nullptr};
 
     Module(std::string const& fullname, std::string const& name, std::string const& type, Module& parent)
     : fullname(fullname)
     , name(name)
     , type(type)
-    , parent(&parent) {}
+    , parent(&parent)
+    , depth(parent.depth + 1) {}
     Module(std::string const& fullname, std::string const& name, std::string const& type)
     : fullname(fullname)
     , name(name)
     , type(type)
-    , parent(nullptr) {}
+    , parent(nullptr)
+    , depth(0) {}
 };
+//! called for each sub module before it is written, used to scan the sub module lazily
+using expand_fct = std::function<void(Module&)>;
 
 const std::unordered_set<std::string> ignored_entities = {"tlm_initiator_socket",
                                                           "sc_export",
@@ -152,31 +166,43 @@ std::string operator*(std::string const& str, const unsigned int level) {
 #endif
 #endif
 
-std::vector<std::string> scan_object(sc_core::sc_object const* obj, Module& currentModule, unsigned const level) {
+std::vector<std::string> scan_object(sc_core::sc_object const* obj, Module& currentModule, unsigned const level, bool recursive);
+
+void scan_children(sc_core::sc_module const& mod, Module& currentModule, unsigned const level, bool recursive) {
+    std::unordered_set<std::string> keep_outs;
+    for(auto* child : mod.get_child_objects()) {
+        const std::string child_name{child->basename()};
+        if(child_name.substr(0, 3) == "$$$")
+            continue;
+        if(!keep_outs.empty()) {
+            auto it = std::find_if(std::begin(keep_outs), std::end(keep_outs), [&child_name](std::string const& e) {
+                return child_name.size() > e.size() && child_name.substr(0, e.size()) == e;
+            });
+            if(it != std::end(keep_outs))
+                continue;
+        }
+        auto ks = scan_object(child, currentModule, level, recursive);
+        if(ks.size())
+            for(auto& s : ks)
+                keep_outs.insert(s);
+    }
+}
+/**
+ * adds obj to currentModule, if recursive is false the children of a sub module are not scanned but the module is
+ * marked as pending
+ */
+std::vector<std::string> scan_object(sc_core::sc_object const* obj, Module& currentModule, unsigned const level, bool recursive) {
     std::string name{obj->basename()};
     if(name.substr(0, 3) == "$$$")
         return {};
-    SCCDEBUG() << indent * level << obj->name() << "(" << obj->kind() << "), id=" << (object_counter + 1);
+    SCCDEBUG() << indent * level << obj->name() << "(" << obj->kind() << ")";
     std::string kind{obj->kind()};
     if(auto const* mod = dynamic_cast<sc_core::sc_module const*>(obj)) {
         currentModule.submodules.emplace_back(new Module(obj->name(), name, type(*obj), currentModule));
-        std::unordered_set<std::string> keep_outs;
-        for(auto* child : mod->get_child_objects()) {
-            const std::string child_name{child->basename()};
-            if(child_name.substr(0, 3) == "$$$")
-                continue;
-            if(!keep_outs.empty()) {
-                auto it = std::find_if(std::begin(keep_outs), std::end(keep_outs), [&child_name](std::string const& e) {
-                    return child_name.size() > e.size() && child_name.substr(0, e.size()) == e;
-                });
-                if(it != std::end(keep_outs))
-                    continue;
-            }
-            auto ks = scan_object(child, *currentModule.submodules.back(), level + 1);
-            if(ks.size())
-                for(auto& s : ks)
-                    keep_outs.insert(s);
-        }
+        if(recursive)
+            scan_children(*mod, *currentModule.submodules.back(), level + 1, recursive);
+        else
+            currentModule.submodules.back()->pending = mod;
     } else if(kind == "sc_clock") {
         sc_core::sc_prim_channel const* prim_chan = dynamic_cast<sc_core::sc_prim_channel const*>(obj);
         currentModule.submodules.emplace_back(new Module(obj->name(), name, type(*obj), currentModule));
@@ -216,81 +242,190 @@ std::vector<std::string> scan_object(sc_core::sc_object const* obj, Module& curr
     return {};
 }
 
-using stack_t = std::deque<Module const*>;
-using registry_t = std::unordered_map<void const*, std::vector<Port*>>;
+/**
+ * the module tree reduced to what is needed to infer the implicit ports. The modules are identified by their index in
+ * the order they are visited, the ports are copied so that the tree can be released while collecting (streaming mode).
+ */
+struct port_graph {
+    struct port_ref {
+        size_t mod;
+        std::string name;
+        std::string type;
+        void const* port_if;
+        bool input;
+    };
+    std::vector<std::string> fullnames;
+    std::vector<size_t> parents;
+    std::vector<unsigned> depths;
+    //! the ports sharing an interface
+    std::unordered_map<void const*, std::vector<port_ref>> registry;
 
-void collect_ports_rec(Module& m, registry_t& registry) {
-    for(auto& port : m.ports)
-        registry[port.port_if].emplace_back(&port);
-    for(auto& child : m.submodules)
-        collect_ports_rec(*child, registry);
-}
+    size_t add_module(Module const& m, size_t parent) {
+        fullnames.push_back(m.fullname);
+        parents.push_back(parent);
+        depths.push_back(m.parent ? depths[parent] + 1 : 0);
+        for(auto& port : m.ports)
+            registry[port.port_if].push_back(port_ref{fullnames.size() - 1, port.name, port.type, port.port_if, port.input});
+        return fullnames.size() - 1;
+    }
+};
+//! a port to be added to a module as a connection crosses its boundary
+struct implicit_port {
+    size_t mod;
+    port_graph::port_ref const* ref_port;
+    bool input;
+};
+//! the implicit ports to be added to each module, indexed by the full name of the module
+using implicit_ports_t = std::unordered_map<std::string, std::vector<implicit_port>>;
+using port_key_t = std::pair<size_t, void const*>;
 
-using breadcrumb_t = std::tuple<Module*, bool>;
-bool get_path_to(Module const* i, std::vector<breadcrumb_t>& bread_crumb, std::unordered_set<Module*>& visited) {
-    auto current_mod = std::get<0>(bread_crumb.back());
-    bool upwards = std::get<1>(bread_crumb.back());
-    if(current_mod == i)
-        return true;
-    if(visited.count(current_mod))
-        return false;
-    visited.insert(current_mod);
-    for(auto& c : current_mod->submodules) {
-        bread_crumb.emplace_back(c.get(), false);
-        if(get_path_to(i, bread_crumb, visited))
-            return true;
-        bread_crumb.pop_back();
+struct port_key_hash {
+    size_t operator()(port_key_t const& k) const { return std::hash<size_t>()(k.first) ^ (std::hash<void const*>()(k.second) * 31); }
+};
+//! the interfaces a module already has a port for
+using port_index_t = std::unordered_set<port_key_t, port_key_hash>;
+
+void collect_ports_rec(Module& m, port_graph& graph, size_t parent, expand_fct const& expand) {
+    auto const idx = graph.add_module(m, parent);
+    for(auto& child : m.submodules) {
+        if(expand)
+            expand(*child);
+        collect_ports_rec(*child, graph, idx, expand);
+        if(expand)
+            child->submodules.clear();
+    }
+}
+/**
+ * collects the ports needed by the modules between the owners of start_port and end_port. The path thru the module tree
+ * goes up from the start to the lowest common ancestor and down to the end, the ancestor itself needs no port.
+ */
+void get_implicit_ports(port_graph const& graph, port_graph::port_ref const* start_port, port_graph::port_ref const* end_port,
+                        std::vector<implicit_port>& res) {
+    std::vector<size_t> up_path, down_path;
+    auto up = start_port->mod;
+    auto down = end_port->mod;
+    while(graph.depths[up] > graph.depths[down]) {
+        up = graph.parents[up];
+        up_path.push_back(up);
     }
-    if(upwards && current_mod->parent) {
-        bread_crumb.emplace_back(current_mod->parent, true);
-        if(get_path_to(i, bread_crumb, visited))
-            return true;
-        bread_crumb.pop_back();
+    while(graph.depths[down] > graph.depths[up]) {
+        down = graph.parents[down];
+        down_path.push_back(down);
     }
-    return false;
+    while(up != down) {
+        up = graph.parents[up];
+        up_path.push_back(up);
+        down = graph.parents[down];
+        down_path.push_back(down);
+    }
+    if(up_path.size() && up_path.back() == up)
+        up_path.pop_back();
+    if(down_path.size() && down_path.back() == up)
+        down_path.pop_back();
+    // same order as walking back from the end to the start
+    for(auto mod : down_path)
+        res.push_back({mod, end_port, true});
+    for(auto it = up_path.rbegin(); it != up_path.rend(); ++it)
+        res.push_back({*it, start_port, false});
 }
-
-void infer_implicit_ports(Module& m) {
-    registry_t registry;
-    collect_ports_rec(m, registry);
-    for(auto& entry : registry) {
+/**
+ * determines the ports which are not declared explicitly but needed to draw the connections crossing module
+ * boundaries. For each interface the first driving port is connected to the ports following the first input. The paths
+ * are determined independently for each connection, if parallel is set the connections are processed by a bounded
+ * number of threads. The ports are added afterwards in a fixed order so the result does not depend on the threads.
+ */
+implicit_ports_t infer_implicit_ports(port_graph const& graph, bool parallel) {
+    std::vector<std::pair<port_graph::port_ref const*, port_graph::port_ref const*>> connections;
+    for(auto& entry : graph.registry) {
         auto& ports = entry.second;
         if(ports.size() > 1) {
-            auto o = std::find_if(std::begin(ports), std::end(ports), [](Port const* p) -> bool { return !p->input; });
-            auto i = std::find_if(std::begin(ports), std::end(ports), [](Port const* p) -> bool { return p->input; });
-            while(o != std::end(ports)) {
-                Port* start_port = *o;
-                Module* start_mod = start_port->owner;
-                while(i != std::end(ports)) {
-                    Port* end_port = *i;
-                    std::vector<breadcrumb_t> bread_crumb{std::make_tuple(start_mod, true)};
-                    std::unordered_set<Module*> visited;
-                    if(get_path_to(end_port->owner, bread_crumb, visited) && bread_crumb.size() > 1) {
-                        void const* port_if = end_port->port_if;
-                        auto last_upwards = false;
-                        while(bread_crumb.size() > 1) {
-                            auto mod = std::get<0>(bread_crumb.back());
-                            auto upwards = std::get<1>(bread_crumb.back());
-                            auto port_iter = std::find_if(std::begin(mod->ports), std::end(mod->ports),
-                                                          [port_if](Port const& p) -> bool { return p.port_if == port_if; });
-                            if(port_iter == std::end(mod->ports) && upwards == last_upwards) {
-                                std::ostringstream oss;
-                                auto ref_port = upwards ? start_port : end_port;
-                                oss << mod->fullname << "." << ref_port->name;
-                                mod->ports.push_back(Port(oss.str(), ref_port->name, port_if, !upwards, ref_port->type, *mod));
-                            }
-                            last_upwards = upwards;
-                            bread_crumb.pop_back();
-                        }
-                    }
-                    i++;
-                }
-                o++;
+            auto o = std::find_if(std::begin(ports), std::end(ports), [](port_graph::port_ref const& p) { return !p.input; });
+            if(o == std::end(ports))
+                continue;
+            for(auto i = std::find_if(std::begin(ports), std::end(ports), [](port_graph::port_ref const& p) { return p.input; });
+                i != std::end(ports); ++i)
+                if(o->mod != i->mod)
+                    connections.emplace_back(&*o, &*i);
+        }
+    }
+    std::vector<std::vector<implicit_port>> paths(connections.size());
+    auto infer = [&graph, &connections, &paths](size_t begin, size_t end) {
+        for(auto idx = begin; idx < end; ++idx)
+            get_implicit_ports(graph, connections[idx].first, connections[idx].second, paths[idx]);
+    };
+    auto const threads = parallel ? std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), connections.size()) : 1;
+    if(threads > 1) {
+        std::vector<std::future<void>> futures;
+        for(size_t t = 1; t < threads; ++t)
+            futures.emplace_back(
+                std::async(std::launch::async, infer, connections.size() * t / threads, connections.size() * (t + 1) / threads));
+        infer(0, connections.size() / threads);
+        for(auto& f : futures)
+            f.get();
+    } else
+        infer(0, connections.size());
+    // the interfaces a module already has a port for
+    port_index_t port_index;
+    for(auto& entry : graph.registry)
+        for(auto& port : entry.second)
+            port_index.emplace(port.mod, port.port_if);
+    implicit_ports_t res;
+    for(auto& path : paths)
+        for(auto& p : path)
+            if(port_index.emplace(p.mod, p.ref_port->port_if).second)
+                res[graph.fullnames[p.mod]].push_back(p);
+    return res;
+}
+//! appends the implicit ports of module m
+void add_implicit_ports(Module& m, implicit_ports_t const& implicit_ports) {
+    auto it = implicit_ports.find(m.fullname);
+    if(it != implicit_ports.end())
+        for(auto& p : it->second) {
+            auto const& ref = *p.ref_port;
+            m.ports.push_back(Port(m.fullname + "." + ref.name, ref.name, ref.port_if, p.input, ref.type, m));
+        }
+}
+
+void add_implicit_ports_rec(Module& m, implicit_ports_t const& implicit_ports) {
+    add_implicit_ports(m, implicit_ports);
+    for(auto& child : m.submodules)
+        add_implicit_ports_rec(*child, implicit_ports);
+}
+/**
+ * calls func(srcmod, srcport, tgtmod, tgtport) for each connection to be drawn inside module: between a port of the
+ * module and a port of a sub module and between an output and an input of sub modules. The ports of the sub modules
+ * are indexed by their interface.
+ */
+void for_each_edge(Module const& module, std::function<void(Module const&, Port const&, Module const&, Port const&)> const& func) {
+    std::unordered_map<void const*, std::vector<std::pair<Module const*, Port const*>>> sub_ports;
+    for(auto& tgtmod : module.submodules)
+        for(auto& tgtport : tgtmod->ports)
+            if(tgtport.port_if)
+                sub_ports[tgtport.port_if].emplace_back(tgtmod.get(), &tgtport);
+    // edges module <-> submodule
+    for(auto& srcport : module.ports) {
+        if(srcport.port_if) {
+            auto it = sub_ports.find(srcport.port_if);
+            if(it != sub_ports.end())
+                for(auto& tgt : it->second)
+                    func(module, srcport, *tgt.first, *tgt.second);
+        }
+    }
+    // edges submodule -> submodule
+    for(auto& srcmod : module.submodules) {
+        for(auto& srcport : srcmod->ports) {
+            if(!srcport.input && srcport.port_if) {
+                auto it = sub_ports.find(srcport.port_if);
+                if(it != sub_ports.end())
+                    for(auto& tgt : it->second)
+                        if(tgt.second->input && !(srcmod->fullname == tgt.first->fullname && tgt.second->fullname == srcport.fullname))
+                            func(*srcmod, srcport, *tgt.first, *tgt.second);
             }
         }
     }
 }
-void generate_elk(std::ostream& e, Module const& module, unsigned level = 0) {
+
+void generate_elk(std::ostream& e, Module const& module, expand_fct const& expand, unsigned level = 0) {
     SCCDEBUG() << module.name;
     unsigned num_in{0}, num_out{0};
     for(auto& port : module.ports)
@@ -313,38 +448,23 @@ void generate_elk(std::ostream& e, Module const& module, unsigned level = 0) {
         e << indent * level << "port " << port.name << " { ^port.side: " << side << " label '" << port.name << "' }\n";
     }
 
-    for(auto& m : module.submodules)
-        generate_elk(e, *m, level);
-    // Draw edges module <-> submodule:
-    for(auto& srcport : module.ports) {
-        if(srcport.port_if)
-            for(auto& tgtmod : module.submodules) {
-                for(auto& tgtport : tgtmod->ports) {
-                    if(tgtport.port_if == srcport.port_if)
-                        e << indent * level << "edge " << srcport.fullname << " -> " << tgtport.fullname << "\n";
-                }
-            }
-    }
-    // Draw edges submodule -> submodule:
-    for(auto& srcmod : module.submodules) {
-        for(auto& srcport : srcmod->ports) {
-            if(!srcport.input && srcport.port_if)
-                for(auto& tgtmod : module.submodules) {
-                    for(auto& tgtport : tgtmod->ports) {
-                        if(srcmod->fullname == tgtmod->fullname && tgtport.fullname == srcport.fullname)
-                            continue;
-                        if(tgtport.port_if == srcport.port_if && tgtport.input)
-                            e << indent * level << "edge " << srcport.fullname << " -> " << tgtport.fullname << "\n";
-                    }
-                }
-        }
+    for(auto& m : module.submodules) {
+        if(expand)
+            expand(*m);
+        generate_elk(e, *m, expand, level);
+        if(expand) // the sub modules are not needed anymore, only the ports are needed for the edges
+            m->submodules.clear();
     }
+    for_each_edge(module, [&e, level](Module const&, Port const& srcport, Module const&, Port const& tgtport) {
+        e << indent * level << "edge " << srcport.fullname << " -> " << tgtport.fullname << "\n";
+    });
     level--;
     e << indent * level << "}\n"
       << "\n";
 }
 
 void generate_port_json(writer_type& writer, hierarchy_dumper::file_type type, const scc::Port& p) {
+    p.id = fmt::format("{}", ++object_counter);
     writer.StartObject();
     {
         writer.Key("id");
@@ -464,13 +584,14 @@ void generate_edge_d3_json(writer_type& writer, const scc::Module& srcmod, const
     writer.EndObject();
 }
 
-void generate_mod_json(writer_type& writer, hierarchy_dumper::file_type type, Module const& module, unsigned level = 0) {
+void generate_mod_json(writer_type& writer, hierarchy_dumper::file_type type, Module const& module, expand_fct const& expand) {
     unsigned num_in{0}, num_out{0};
     for(auto& port : module.ports)
         if(port.input)
             num_in++;
         else
             num_out++;
+    module.id = fmt::format("{}", ++object_counter);
     writer.StartObject();
     {
         writer.Key("id");
@@ -490,8 +611,13 @@ void generate_mod_json(writer_type& writer, hierarchy_dumper::file_type type, Mo
             writer.Key("children");
         writer.StartArray();
         {
-            for(auto& c : module.submodules)
-                generate_mod_json(writer, type, *c, level * 1);
+            for(auto& c : module.submodules) {
+                if(expand)
+                    expand(*c);
+                generate_mod_json(writer, type, *c, expand);
+                if(expand)
+                    c->submodules.clear();
+            }
         }
         writer.EndArray();
         // process connections
@@ -500,45 +626,12 @@ void generate_mod_json(writer_type& writer, hierarchy_dumper::file_type type, Mo
         else
             writer.Key("edges");
         writer.StartArray();
-        {
-            // Draw edges module <-> submodule:
-            for(auto& srcport : module.ports) {
-                if(srcport.port_if) {
-                    for(auto& tgtmod : module.submodules) {
-                        for(auto& tgtport : tgtmod->ports) {
-                            if(tgtport.port_if == srcport.port_if) {
-                                if(type == hierarchy_dumper::D3JSON) {
-                                    generate_edge_d3_json(writer, module, srcport, *tgtmod, tgtport);
-                                } else {
-                                    generate_edge_json(writer, srcport, tgtport);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            // Draw edges submodule -> submodule:
-            for(auto& srcmod : module.submodules) {
-                for(auto& srcport : srcmod->ports) {
-                    if(!srcport.input && srcport.port_if) {
-                        for(auto& tgtmod : module.submodules) {
-                            for(auto& tgtport : tgtmod->ports) {
-                                if(srcmod->fullname == tgtmod->fullname && tgtport.fullname == srcport.fullname) {
-                                    continue;
-                                }
-                                if(tgtport.port_if == srcport.port_if && tgtport.input) {
-                                    if(type == hierarchy_dumper::D3JSON) {
-                                        generate_edge_d3_json(writer, *srcmod, srcport, *tgtmod, tgtport);
-                                    } else {
-                                        generate_edge_json(writer, srcport, tgtport);
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        for_each_edge(module, [&writer, type](Module const& srcmod, Port const& srcport, Module const& tgtmod, Port const& tgtport) {
+            if(type == hierarchy_dumper::D3JSON)
+                generate_edge_d3_json(writer, srcmod, srcport, tgtmod, tgtport);
+            else
+                generate_edge_json(writer, srcport, tgtport);
+        });
         writer.EndArray();
         if(type != hierarchy_dumper::D3JSON) {
             writer.Key("labels");
@@ -595,29 +688,58 @@ void generate_mod_json(writer_type& writer, hierarchy_dumper::file_type type, Mo
     writer.EndObject();
 }
 
-std::unique_ptr<Module> scan_object_tree() {
+std::unique_ptr<Module> scan_object_tree(bool recursive) {
     std::vector<sc_core::sc_object*> obja = sc_core::sc_get_top_level_objects();
     if(obja.size() == 1 && std::string(obja[0]->kind()) == "sc_module" && std::string(obja[0]->basename()).substr(0, 3) != "$$$") {
         SCCDEBUG() << obja[0]->name() << "(" << obja[0]->kind() << ")";
         auto topModule = scc::make_unique<Module>(obja[0]->name(), obja[0]->basename(), type(*obja[0]));
         for(auto* child : obja[0]->get_child_objects())
-            scan_object(child, *topModule, 1);
+            scan_object(child, *topModule, 1, recursive);
         return topModule;
     } else {
         SCCDEBUG() << "sc_main ( function sc_main() )";
         auto topModule = scc::make_unique<Module>("sc_main", "sc_main", "sc_main()");
         for(auto* child : obja)
-            scan_object(child, *topModule, 1);
+            scan_object(child, *topModule, 1, recursive);
         return topModule;
     }
 }
-void dump_structure(std::ostream& e, hierarchy_dumper::file_type format) {
-    auto topModule = scan_object_tree();
-    infer_implicit_ports(*topModule);
+void dump_structure(std::ostream& e, hierarchy_dumper::file_type format, bool streaming, bool parallel) {
+    startup_profiler::scope profile("hierarchy_dumper", "scan");
+    object_counter = 0;
+    port_graph graph;
+    implicit_ports_t implicit_ports;
+    expand_fct expand;
+    std::unique_ptr<Module> topModule;
+    if(streaming) {
+        auto scan = [](Module& m) {
+            if(m.pending) {
+                scan_children(*m.pending, m, m.depth + 1, false);
+                m.pending = nullptr;
+            }
+        };
+        // the first pass only keeps the ports to infer the implicit ones, the second one writes the modules
+        topModule = scan_object_tree(false);
+        collect_ports_rec(*topModule, graph, 0, scan);
+        implicit_ports = infer_implicit_ports(graph, parallel);
+        topModule = scan_object_tree(false);
+        add_implicit_ports(*topModule, implicit_ports);
+        expand = [&implicit_ports, scan](Module& m) {
+            scan(m);
+            add_implicit_ports(m, implicit_ports);
+        };
+    } else {
+        topModule = scan_object_tree(true);
+        collect_ports_rec(*topModule, graph, 0, nullptr);
+        implicit_ports = infer_implicit_ports(graph, parallel);
+        add_implicit_ports_rec(*topModule, implicit_ports);
+    }
+    profile.end();
+    startup_profiler::scope write_profile("hierarchy_dumper", "write");
     if(format == hierarchy_dumper::ELKT) {
         e << "algorithm: org.eclipse.elk.layered\n";
         e << "edgeRouting: ORTHOGONAL\n";
-        generate_elk(e, *topModule);
+        generate_elk(e, *topModule, expand);
         SCCINFO() << "SystemC Structure Dumped to ELK file";
     } else {
         OStreamWrapper stream(e);
@@ -647,7 +769,7 @@ void dump_structure(std::ostream& e, hierarchy_dumper::file_type format) {
             writer.EndObject();
             writer.Key("children");
             writer.StartArray();
-            { generate_mod_json(writer, format, *topModule); }
+            { generate_mod_json(writer, format, *topModule, expand); }
             writer.EndArray();
             writer.Key("edges");
             writer.StartArray();
@@ -681,10 +803,12 @@ void dump_structure(std::ostream& e, hierarchy_dumper::file_type format) {
 }
 } // namespace
 
-hierarchy_dumper::hierarchy_dumper(const std::string& filename, file_type format)
+hierarchy_dumper::hierarchy_dumper(const std::string& filename, file_type format, bool streaming, bool parallel)
 : sc_core::sc_module(sc_core::sc_module_name("$$$hierarchy_dumper$$$"))
 , dump_hier_file_name{filename}
-, dump_format{format} {}
+, dump_format{format}
+, streaming{streaming}
+, parallel{parallel} {}
 
 hierarchy_dumper::~hierarchy_dumper() {}
 
@@ -692,7 +816,7 @@ void hierarchy_dumper::start_of_simulation() {
     if(dump_hier_file_name.size()) {
         std::ofstream of{dump_hier_file_name};
         if(of.is_open())
-            dump_structure(of, dump_format);
+            dump_structure(of, dump_format, streaming, parallel);
     }
 }
 } // namespace scc
@@ -43,10 +43,17 @@ public:
     /**
      * @brief Constructs a hierarchy_dumper object with the specified file name and format.
      *
+     * In streaming mode each module is written as soon as it is scanned and only the modules along the current path
+     * and their direct sub modules are kept in memory. The ports which are not declared explicitly are inferred in a
+     * preceding pass over the hierarchy which only keeps the names of the modules and their ports, so the output is
+     * the same as without streaming.
+     *
      * @param filename The name of the file where the hierarchy will be dumped.
      * @param format The format in which the hierarchy will be dumped.
+     * @param streaming If true the modules are written while scanning the hierarchy.
+     * @param parallel If true the implicit ports are inferred using up to one thread per hardware thread.
      */
-    hierarchy_dumper(const std::string& filename, file_type format);
+    hierarchy_dumper(const std::string& filename, file_type format, bool streaming = false, bool parallel = false);
     /**
      * @brief Destroys the hierarchy_dumper object.
      */
@@ -61,6 +68,8 @@ private:
      */
     void start_of_simulation() override;
     file_type const dump_format;
+    bool const streaming;
+    bool const parallel;
 };
 } // namespace scc
 /** @} */ // end of scc-sysc
@@ -0,0 +1,56 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "perf_counter.h"
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace scc {
+namespace {
+struct registry {
+    std::mutex mtx;
+    std::vector<perf_counter const*> counters;
+};
+
+registry& get_registry() {
+    static registry reg;
+    return reg;
+}
+} // namespace
+
+perf_counter::perf_counter(std::string const& name)
+: nm(name) {
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    reg.counters.push_back(this);
+}
+
+perf_counter::~perf_counter() {
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    auto it = std::find(reg.counters.begin(), reg.counters.end(), this);
+    if(it != reg.counters.end())
+        reg.counters.erase(it);
+}
+
+void perf_counter::for_each(std::function<void(perf_counter const&)> const& func) {
+    auto& reg = get_registry();
+    std::lock_guard<std::mutex> lock(reg.mtx);
+    for(auto const* c : reg.counters)
+        func(*c);
+}
+} // namespace scc
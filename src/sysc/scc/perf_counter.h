@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_PERF_COUNTER_H_
+#define _SCC_PERF_COUNTER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/** \ingroup scc-sysc
+ *  @{
+ */
+/**@{*/
+//! @brief SCC SystemC utilities
+namespace scc {
+/**
+ * @class perf_counter
+ * @brief a named event counter sampled by the telemetry of the @ref scc::perf_estimator
+ *
+ * A counter registers itself in a global registry upon construction and removes itself upon destruction. Incrementing
+ * is a relaxed atomic operation without any locking so it can be used in the hot path of a model, e.g. to count the
+ * transactions of a socket. Only the registration and the enumeration of the counters are guarded by a mutex.
+ */
+class perf_counter {
+public:
+    /**
+     * @fn  perf_counter(const std::string&)
+     * @brief constructs and registers a counter
+     *
+     * @param name the name of the counter, usually the hierarchical name of the owner and a suffix
+     */
+    explicit perf_counter(std::string const& name);
+
+    perf_counter(const perf_counter&) = delete;
+
+    perf_counter& operator=(const perf_counter&) = delete;
+
+    ~perf_counter();
+    /**
+     * @fn void inc(uint64_t)
+     * @brief increments the counter
+     */
+    void inc(uint64_t n = 1) { val.fetch_add(n, std::memory_order_relaxed); }
+
+    perf_counter& operator++() {
+        inc();
+        return *this;
+    }
+
+    perf_counter& operator+=(uint64_t n) {
+        inc(n);
+        return *this;
+    }
+    /**
+     * @fn uint64_t get()const
+     * @brief returns the current value
+     */
+    uint64_t get() const { return val.load(std::memory_order_relaxed); }
+
+    std::string const& name() const { return nm; }
+    /**
+     * @fn void for_each(const std::function<void (const perf_counter&)>&)
+     * @brief calls func for each registered counter in the order of registration
+     *
+     * The registry is locked during the iteration, so func must not create or destroy counters.
+     */
+    static void for_each(std::function<void(perf_counter const&)> const& func);
+
+private:
+    std::string const nm;
+    std::atomic<uint64_t> val{0};
+};
+} // namespace scc
+/** @} */ // end of scc-sysc
+#endif /* _SCC_PERF_COUNTER_H_ */
@@ -15,7 +15,13 @@
  *******************************************************************************/
 
 #include "perf_estimator.h"
+#include "perf_counter.h"
 #include "report.h"
+#include <fmt/format.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <tlm/scc/socket_stats.h>
+#include <util/ities.h>
 
 #if defined(_WIN32)
 #include <Windows.h>
@@ -33,6 +39,11 @@
 
 namespace scc {
 using namespace sc_core;
+namespace {
+constexpr unsigned telemetry_stages = SC_POST_UPDATE | SC_PRE_TIMESTEP;
+
+inline double to_ms(std::chrono::steady_clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); }
+} // namespace
 
 #if SYSTEMC_VERSION < 20250221
 SC_HAS_PROCESS(perf_estimator);
@@ -47,6 +58,8 @@ perf_estimator::perf_estimator(const sc_module_name& nm, sc_time beat_delay_)
 }
 
 perf_estimator::~perf_estimator() {
+    if(registered)
+        sc_unregister_stage_callback(*this, telemetry_stages);
     time_stamp eod;
     eod.set();
     SCCINFO("perf_estimator") << "constr & elab time:  " << (eoe.proc_clock_stamp - soc.proc_clock_stamp) << "s";
@@ -65,6 +78,11 @@ void perf_estimator::end_of_elaboration() { eoe.set(); }
 void perf_estimator::start_of_simulation() {
     sos.set();
     get_memory();
+    if(telemetry.is_open()) {
+        sc_spawn_options opts;
+        opts.spawn_method();
+        sc_spawn([this]() { sample_telemetry(); }, "telemetry", &opts);
+    }
 }
 
 void perf_estimator::end_of_simulation() {
@@ -80,6 +98,156 @@ void perf_estimator::end_of_simulation() {
                                   << ")";
     }
     get_memory();
+    if(telemetry.is_open()) {
+        if(last_wall != wall_clock::time_point() && now > last_sim)
+            write_telemetry();
+        telemetry.close();
+    }
+}
+
+void perf_estimator::set_telemetry(std::string const& file_name, sc_time interval) {
+    if(sc_is_running()) {
+        SCCERR(SCMOD) << "Telemetry can only be enabled before the start of the simulation";
+        return;
+    }
+    if(!interval.value()) {
+        SCCERR(SCMOD) << "The telemetry interval needs to be larger than zero";
+        return;
+    }
+    telemetry.open(file_name);
+    if(!telemetry.is_open()) {
+        SCCERR(SCMOD) << "Could not open " << file_name;
+        return;
+    }
+    telemetry_interval = interval;
+    telemetry_json = util::ends_with(file_name, ".jsonl") || util::ends_with(file_name, ".json");
+    if(!registered) {
+        sc_register_stage_callback(*this, telemetry_stages);
+        registered = true;
+    }
+}
+
+void perf_estimator::stage_callback(const sc_stage& stage) {
+    auto now = wall_clock::now();
+    if(stage == SC_PRE_TIMESTEP) {
+        ++timesteps;
+        first_in_step = true;
+    } else if(first_in_step) {
+        timed_time += now - mark;
+        first_in_step = false;
+    } else {
+        delta_time += now - mark;
+        ++deltas;
+    }
+    mark = now;
+}
+
+void perf_estimator::sample_telemetry() {
+    if(last_wall != wall_clock::time_point())
+        write_telemetry();
+    else { // the initial activation sets the baseline
+        last_wall = mark = wall_clock::now();
+        last_cpu = time_stamp().proc_clock_stamp;
+        last_sim = sc_time_stamp();
+        timed_time = delta_time = wall_clock::duration::zero();
+        timesteps = deltas = 0;
+        for_each_counter([this](std::string const& name, uint64_t val) {
+            last_counts[name] = val;
+            csv_counters.push_back(name);
+        });
+        if(!telemetry_json) {
+            telemetry << "wall_s,sim_time_s,sim_wall_ratio,cycles_per_s,cpu_s,rss_kB,timesteps,deltas,timed_ms,delta_ms";
+            for(auto const& name : csv_counters)
+                telemetry << ",\"" << name << "\",\"" << name << "/s\"";
+            telemetry << "\n";
+        }
+    }
+    next_trigger(telemetry_interval);
+}
+
+void perf_estimator::write_telemetry() {
+    auto const wall = wall_clock::now();
+    auto const sim = sc_time_stamp();
+    auto const cpu = time_stamp().proc_clock_stamp;
+    auto const wall_s = std::chrono::duration<double>(wall - last_wall).count();
+    auto const sim_s = (sim - last_sim).to_seconds();
+    auto const rtf = wall_s > 0 ? sim_s / wall_s : 0.0;
+    auto const cps = cycle_period.value() && wall_s > 0 ? (sim - last_sim).value() / cycle_period.value() / wall_s : 0.0;
+    auto const rss = get_rss();
+    std::vector<std::tuple<std::string, uint64_t, double>> counts;
+    for_each_counter([this, &counts, wall_s](std::string const& name, uint64_t val) {
+        auto& last = last_counts[name];
+        // socket statistics may have been reset since the last record
+        auto const diff = val >= last ? val - last : val;
+        counts.emplace_back(name, val, wall_s > 0 ? diff / wall_s : 0.0);
+        last = val;
+    });
+    auto const wall_total = (boost::posix_time::microsec_clock::universal_time() - sos.wall_clock_stamp).total_microseconds() / 1e6;
+    if(telemetry_json) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        writer.StartObject();
+        writer.Key("wall_s");
+        writer.Double(wall_total);
+        writer.Key("sim_time_s");
+        writer.Double(sim.to_seconds());
+        writer.Key("sim_wall_ratio");
+        writer.Double(rtf);
+        writer.Key("cycles_per_s");
+        writer.Double(cps);
+        writer.Key("cpu_s");
+        writer.Double(cpu - last_cpu);
+        writer.Key("rss_kB");
+        writer.Int64(rss);
+        writer.Key("timesteps");
+        writer.Uint64(timesteps);
+        writer.Key("deltas");
+        writer.Uint64(deltas);
+        writer.Key("timed_ms");
+        writer.Double(to_ms(timed_time));
+        writer.Key("delta_ms");
+        writer.Double(to_ms(delta_time));
+        writer.Key("counters");
+        writer.StartObject();
+        for(auto const& c : counts) {
+            writer.Key(std::get<0>(c).c_str());
+            writer.StartObject();
+            writer.Key("total");
+            writer.Uint64(std::get<1>(c));
+            writer.Key("rate");
+            writer.Double(std::get<2>(c));
+            writer.EndObject();
+        }
+        writer.EndObject();
+        writer.EndObject();
+        telemetry << buffer.GetString() << "\n";
+    } else {
+        telemetry << fmt::format("{:.6f},{:.9g},{:.6g},{:.6g},{:.6f},{},{},{},{:.3f},{:.3f}", wall_total, sim.to_seconds(), rtf, cps,
+                                 cpu - last_cpu, rss, timesteps, deltas, to_ms(timed_time), to_ms(delta_time));
+        for(auto const& name : csv_counters) {
+            auto it = std::find_if(counts.begin(), counts.end(),
+                                   [&name](std::tuple<std::string, uint64_t, double> const& c) { return std::get<0>(c) == name; });
+            if(it != counts.end())
+                telemetry << fmt::format(",{},{:.6g}", std::get<1>(*it), std::get<2>(*it));
+            else
+                telemetry << ",,";
+        }
+        telemetry << "\n";
+    }
+    telemetry.flush();
+    last_wall = wall;
+    last_sim = sim;
+    last_cpu = cpu;
+    timed_time = delta_time = wall_clock::duration::zero();
+    timesteps = deltas = 0;
+}
+
+void perf_estimator::for_each_counter(std::function<void(std::string const&, uint64_t)> const& func) {
+    perf_counter::for_each([&func](perf_counter const& c) { func(c.name(), c.get()); });
+    tlm::scc::socket_stats::for_each([&func](tlm::scc::socket_stats const& s) {
+        func(s.get_name() + ".transactions", s.transactions());
+        func(s.get_name() + ".bytes", s.bytes());
+    });
 }
 
 void perf_estimator::beat() {
@@ -149,6 +317,21 @@ auto scc::perf_estimator::time_stamp::get_cpu_time() -> double {
     return 1.0;
 }
 
+long scc::perf_estimator::get_rss() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    long size = 0, resident = 0;
+    if(statm >> size >> resident)
+        return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#endif
+#if defined(RUSAGE_SELF)
+    struct rusage usage {};
+    if(getrusage(RUSAGE_SELF, &usage) != -1)
+        return usage.ru_maxrss;
+#endif
+    return 0L;
+}
+
 long scc::perf_estimator::get_memory() {
 #if defined(RUSAGE_SELF)
     {
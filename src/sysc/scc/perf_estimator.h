@@ -18,8 +18,14 @@
 #define _SCC_PERFORMANCETRACER_H_
 
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
 #include <systemc>
 #include <tuple>
+#include <vector>
 
 /** \ingroup scc-sysc
  *  @{
@@ -35,20 +41,17 @@ namespace scc {
  * some performance figures. Optionally it provides a heart beat which periodically calls a functor
  * If a cycle time is provides it calculates also the cycles per (wall clock) second
  *
+ * Optionally it writes telemetry in a fixed simulation time interval as CSV or JSON lines (see set_telemetry()).
  */
-class perf_estimator : public sc_core::sc_module {
-    //! some internal data structure to record a time stamp
+class perf_estimator : public sc_core::sc_module, public sc_core::sc_stage_callback_if {
+public:
+    //! a time stamp of the wall clock and the process (CPU) time, it is taken at construction
     struct time_stamp {
         boost::posix_time::ptime wall_clock_stamp;
         double proc_clock_stamp;
         time_stamp()
         : wall_clock_stamp(boost::posix_time::microsec_clock::universal_time())
         , proc_clock_stamp(get_cpu_time()) {}
-        time_stamp& operator=(const time_stamp& o) {
-            wall_clock_stamp = o.wall_clock_stamp;
-            proc_clock_stamp = o.proc_clock_stamp;
-            return *this;
-        }
         void set() {
             wall_clock_stamp = boost::posix_time::microsec_clock::universal_time();
             proc_clock_stamp = get_cpu_time();
@@ -58,7 +61,6 @@ class perf_estimator : public sc_core::sc_module {
         static double get_cpu_time();
     };
 
-public:
     /**
      * @fn  perf_estimator()
      * @brief default constructor creating an unnamed perf_estimator
@@ -87,6 +89,23 @@ public:
      * @param cycle_period
      */
     void set_cycle_time(sc_core::sc_time cycle_period) { this->cycle_period = cycle_period; };
+    /**
+     * @fn void set_telemetry(const std::string&, sc_core::sc_time)
+     * @brief enables the periodic recording of performance figures, needs to be called before the simulation starts
+     *
+     * Each record contains the wall clock and simulation time, the ratio of simulated to wall clock time and the
+     * simulated cycles per second (if a cycle time is set) within the interval, the resident memory, the number of
+     * time steps and delta cycles as well as the wall clock time spent in the evaluation of timed notifications (the
+     * first delta cycle of a time step) resp. in subsequent delta cycles. Additionally the total and the rate per
+     * wall clock second of all @ref scc::perf_counter and of the transactions and bytes of all @ref tlm::scc::socket_stats
+     * are recorded.
+     * If the file name ends with .jsonl or .json, a JSON object per line is written, otherwise a CSV file whose columns
+     * are the counters registered at the first record.
+     *
+     * @param file_name the name of the output file
+     * @param interval the interval in simulation time
+     */
+    void set_telemetry(std::string const& file_name, sc_core::sc_time interval);
 
 protected:
     perf_estimator(const sc_core::sc_module_name& nm, sc_core::sc_time heart_beat);
@@ -94,6 +113,7 @@ protected:
     void end_of_elaboration() override;
     void start_of_simulation() override;
     void end_of_simulation() override;
+    void stage_callback(const sc_core::sc_stage& stage) override;
     //! the recorded time stamps
     time_stamp soc;
     time_stamp eoe;
@@ -103,6 +123,28 @@ protected:
     void beat();
     long get_memory();
     long max_memory{0};
+
+private:
+    using wall_clock = std::chrono::steady_clock;
+    void sample_telemetry();
+    void write_telemetry();
+    //! calls func with the name and value of each perf_counter and the transactions and bytes of each socket_stats
+    void for_each_counter(std::function<void(std::string const&, uint64_t)> const& func);
+    static long get_rss();
+    std::ofstream telemetry;
+    sc_core::sc_time telemetry_interval;
+    bool telemetry_json{false}, registered{false};
+    std::vector<std::string> csv_counters;
+    std::map<std::string, uint64_t> last_counts;
+    // the state at the last record
+    wall_clock::time_point last_wall;
+    sc_core::sc_time last_sim;
+    double last_cpu{0};
+    // accumulated by the stage callbacks since the last record
+    wall_clock::time_point mark;
+    wall_clock::duration timed_time{0}, delta_time{0};
+    uint64_t timesteps{0}, deltas{0};
+    bool first_in_step{true};
 };
 
 } /* namespace scc */
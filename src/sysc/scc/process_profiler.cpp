@@ -0,0 +1,445 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "process_profiler.h"
+#include "report.h"
+#include <algorithm>
+#include <cerrno>
+#include <fmt/format.h>
+#include <fstream>
+#include <map>
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/writer.h>
+#include <sstream>
+#include <type_traits>
+#if defined(__linux__)
+#include <csignal>
+#include <ctime>
+#include <sys/syscall.h>
+#include <unistd.h>
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+namespace scc {
+namespace {
+//! the size of the sample buffer, it is drained after each update phase
+constexpr uint64_t sample_buffer_size = 1 << 16;
+//! limits the memory used for the Chrome trace to some 24MB
+constexpr size_t max_runs = 1 << 20;
+//! the minimum time between two scans of the hierarchy for new processes
+constexpr std::chrono::milliseconds resolve_interval{100};
+//! the samples are evaluated after each update phase and before each time step
+constexpr unsigned profiler_stages = sc_core::SC_POST_UPDATE | sc_core::SC_PRE_TIMESTEP;
+
+std::string const kernel_name{"<kernel>"};
+std::string const unknown_name{"<terminated process>"};
+#if defined(__linux__)
+struct sigaction prev_action;
+#endif
+
+inline double to_ms(std::chrono::steady_clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); }
+
+inline int64_t to_us(std::chrono::steady_clock::duration d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); }
+} // namespace
+
+process_profiler* process_profiler::inst{nullptr};
+
+process_profiler::process_profiler(std::string const& report_file, std::string const& flamegraph_file, std::string const& trace_file,
+                                   unsigned sample_period_us)
+: sc_core::sc_module(sc_core::sc_module_name("$$$process_profiler$$$"))
+, report_file(report_file)
+, flamegraph_file(flamegraph_file)
+, trace_file(trace_file)
+, sample_period(std::max(1U, sample_period_us)) {
+    if(inst)
+        SCCWARN(SCMOD) << "Another process_profiler is already instantiated, activations are counted by this one";
+    inst = this;
+    sc_core::sc_register_stage_callback(*this, profiler_stages);
+    registered = true;
+}
+
+process_profiler::~process_profiler() {
+    if(running)
+        finish();
+    if(inst == this)
+        inst = nullptr;
+    if(registered)
+        sc_core::sc_unregister_stage_callback(*this, profiler_stages);
+}
+
+void process_profiler::count_activation() {
+    if(inst && inst->running) {
+        void const* process = sc_core::sc_get_current_process_b();
+        inst->activations[process]++;
+        if(!inst->sampling)
+            inst->hook(process);
+    }
+}
+
+void process_profiler::start_of_simulation() {
+    context = sc_core::sc_get_curr_simcontext();
+    start_delta = context->delta_count();
+    start_time = last_resolve = last_sample = clock::now();
+    running = true;
+    sampling = start_sampling();
+    if(!sampling)
+        SCCINFO(SCMOD) << "Sampling is not available, only processes calling count_activation() are profiled";
+}
+
+void process_profiler::end_of_simulation() { finish(); }
+
+void process_profiler::stage_callback(const sc_core::sc_stage& stage) {
+    if(!running)
+        return;
+    if(stage == sc_core::SC_PRE_TIMESTEP)
+        ++timesteps;
+    if(sampling)
+        drain();
+    else
+        hook(nullptr);
+    if(new_processes)
+        resolve_names(false);
+}
+
+#if defined(__linux__)
+void process_profiler::on_sample(int) {
+    // runs on the simulation thread, the kernel state is read by the thread writing it
+    auto* p = inst;
+    if(!p)
+        return;
+    auto const saved_errno = errno;
+    auto const head = p->sample_head.load(std::memory_order_relaxed);
+    if(head - p->sample_tail.load(std::memory_order_acquire) < sample_buffer_size) {
+        auto& smp = p->sample_buffer[head % sample_buffer_size];
+        smp.process = p->context->get_curr_proc_info()->process_handle;
+        smp.delta = p->context->delta_count();
+        smp.time = clock::now();
+        p->sample_head.store(head + 1, std::memory_order_release);
+    } else
+        p->dropped_samples.fetch_add(1, std::memory_order_relaxed);
+    errno = saved_errno;
+}
+
+bool process_profiler::start_sampling() {
+    static_assert(std::is_same<timer_t, void*>::value, "timer_t is expected to be a pointer");
+    sample_buffer.reset(new sample[sample_buffer_size]);
+    struct sigaction action {};
+    action.sa_handler = &process_profiler::on_sample;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if(sigaction(SIGPROF, &action, &prev_action))
+        return false;
+    // the timer signal is delivered to the thread running the simulation
+    struct sigevent sev {};
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = SIGPROF;
+    sev.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+    timer_t id;
+    if(timer_create(CLOCK_MONOTONIC, &sev, &id)) {
+        sigaction(SIGPROF, &prev_action, nullptr);
+        return false;
+    }
+    timer = id;
+    has_timer = true;
+    auto const period_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(sample_period).count();
+    struct itimerspec spec {};
+    spec.it_interval.tv_sec = spec.it_value.tv_sec = period_ns / 1000000000;
+    spec.it_interval.tv_nsec = spec.it_value.tv_nsec = period_ns % 1000000000;
+    if(timer_settime(id, 0, &spec, nullptr)) {
+        stop_sampling();
+        return false;
+    }
+    return true;
+}
+
+void process_profiler::stop_sampling() {
+    if(!has_timer)
+        return;
+    timer_delete(static_cast<timer_t>(timer));
+    has_timer = false;
+    // ignoring the signal discards a still pending one before the previous handler is restored
+    signal(SIGPROF, SIG_IGN);
+    sigaction(SIGPROF, &prev_action, nullptr);
+}
+#else
+void process_profiler::on_sample(int) {}
+
+bool process_profiler::start_sampling() { return false; }
+
+void process_profiler::stop_sampling() {}
+#endif
+
+void process_profiler::drain() {
+    auto const head = sample_head.load(std::memory_order_acquire);
+    for(auto tail = sample_tail.load(std::memory_order_relaxed); tail != head; ++tail) {
+        auto const& smp = sample_buffer[tail % sample_buffer_size];
+        record(smp.process, smp.delta, smp.time);
+    }
+    sample_tail.store(head, std::memory_order_release);
+}
+
+void process_profiler::record(void const* process, uint64_t delta, clock::time_point time) {
+    auto& s = stats[process];
+    if(!s.samples)
+        new_processes = true;
+    s.samples++;
+    if(s.last_delta != delta) {
+        s.last_delta = delta;
+        s.deltas++;
+    }
+    // a sample accounts for the time since the previous one
+    s.time += time - last_sample;
+    if(trace_file.size()) {
+        if(runs.size() && runs.back().process == process)
+            runs.back().end = time - start_time;
+        else if(runs.size() < max_runs)
+            runs.push_back(run{process, last_sample - start_time, time - start_time});
+        else
+            dropped_runs++;
+    }
+    last_sample = time;
+}
+
+void process_profiler::hook(void const* process) {
+    auto const now = clock::now();
+    auto const start = last_sample - start_time, end = now - start_time;
+    stats[last_hooked].time += end - start;
+    if(trace_file.size()) {
+        if(runs.size() && runs.back().process == last_hooked)
+            runs.back().end = end;
+        else if(runs.size() < max_runs)
+            runs.push_back(run{last_hooked, start, end});
+        else
+            dropped_runs++;
+    }
+    if(!stats.count(process))
+        new_processes = true;
+    auto& s = stats[process];
+    auto const delta = context->delta_count();
+    if(s.last_delta != delta) {
+        s.last_delta = delta;
+        s.deltas++;
+    }
+    last_hooked = process;
+    last_sample = now;
+}
+
+void process_profiler::stop() {
+    if(!running)
+        return;
+    if(sampling) {
+        stop_sampling();
+        drain();
+    } else
+        hook(nullptr);
+    running = false;
+    elapsed = clock::now() - start_time;
+    deltas = context->delta_count() - start_delta;
+}
+
+void process_profiler::resolve_names(bool force) {
+    auto now = clock::now();
+    if(!force && now - last_resolve < resolve_interval)
+        return;
+    last_resolve = now;
+    new_processes = false;
+    std::vector<void const*> unresolved;
+    for(auto const& e : stats)
+        if(e.first && !names.count(e.first))
+            unresolved.push_back(e.first);
+    for(auto const& e : activations)
+        if(!names.count(e.first))
+            unresolved.push_back(e.first);
+    if(unresolved.empty())
+        return;
+    std::sort(unresolved.begin(), unresolved.end());
+    // the sampled pointers are only compared to the processes in the hierarchy, processes terminated in between
+    // remain unresolved
+    std::vector<sc_core::sc_object*> objs(sc_core::sc_get_top_level_objects());
+    while(objs.size()) {
+        auto* obj = objs.back();
+        objs.pop_back();
+        if(auto* proc = dynamic_cast<sc_core::sc_process_b*>(obj)) {
+            void const* key = proc;
+            if(std::binary_search(unresolved.begin(), unresolved.end(), key))
+                names[key] = obj->name();
+        }
+        auto const& children = obj->get_child_objects();
+        objs.insert(objs.end(), children.begin(), children.end());
+    }
+}
+
+std::string const& process_profiler::name_of(void const* process) const {
+    if(!process)
+        return kernel_name;
+    auto it = names.find(process);
+    return it == names.end() ? unknown_name : it->second;
+}
+
+void process_profiler::finish() {
+    if(finished)
+        return;
+    finished = true;
+    stop();
+    resolve_names(true);
+    if(report_file.empty()) {
+        std::ostringstream os;
+        write_report(os);
+        SCCINFO(SCMOD) << "process profile:\n" << os.str();
+    } else {
+        std::ofstream ofs(report_file);
+        if(ofs.is_open())
+            write_report(ofs);
+        else
+            SCCWARN(SCMOD) << "Could not open " << report_file;
+    }
+    if(flamegraph_file.size()) {
+        std::ofstream ofs(flamegraph_file);
+        if(ofs.is_open())
+            write_flamegraph(ofs);
+        else
+            SCCWARN(SCMOD) << "Could not open " << flamegraph_file;
+    }
+    if(dropped_samples)
+        SCCWARN(SCMOD) << dropped_samples << " samples were dropped as the sample buffer was full";
+    if(trace_file.size()) {
+        if(dropped_runs)
+            SCCWARN(SCMOD) << "The trace is truncated, " << dropped_runs << " process executions were not recorded";
+        std::ofstream ofs(trace_file);
+        if(ofs.is_open())
+            write_chrome_trace(ofs);
+        else
+            SCCWARN(SCMOD) << "Could not open " << trace_file;
+    }
+}
+
+std::vector<process_profiler::process_profile> process_profiler::get_profile() {
+    if(running && sampling)
+        drain();
+    resolve_names(true);
+    return aggregate();
+}
+
+std::vector<process_profiler::process_profile> process_profiler::aggregate() const {
+    // processes are aggregated by name as a pointer may be reused by a dynamic process
+    std::map<std::string, process_profile> processes;
+    for(auto const& e : stats) {
+        auto& p = processes[name_of(e.first)];
+        p.samples += e.second.samples;
+        p.deltas += e.second.deltas;
+        p.time += e.second.time;
+    }
+    for(auto const& e : activations)
+        processes[name_of(e.first)].activations += e.second;
+    std::vector<process_profile> res;
+    res.reserve(processes.size());
+    for(auto& e : processes) {
+        e.second.name = e.first;
+        res.push_back(std::move(e.second));
+    }
+    std::stable_sort(res.begin(), res.end(), [](process_profile const& a, process_profile const& b) { return a.time > b.time; });
+    return res;
+}
+
+void process_profiler::write_report(std::ostream& os) const {
+    auto const processes = aggregate();
+    std::map<std::string, clock::duration> modules;
+    uint64_t total = 0;
+    clock::duration total_time{0};
+    for(auto const& p : processes) {
+        total += p.samples;
+        total_time += p.time;
+        if(p.name != kernel_name && p.name != unknown_name)
+            for(auto pos = p.name.find(sc_core::SC_HIERARCHY_CHAR); pos != std::string::npos;
+                pos = p.name.find(sc_core::SC_HIERARCHY_CHAR, pos + 1))
+                modules[p.name.substr(0, pos)] += p.time;
+    }
+    auto share = [total_time](clock::duration d) { return total_time.count() ? 100.0 * d.count() / total_time.count() : 0.0; };
+    os << fmt::format("{} samples in {:.3f}s, {} delta cycles, {} time steps\n", total, to_ms(elapsed) / 1000, deltas, timesteps);
+    os << fmt::format("{:>10} {:>7} {:>12} {:>10} {:>12}  {}\n", "samples", "share", "time[ms]", "deltas", "activations", "process");
+    for(auto const& p : processes)
+        os << fmt::format("{:>10} {:>6.2f}% {:>12.3f} {:>10} {:>12}  {}\n", p.samples, share(p.time), to_ms(p.time), p.deltas,
+                          p.activations, p.name);
+    std::vector<std::pair<std::string, clock::duration>> sorted_mods(modules.begin(), modules.end());
+    std::stable_sort(sorted_mods.begin(), sorted_mods.end(),
+                     [](std::pair<std::string, clock::duration> const& a, std::pair<std::string, clock::duration> const& b) {
+                         return a.second > b.second;
+                     });
+    os << fmt::format("{:>7} {:>12}  {}\n", "share", "time[ms]", "module (incl. children)");
+    for(auto const& e : sorted_mods)
+        os << fmt::format("{:>6.2f}% {:>12.3f}  {}\n", share(e.second), to_ms(e.second), e.first);
+}
+
+void process_profiler::write_flamegraph(std::ostream& os) const {
+    std::map<std::string, uint64_t> stacks;
+    for(auto const& e : stats) {
+        auto stack = name_of(e.first);
+        std::replace(stack.begin(), stack.end(), sc_core::SC_HIERARCHY_CHAR, ';');
+        // the flame graph weights are samples or, if profiling by hooks, microseconds
+        stacks[stack] += sampling ? e.second.samples : static_cast<uint64_t>(to_us(e.second.time));
+    }
+    for(auto const& e : stacks)
+        os << e.first << " " << e.second << "\n";
+}
+
+void process_profiler::write_chrome_trace(std::ostream& os) const {
+    rapidjson::OStreamWrapper stream(os);
+    rapidjson::Writer<rapidjson::OStreamWrapper> writer(stream);
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    writer.StartObject();
+    writer.Key("name");
+    writer.String("thread_name");
+    writer.Key("ph");
+    writer.String("M");
+    writer.Key("pid");
+    writer.Uint(1);
+    writer.Key("tid");
+    writer.Uint(0);
+    writer.Key("args");
+    writer.StartObject();
+    writer.Key("name");
+    writer.String("SystemC processes");
+    writer.EndObject();
+    writer.EndObject();
+    for(auto const& r : runs) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name_of(r.process).c_str());
+        writer.Key("cat");
+        writer.String(r.process ? "process" : "kernel");
+        writer.Key("ph");
+        writer.String("X");
+        writer.Key("ts");
+        writer.Int64(to_us(r.start));
+        writer.Key("dur");
+        writer.Int64(to_us(r.end - r.start));
+        writer.Key("pid");
+        writer.Uint(1);
+        writer.Key("tid");
+        writer.Uint(0);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.EndObject();
+    os << "\n";
+}
+} // namespace scc
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_PROCESS_PROFILER_H_
+#define _SCC_PROCESS_PROFILER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <memory>
+#include <string>
+#include <systemc>
+#include <unordered_map>
+#include <vector>
+
+/** \ingroup scc-sysc
+ *  @{
+ */
+/**@{*/
+//! @brief SCC SystemC utilities
+namespace scc {
+/**
+ * @class process_profiler
+ * @brief a sampling profiler attributing the wall clock time of the simulation to SystemC processes and modules
+ *
+ * SystemC provides no hook when the kernel switches between processes. Therefore the process currently executed by
+ * the kernel is sampled in a fixed interval between start_of_simulation() and end_of_simulation(). The sampling uses
+ * a timer signal delivered to the simulation thread (Linux only), so the current process and the delta count are
+ * read by the thread writing them and no data race with the kernel exists. The samples are collected in a buffer
+ * and evaluated in the stage callbacks after each update phase and before each time step. Samples taken while no
+ * process is executed (scheduler, channel updates, time advance) are attributed to <kernel>. The number of distinct
+ * delta cycles a process has been sampled in is reported as a lower bound of its activations. Exact activation
+ * counts can be collected by calling count_activation() in the process bodies of interest.
+ *
+ * Sampling requires all processes to run on the thread calling sc_start(), which is not the case if SystemC uses
+ * pthreads for its coroutines. If the sampling is not available the profiler relies on explicit hooks: the wall
+ * clock time from a count_activation() call until the next one or the end of the update phase is attributed to the
+ * calling process, the time from the end of an update phase until the next hook to <kernel>. Processes not calling
+ * count_activation() are thus accounted to the process hooked before them in the same delta cycle, no sample counts
+ * are reported.
+ *
+ * The results are written at the end of the simulation as
+ * - a flat report of processes and modules (inclusive of their children) sorted by time
+ * - a flame graph in collapsed stack format (module hierarchy;process samples), e.g. for flamegraph.pl or speedscope
+ * - a Chrome trace event file of the sampled process executions which can be viewed using Perfetto
+ */
+class process_profiler : public sc_core::sc_module, public sc_core::sc_stage_callback_if {
+public:
+    //! the profile of a process
+    struct process_profile {
+        std::string name;
+        uint64_t samples{0}, deltas{0}, activations{0};
+        std::chrono::steady_clock::duration time{0};
+    };
+    /**
+     * @fn  process_profiler(const std::string&, const std::string&, const std::string&, unsigned)
+     * @brief constructs the profiler
+     *
+     * @param report_file the name of the report file, if empty the report is logged
+     * @param flamegraph_file the name of the collapsed stack file, not written if empty
+     * @param trace_file the name of the Chrome trace file, not written if empty
+     * @param sample_period_us the sampling interval in microseconds
+     */
+    process_profiler(std::string const& report_file = "", std::string const& flamegraph_file = "", std::string const& trace_file = "",
+                     unsigned sample_period_us = 100);
+
+    process_profiler(const process_profiler&) = delete;
+
+    process_profiler& operator=(const process_profiler&) = delete;
+
+    ~process_profiler();
+    /**
+     * @fn void count_activation()
+     * @brief counts an activation of the current process, to be called at the begin of a method or thread loop
+     */
+    static void count_activation();
+    /**
+     * @fn bool is_sampling()const
+     * @brief returns true if the processes are sampled, false if the profiler relies on count_activation() hooks
+     *
+     * The result is valid from start_of_simulation() on.
+     */
+    bool is_sampling() const { return sampling; }
+    /**
+     * @fn std::vector<process_profile> get_profile()
+     * @brief returns the profile of the processes collected so far sorted by their wall clock time
+     *
+     * The processes are identified by their hierarchical name. It must be called from the SystemC thread.
+     */
+    std::vector<process_profile> get_profile();
+    /**
+     * @fn void write_report(std::ostream&)const
+     * @brief writes the processes and modules sorted by their wall clock time
+     */
+    void write_report(std::ostream& os) const;
+    /**
+     * @fn void write_flamegraph(std::ostream&)const
+     * @brief writes the samples in the collapsed stack format
+     */
+    void write_flamegraph(std::ostream& os) const;
+    /**
+     * @fn void write_chrome_trace(std::ostream&)const
+     * @brief writes the sampled executions in the Chrome trace event format
+     */
+    void write_chrome_trace(std::ostream& os) const;
+
+protected:
+    void start_of_simulation() override;
+    void end_of_simulation() override;
+    void stage_callback(const sc_core::sc_stage& stage) override;
+
+private:
+    using clock = std::chrono::steady_clock;
+    struct process_stats {
+        uint64_t samples{0};
+        uint64_t deltas{0};
+        uint64_t last_delta{std::numeric_limits<uint64_t>::max()};
+        clock::duration time{0};
+    };
+    //! a sample written by the signal handler
+    struct sample {
+        void const* process;
+        uint64_t delta;
+        clock::time_point time;
+    };
+    //! a sequence of samples hitting the same process
+    struct run {
+        void const* process;
+        clock::duration start, end;
+    };
+    static void on_sample(int);
+    bool start_sampling();
+    void stop_sampling();
+    void drain();
+    void record(void const* process, uint64_t delta, clock::time_point time);
+    void hook(void const* process);
+    void stop();
+    void finish();
+    void resolve_names(bool force);
+    std::string const& name_of(void const* process) const;
+    std::vector<process_profile> aggregate() const;
+
+    static process_profiler* inst;
+    std::string const report_file, flamegraph_file, trace_file;
+    std::chrono::microseconds const sample_period;
+    sc_core::sc_simcontext* context{nullptr};
+    bool running{false}, sampling{false};
+    // the ring buffer of samples, written by the signal handler and read in drain()
+    std::unique_ptr<sample[]> sample_buffer;
+    std::atomic<uint64_t> sample_head{0}, sample_tail{0}, dropped_samples{0};
+    void* timer{nullptr};
+    //! the id of the first timer of a process is 0, hence it cannot tell whether a timer exists
+    bool has_timer{false};
+    clock::time_point start_time, last_resolve, last_sample;
+    clock::duration elapsed{0};
+    std::unordered_map<void const*, process_stats> stats;
+    std::vector<run> runs;
+    uint64_t dropped_runs{0};
+    std::unordered_map<void const*, std::string> names;
+    std::unordered_map<void const*, uint64_t> activations;
+    void const* last_hooked{nullptr};
+    uint64_t start_delta{0}, deltas{0}, timesteps{0};
+    bool registered{false}, finished{false}, new_processes{false};
+};
+} // namespace scc
+/** @} */ // end of scc-sysc
+#endif /* _SCC_PROCESS_PROFILER_H_ */
@@ -30,10 +30,18 @@ void scv_tr_sqlite_init();
  * @fn void scv_tr_compressed_init()
  * @brief initializes the infrastructure to use a gzip compressed text based transaction recording database
  *
- * TODO: add a multithreaded writer
- *
+ * See scv_tr_gzip_init() for a writer compressing on multiple threads
  */
 void scv_tr_compressed_init();
+/**
+ * @fn void scv_tr_gzip_init()
+ * @brief initializes the infrastructure to use a gzip compressed text based transaction recording database which is
+ * compressed on a pool of worker threads (see util::gzip_ostreambuf)
+ *
+ * The compression level and the number of threads are controlled by the environment variables SCC_SCV_TR_GZIP_LEVEL
+ * and SCC_SCV_TR_COMPRESSION_THREADS. Only available if SCC is built with zlib.
+ */
+void scv_tr_gzip_init();
 /**
  * @fn void scv_tr_plain_init()
  * @brief initializes the infrastructure to use a plain text based transaction recording database
@@ -50,6 +58,15 @@ void scv_tr_plain_init();
  *
  */
 void scv_tr_lz4_init();
+/**
+ * @fn void scv_tr_chunked_init()
+ * @brief initializes the infrastructure to use a LZ4 compressed text based transaction recording database written as
+ * independently compressed chunks with a trailing time and stream index (see util::chunked_lz4_writer)
+ *
+ * The chunk size and the file rotation are controlled by the environment variables SCC_SCV_TR_CHUNK_SIZE,
+ * SCC_SCV_TR_MAX_FILE_SIZE, SCC_SCV_TR_MAX_FILE_TIME and SCC_SCV_TR_MAX_FILES
+ */
+void scv_tr_chunked_init();
 /**
  * @fn void scv_tr_mtc_init()
  * @brief initializes the infrastructure to use a compressed text based transaction recording database with a
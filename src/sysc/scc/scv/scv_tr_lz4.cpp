@@ -27,7 +27,11 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <util/chunked_lz4_file.h>
 #include <util/lz4_streambuf.h>
+#ifdef HAS_ZLIB
+#include <util/gzip_streambuf.h>
+#endif
 #include <vector>
 // clang-format off
 #ifdef HAS_SCV
@@ -73,6 +77,7 @@ const std::array<char const*, scv_extensions_if::STRING + 1> data_type_str = {{
 }};
 class PlainWriter {
 public:
+    static const bool indexed = false;
     std::ofstream out;
     PlainWriter(const std::string& name)
     : out(name) {}
@@ -81,12 +86,16 @@ public:
             out.close();
     }
     bool is_open() { return out.is_open(); }
+    inline void begin_record(uint64_t time, uint64_t stream) {}
+    inline void add_record_stream(uint64_t stream) {}
+    inline void define(char const* data, size_t size) { out.write(data, size); }
 };
 class LZ4Writer {
     std::ofstream ofs;
     std::unique_ptr<util::lz4c_steambuf> strbuf;
 
 public:
+    static const bool indexed = false;
     std::ostream out;
     LZ4Writer(const std::string& name)
     : ofs(name, std::ios::binary | std::ios::trunc)
@@ -100,10 +109,75 @@ public:
     }
 
     bool is_open() { return ofs.is_open(); }
+    inline void begin_record(uint64_t time, uint64_t stream) {}
+    inline void add_record_stream(uint64_t stream) {}
+    inline void define(char const* data, size_t size) { out.write(data, size); }
+};
+#ifdef HAS_ZLIB
+/**
+ * writes a gzip compressed database. The compression level (default 1) and the number of threads compressing in
+ * parallel are configured using the environment variables SCC_SCV_TR_GZIP_LEVEL and SCC_SCV_TR_COMPRESSION_THREADS
+ * (see util::gzip_ostreambuf)
+ */
+class GzipWriter {
+    static int get_level() {
+        auto* val = getenv("SCC_SCV_TR_GZIP_LEVEL");
+        return val ? atoi(val) : 1;
+    }
+    static unsigned get_threads() {
+        auto* val = getenv("SCC_SCV_TR_COMPRESSION_THREADS");
+        return val ? strtoul(val, nullptr, 0) : 0;
+    }
+    util::gzip_ostreambuf strbuf;
+
+public:
+    static const bool indexed = false;
+    std::ostream out;
+    GzipWriter(const std::string& name)
+    : strbuf(name, get_level(), get_threads())
+    , out(&strbuf) {}
+    ~GzipWriter() { strbuf.close(); }
+
+    bool is_open() { return true; }
+    inline void begin_record(uint64_t time, uint64_t stream) {}
+    inline void add_record_stream(uint64_t stream) {}
+    inline void define(char const* data, size_t size) { out.write(data, size); }
+};
+#endif
+/**
+ * writes independently LZ4 compressed chunks with a trailing index (see util::chunked_lz4_writer). The chunking and
+ * file rotation is configured using the environment variables SCC_SCV_TR_CHUNK_SIZE, SCC_SCV_TR_MAX_FILE_SIZE,
+ * SCC_SCV_TR_MAX_FILE_TIME (in SystemC time resolution units) and SCC_SCV_TR_MAX_FILES
+ */
+class ChunkedLZ4Writer {
+    static util::chunked_lz4_writer::config get_config() {
+        util::chunked_lz4_writer::config cfg;
+        if(auto* val = getenv("SCC_SCV_TR_CHUNK_SIZE"))
+            cfg.chunk_size = strtoull(val, nullptr, 0);
+        if(auto* val = getenv("SCC_SCV_TR_MAX_FILE_SIZE"))
+            cfg.max_file_size = strtoull(val, nullptr, 0);
+        if(auto* val = getenv("SCC_SCV_TR_MAX_FILE_TIME"))
+            cfg.max_file_time = strtoull(val, nullptr, 0);
+        if(auto* val = getenv("SCC_SCV_TR_MAX_FILES"))
+            cfg.max_files = strtoul(val, nullptr, 0);
+        return cfg;
+    }
+
+public:
+    static const bool indexed = true;
+    util::chunked_lz4_writer out;
+    ChunkedLZ4Writer(const std::string& name)
+    : out(name, ".chk", get_config()) {}
+
+    bool is_open() { return out.is_open(); }
+    inline void begin_record(uint64_t time, uint64_t stream) { out.begin_record(time, stream); }
+    inline void add_record_stream(uint64_t stream) { out.add_record_stream(stream); }
+    inline void define(char const* data, size_t size) { out.write_definition(data, size); }
 };
 
 template <typename WRITER> struct Formatter {
     std::unique_ptr<WRITER> writer;
+    std::unordered_map<uint64_t, uint64_t> generator_stream;
     Formatter(const std::string& name)
     : writer(new WRITER(name)) {}
 
@@ -118,27 +192,41 @@ template <typename WRITER> struct Formatter {
 
     inline void writeStream(uint64_t id, std::string const& name, std::string const& kind) {
         auto buf = fmt::format("scv_tr_stream (ID {}, name \"{}\", kind \"{}\")\n", id, name.c_str(), kind.c_str());
-        writer->out.write(buf.c_str(), buf.size());
+        writer->define(buf.c_str(), buf.size());
     }
 
     inline void writeGenerator(uint64_t id, std::string const& name, uint64_t stream, std::vector<AttrDesc> const& attributes) {
+        if(WRITER::indexed)
+            generator_stream[id] = stream;
         auto buf = fmt::format("scv_tr_generator (ID {}, name \"{}\", scv_tr_stream {},\n", id, name.c_str(), stream);
-        writer->out.write(buf.c_str(), buf.size());
         auto idx = 0U;
         for(auto attr : attributes) {
             if(attr.evt == BEGIN) {
-                auto buf = fmt::format("begin_attribute (ID {}, name \"{}\", type \"{}\")\n", idx, attr.name, data_type_str[attr.type]);
-                writer->out.write(buf.c_str(), buf.size());
+                buf += fmt::format("begin_attribute (ID {}, name \"{}\", type \"{}\")\n", idx, attr.name, data_type_str[attr.type]);
             } else if(attr.evt == END) {
-                auto buf = fmt::format("end_attribute (ID {}, name \"{}\", type \"{}\")\n", idx, attr.name, data_type_str[attr.type]);
-                writer->out.write(buf.c_str(), buf.size());
+                buf += fmt::format("end_attribute (ID {}, name \"{}\", type \"{}\")\n", idx, attr.name, data_type_str[attr.type]);
             }
             ++idx;
         }
-        writer->out.write(")\n", 2);
+        buf += ")\n";
+        writer->define(buf.c_str(), buf.size());
+    }
+
+    /**
+     * starts a record of the given streams for data not written as part of a transaction begin or end, e.g.
+     * attributes recorded in between or relations, so that it is found when selecting chunks by stream
+     */
+    inline void beginRecord(uint64_t time, uint64_t stream, uint64_t other_stream) {
+        if(WRITER::indexed) {
+            writer->begin_record(time, stream);
+            if(other_stream != stream)
+                writer->add_record_stream(other_stream);
+        }
     }
 
     inline void writeTransaction(uint64_t id, uint64_t generator, EventType type, uint64_t time) {
+        if(WRITER::indexed)
+            writer->begin_record(time, generator_stream[generator]);
         auto buf = type == BEGIN ? fmt::format("tx_begin {} {} {} ps\n", id, generator, time)
                                  : fmt::format("tx_end {} {} {} ps\n", id, generator, time);
         writer->out.write(buf.c_str(), buf.size());
@@ -374,6 +462,8 @@ template <typename DB> void attributeCb(const scv_tr_handle& t, const char* name
         return;
     if(t.get_scv_tr_stream().get_scv_tr_db()->get_recording() == false)
         return;
+    auto stream = t.get_scv_tr_stream().get_id();
+    DB::get().beginRecord(sc_core::sc_time_stamp().value(), stream, stream);
     recordAttributes<DB>(t.get_id(), RECORD, name == nullptr ? "" : name, ext);
 }
 // ----------------------------------------------------------------------------
@@ -384,6 +474,7 @@ void relationCb(const scv_tr_handle& tr_1, const scv_tr_handle& tr_2, void* data
     if(tr_1.get_scv_tr_stream().get_scv_tr_db()->get_recording() == false)
         return;
     try {
+        DB::get().beginRecord(sc_core::sc_time_stamp().value(), tr_1.get_scv_tr_stream().get_id(), tr_2.get_scv_tr_stream().get_id());
         DB::get().writeRelation(tr_1.get_scv_tr_stream().get_scv_tr_db()->get_relation_name(relation_handle), tr_1.get_id(), tr_2.get_id());
     } catch(std::runtime_error& e) {
         _scv_message::message(_scv_message::TRANSACTION_RECORDING_INTERNAL, "Can't create transaction relation");
@@ -399,6 +490,24 @@ void scv_tr_lz4_init() {
     scv_tr_handle::register_record_attribute_cb(attributeCb<Formatter<LZ4Writer>>);
     scv_tr_handle::register_relation_cb(relationCb<Formatter<LZ4Writer>>);
 }
+void scv_tr_chunked_init() {
+    scv_tr_db::register_class_cb(dbCb<Formatter<ChunkedLZ4Writer>>);
+    scv_tr_stream::register_class_cb(streamCb<Formatter<ChunkedLZ4Writer>>);
+    scv_tr_generator_base::register_class_cb(generatorCb<Formatter<ChunkedLZ4Writer>>);
+    scv_tr_handle::register_class_cb(transactionCb<Formatter<ChunkedLZ4Writer>>);
+    scv_tr_handle::register_record_attribute_cb(attributeCb<Formatter<ChunkedLZ4Writer>>);
+    scv_tr_handle::register_relation_cb(relationCb<Formatter<ChunkedLZ4Writer>>);
+}
+#ifdef HAS_ZLIB
+void scv_tr_gzip_init() {
+    scv_tr_db::register_class_cb(dbCb<Formatter<GzipWriter>>);
+    scv_tr_stream::register_class_cb(streamCb<Formatter<GzipWriter>>);
+    scv_tr_generator_base::register_class_cb(generatorCb<Formatter<GzipWriter>>);
+    scv_tr_handle::register_class_cb(transactionCb<Formatter<GzipWriter>>);
+    scv_tr_handle::register_record_attribute_cb(attributeCb<Formatter<GzipWriter>>);
+    scv_tr_handle::register_relation_cb(relationCb<Formatter<GzipWriter>>);
+}
+#endif
 void scv_tr_plain_init() {
     scv_tr_db::register_class_cb(dbCb<Formatter<PlainWriter>>);
     scv_tr_stream::register_class_cb(streamCb<Formatter<PlainWriter>>);
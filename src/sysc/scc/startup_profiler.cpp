@@ -0,0 +1,447 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "startup_profiler.h"
+#include "report.h"
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <fmt/format.h>
+#include <fstream>
+#include <functional>
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/writer.h>
+#include <sstream>
+#include <unordered_map>
+#include <util/ities.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#if defined(__linux__)
+#include <cerrno>
+#include <csignal>
+#include <sys/syscall.h>
+#include <unistd.h>
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif
+
+namespace scc {
+namespace {
+constexpr unsigned stages =
+    sc_core::SC_POST_BEFORE_END_OF_ELABORATION | sc_core::SC_POST_END_OF_ELABORATION | sc_core::SC_POST_START_OF_SIMULATION;
+
+inline double to_ms(startup_profiler::duration const& d) { return d.total_microseconds() / 1000.0; }
+
+inline int64_t to_us(startup_profiler::duration const& d) { return d.total_microseconds(); }
+//! the samples are stored in a preallocated buffer since the signal handler must not allocate memory
+constexpr size_t max_samples = 1 << 18;
+#if defined(__linux__)
+//! the process_profiler uses SIGPROF and starts sampling while this profiler is still recording
+inline int sample_signal() { return SIGRTMIN; }
+#endif
+} // namespace
+
+struct startup_profiler::sampler {
+    struct sample {
+        sc_core::sc_object const* obj;
+        unsigned phase;
+        timespec wall, cpu;
+    };
+    std::unique_ptr<sample[]> samples{new sample[max_samples]};
+    std::atomic<size_t> count{0};
+    std::atomic<unsigned> phase{0};
+#if defined(__linux__)
+    struct sigaction prev_action {};
+    timer_t timer{};
+    //! the id of the first timer of a process is 0
+    bool has_timer{false};
+
+    static void take_sample(int) {
+        // runs on the elaborating thread, the current object is read by the thread writing it
+        auto* prof = inst;
+        if(!prof || !prof->smpl)
+            return;
+        auto const saved_errno = errno;
+        auto& s = *prof->smpl;
+        auto idx = s.count.load(std::memory_order_relaxed);
+        if(idx < max_samples) {
+            s.samples[idx].obj = sc_core::sc_get_current_object();
+            s.samples[idx].phase = s.phase.load(std::memory_order_relaxed);
+            clock_gettime(CLOCK_REALTIME, &s.samples[idx].wall);
+            clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &s.samples[idx].cpu);
+            s.count.store(idx + 1, std::memory_order_relaxed);
+        }
+        errno = saved_errno;
+    }
+#endif
+};
+
+startup_profiler* startup_profiler::inst{nullptr};
+
+auto startup_profiler::no_stamp() -> time_stamp const& {
+    static time_stamp const stamp;
+    return stamp;
+}
+
+startup_profiler::scope::scope(char const* category, std::string const& name)
+: prof(inst) {
+    if(!prof)
+        return;
+    idx = prof->scopes.size();
+    auto heap = heap_size();
+    time_stamp now;
+    prof->scopes.push_back(record{category, name, now.wall_clock_stamp - prof->origin.wall_clock_stamp, duration(), duration(),
+                                  now.proc_clock_stamp, heap, 0, static_cast<unsigned>(prof->open_scopes.size())});
+    prof->open_scopes.push_back(idx);
+}
+
+void startup_profiler::scope::set_name(std::string const& name) {
+    if(prof && prof == inst)
+        prof->scopes[idx].name = name;
+}
+
+void startup_profiler::scope::end() {
+    if(prof && prof == inst) {
+        auto& r = prof->scopes[idx];
+        prof->end_record(r, time_stamp(), heap_size());
+        auto& open = prof->open_scopes;
+        // inner scopes which have not been ended properly are dropped
+        while(open.size() && open.back() != idx)
+            open.pop_back();
+        if(open.size())
+            open.pop_back();
+        if(open.size())
+            prof->scopes[open.back()].child_wall += r.wall;
+    }
+    prof = nullptr;
+}
+
+startup_profiler::startup_profiler(std::string const& report_file, std::string const& trace_file, unsigned sampling_interval_us)
+: sc_core::sc_module(sc_core::sc_module_name("$$$startup_profiler$$$"))
+, report_file(report_file)
+, trace_file(trace_file) {
+    if(inst) {
+        SCCWARN(SCMOD) << "Another startup_profiler is already recording, it is replaced by this one";
+        inst->stop_sampling();
+    }
+    inst = this;
+    // the sample buffer is allocated before the heap of the first phase is recorded
+    start_sampling(sampling_interval_us);
+    begin_phase("construction");
+    sc_core::sc_register_stage_callback(*this, stages);
+    registered = true;
+}
+
+startup_profiler::~startup_profiler() {
+    if(inst == this)
+        finish();
+    else
+        stop_sampling();
+    if(registered)
+        sc_core::sc_unregister_stage_callback(*this, stages);
+}
+
+void startup_profiler::before_end_of_elaboration() { begin_phase("before_end_of_elaboration"); }
+
+void startup_profiler::end_of_elaboration() { begin_phase("end_of_elaboration"); }
+
+void startup_profiler::start_of_simulation() { begin_phase("start_of_simulation"); }
+
+void startup_profiler::stage_callback(const sc_core::sc_stage& stage) {
+    if(inst != this)
+        return;
+    switch(stage) {
+    case sc_core::SC_POST_BEFORE_END_OF_ELABORATION:
+        begin_phase("binding");
+        break;
+    case sc_core::SC_POST_END_OF_ELABORATION:
+        begin_phase("initialization");
+        break;
+    case sc_core::SC_POST_START_OF_SIMULATION:
+        finish();
+        break;
+    default:
+        break;
+    }
+}
+
+void startup_profiler::begin_phase(char const* name) {
+    if(inst != this)
+        return;
+    auto heap = heap_size();
+    time_stamp now;
+    if(phases.size())
+        end_record(phases.back(), now, heap);
+    if(name) {
+        phases.push_back(record{"phase", name, now.wall_clock_stamp - origin.wall_clock_stamp, duration(), duration(), now.proc_clock_stamp,
+                                heap, 0, 0});
+        if(smpl)
+            smpl->phase.store(static_cast<unsigned>(phases.size() - 1), std::memory_order_relaxed);
+    }
+}
+
+void startup_profiler::end_record(record& r, time_stamp const& now, int64_t heap) const {
+    r.wall = now.wall_clock_stamp - origin.wall_clock_stamp - r.start;
+    r.cpu = now.proc_clock_stamp - r.cpu;
+    r.heap_delta = heap - r.heap_start;
+}
+
+void startup_profiler::add_tally(char const* category, char const* name, time_stamp const& start) {
+    time_stamp now;
+    auto& a = tallies[std::make_pair(std::string(category), std::string(name))];
+    a.count++;
+    a.total += now.wall_clock_stamp - start.wall_clock_stamp;
+    a.self += now.wall_clock_stamp - start.wall_clock_stamp;
+    a.cpu += now.proc_clock_stamp - start.proc_clock_stamp;
+}
+
+#if defined(__linux__)
+void startup_profiler::start_sampling(unsigned interval_us) {
+    if(!interval_us)
+        return;
+    smpl.reset(new sampler);
+    struct sigaction action {};
+    action.sa_handler = &sampler::take_sample;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if(sigaction(sample_signal(), &action, &smpl->prev_action)) {
+        SCCWARN(SCMOD) << "Could not install the signal handler, modules are not sampled";
+        smpl.reset();
+        return;
+    }
+    // the timer signal is delivered to the thread elaborating the design
+    struct sigevent sev {};
+    sev.sigev_notify = SIGEV_THREAD_ID;
+    sev.sigev_signo = sample_signal();
+    sev.sigev_notify_thread_id = static_cast<pid_t>(syscall(SYS_gettid));
+    struct itimerspec spec {};
+    spec.it_interval.tv_sec = spec.it_value.tv_sec = interval_us / 1000000;
+    spec.it_interval.tv_nsec = spec.it_value.tv_nsec = (interval_us % 1000000) * 1000L;
+    if(timer_create(CLOCK_MONOTONIC, &sev, &smpl->timer)) {
+        SCCWARN(SCMOD) << "Could not create the sampling timer, modules are not sampled";
+        sigaction(sample_signal(), &smpl->prev_action, nullptr);
+        smpl.reset();
+        return;
+    }
+    smpl->has_timer = true;
+    if(timer_settime(smpl->timer, 0, &spec, nullptr)) {
+        SCCWARN(SCMOD) << "Could not start the sampling timer, modules are not sampled";
+        stop_sampling();
+        smpl.reset();
+    }
+}
+
+void startup_profiler::stop_sampling() {
+    if(!smpl || !smpl->has_timer)
+        return;
+    timer_delete(smpl->timer);
+    smpl->has_timer = false;
+    // ignoring the signal discards a still pending one before the previous handler is restored
+    signal(sample_signal(), SIG_IGN);
+    sigaction(sample_signal(), &smpl->prev_action, nullptr);
+}
+#else
+void startup_profiler::start_sampling(unsigned) {}
+
+void startup_profiler::stop_sampling() {}
+#endif
+
+void startup_profiler::evaluate_samples() {
+    if(!smpl)
+        return;
+    // the nearest module of each object of the design, objects deleted meanwhile are not known anymore
+    std::unordered_map<sc_core::sc_object const*, sc_core::sc_module const*> modules;
+    std::function<void(sc_core::sc_object const*, sc_core::sc_module const*)> collect = [&modules, &collect](sc_core::sc_object const* obj,
+                                                                                                          sc_core::sc_module const* mod) {
+        if(auto const* m = dynamic_cast<sc_core::sc_module const*>(obj))
+            mod = m;
+        modules[obj] = mod;
+        for(auto const* o : obj->get_child_objects())
+            collect(o, mod);
+    };
+    for(auto const* o : sc_core::sc_get_top_level_objects())
+        collect(o, nullptr);
+    // a sample accounts for the time since the previous one
+    auto const count = smpl->count.load();
+    auto last_wall = origin.wall_clock_stamp;
+    auto last_cpu = origin.proc_clock_stamp;
+    sc_core::sc_module const* last_mod{nullptr};
+    unsigned last_phase{0};
+    for(size_t i = 0; i < count; ++i) {
+        auto const& s = smpl->samples[i];
+        auto const wall = boost::posix_time::from_time_t(s.wall.tv_sec) + boost::posix_time::microseconds(s.wall.tv_nsec / 1000);
+        auto const cpu = s.cpu.tv_sec + s.cpu.tv_nsec * 1e-9;
+        auto const wall_delta = wall - last_wall;
+        auto const cpu_delta = cpu - last_cpu;
+        auto const slice_start = last_wall - origin.wall_clock_stamp;
+        last_wall = wall;
+        last_cpu = cpu;
+        auto it = modules.find(s.obj);
+        auto const* mod = it != modules.end() ? it->second : nullptr;
+        if(!mod || mod == this) {
+            last_mod = nullptr;
+            continue;
+        }
+        auto const category = "sampled:" + phases[s.phase].name;
+        sampled[std::make_pair(category, std::string(mod->name()))].self += wall_delta;
+        for(auto const* m = mod; m; m = dynamic_cast<sc_core::sc_module const*>(m->get_parent_object())) {
+            auto& a = sampled[std::make_pair(category, std::string(m->name()))];
+            a.count++;
+            a.total += wall_delta;
+            a.cpu += cpu_delta;
+        }
+        if(mod == last_mod && s.phase == last_phase)
+            sampled_slices.back().wall += wall_delta;
+        else
+            sampled_slices.push_back(record{category, mod->name(), slice_start, wall_delta, duration(), cpu_delta, 0, 0, 0});
+        last_mod = mod;
+        last_phase = s.phase;
+    }
+    if(count >= max_samples)
+        SCCWARN(SCMOD) << "The sample buffer overflowed, only the first " << max_samples << " samples are evaluated";
+    smpl.reset();
+}
+
+void startup_profiler::finish() {
+    stop_sampling();
+    begin_phase(nullptr);
+    evaluate_samples();
+    inst = nullptr;
+    if(report_file.empty()) {
+        std::ostringstream os;
+        write_report(os);
+        SCCINFO(SCMOD) << "startup profile:\n" << os.str();
+    } else {
+        std::ofstream ofs(report_file);
+        if(ofs.is_open())
+            write_report(ofs, util::ends_with(report_file, ".csv"));
+        else
+            SCCWARN(SCMOD) << "Could not open " << report_file;
+    }
+    if(trace_file.size()) {
+        std::ofstream ofs(trace_file);
+        if(ofs.is_open())
+            write_chrome_trace(ofs);
+        else
+            SCCWARN(SCMOD) << "Could not open " << trace_file;
+    }
+}
+
+void startup_profiler::write_report(std::ostream& os, bool csv) const {
+    std::map<std::pair<std::string, std::string>, aggregate> entries(tallies);
+    entries.insert(sampled.begin(), sampled.end());
+    for(auto const* recs : {&phases, &scopes})
+        for(auto const& r : *recs) {
+            auto& a = entries[std::make_pair(r.category, r.name)];
+            a.count++;
+            a.total += r.wall;
+            a.self += r.wall - r.child_wall;
+            a.cpu += r.cpu;
+            a.heap += r.heap_delta;
+        }
+    std::vector<std::pair<std::pair<std::string, std::string>, aggregate>> sorted(entries.begin(), entries.end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](std::pair<std::pair<std::string, std::string>, aggregate> const& a,
+                                                      std::pair<std::pair<std::string, std::string>, aggregate> const& b) {
+        return a.second.total > b.second.total;
+    });
+    if(csv)
+        os << "category,name,count,total_ms,self_ms,cpu_ms,heap_kB\n";
+    else
+        os << fmt::format("{:<40} {:>8} {:>12} {:>12} {:>12} {:>12}  {}\n", "category", "count", "total[ms]", "self[ms]", "cpu[ms]",
+                          "heap[kB]", "name");
+    for(auto const& e : sorted) {
+        auto const& a = e.second;
+        if(csv)
+            os << fmt::format("{},\"{}\",{},{:.3f},{:.3f},{:.3f},{}\n", e.first.first, e.first.second, a.count, to_ms(a.total),
+                              to_ms(a.self), a.cpu * 1000, a.heap / 1024);
+        else
+            os << fmt::format("{:<40} {:>8} {:>12.3f} {:>12.3f} {:>12.3f} {:>12}  {}\n", e.first.first, a.count, to_ms(a.total),
+                              to_ms(a.self), a.cpu * 1000, a.heap / 1024, e.first.second);
+    }
+}
+
+void startup_profiler::write_chrome_trace(std::ostream& os) const {
+    rapidjson::OStreamWrapper stream(os);
+    rapidjson::Writer<rapidjson::OStreamWrapper> writer(stream);
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    unsigned tid = 0;
+    for(auto const* track : {"phases", "scopes", "sampled modules"}) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String("thread_name");
+        writer.Key("ph");
+        writer.String("M");
+        writer.Key("pid");
+        writer.Uint(1);
+        writer.Key("tid");
+        writer.Uint(tid++);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(track);
+        writer.EndObject();
+        writer.EndObject();
+    }
+    tid = 0;
+    for(auto const* recs : {&phases, &scopes, &sampled_slices}) {
+        for(auto const& r : *recs) {
+            writer.StartObject();
+            writer.Key("name");
+            writer.String(r.name.c_str());
+            writer.Key("cat");
+            writer.String(r.category.c_str());
+            writer.Key("ph");
+            writer.String("X");
+            writer.Key("ts");
+            writer.Int64(to_us(r.start));
+            writer.Key("dur");
+            writer.Int64(to_us(r.wall));
+            writer.Key("pid");
+            writer.Uint(1);
+            writer.Key("tid");
+            writer.Uint(tid);
+            writer.Key("args");
+            writer.StartObject();
+            writer.Key("heap_kB");
+            writer.Int64(r.heap_delta / 1024);
+            writer.EndObject();
+            writer.EndObject();
+        }
+        ++tid;
+    }
+    writer.EndArray();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.EndObject();
+    os << "\n";
+}
+
+int64_t startup_profiler::heap_size() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    auto mi = mallinfo2();
+    return static_cast<int64_t>(mi.uordblks + mi.hblkhd);
+#elif defined(__GLIBC__)
+    auto mi = mallinfo();
+    return static_cast<int64_t>(static_cast<unsigned>(mi.uordblks)) + static_cast<unsigned>(mi.hblkhd);
+#else
+    return 0;
+#endif
+}
+} // namespace scc
@@ -0,0 +1,249 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SCC_STARTUP_PROFILER_H_
+#define _SCC_STARTUP_PROFILER_H_
+
+#include "perf_estimator.h"
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <systemc>
+#include <utility>
+#include <vector>
+
+/** \ingroup scc-sysc
+ *  @{
+ */
+/**@{*/
+//! @brief SCC SystemC utilities
+namespace scc {
+/**
+ * @class startup_profiler
+ * @brief profiles the wall clock time, process time and heap growth from construction until the start of the simulation
+ *
+ * The profiler records using the time stamps of the @ref scc::perf_estimator
+ * - the phases construction, before_end_of_elaboration, binding, end_of_elaboration, the time spent in sc_main
+ *   before sc_start() and start_of_simulation
+ * - scopes like the loading of the configuration, broker lookups, the descent of the tracer thru the hierarchy or the
+ *   scan of the hierarchy_dumper
+ * - the constructors and the elaboration callbacks of all modules by periodically sampling the module being active.
+ *   The samples are reported per phase as self time of the module and total time including its submodules. No heap
+ *   growth is attributed to them.
+ * - the exact time and heap growth of the constructors and the elaboration callbacks of modules being wrapped with
+ *   @ref scc::profiled
+ *
+ * Like in the @ref scc::process_profiler the sampling uses a timer signal delivered to the elaborating thread (Linux
+ * only). It uses SIGRTMIN instead of SIGPROF since both profilers record during start_of_simulation().
+ *
+ * Like the perf_estimator it needs to be instantiated in sc_main() before the design, so that its callbacks are
+ * called before the ones of all other modules. After start_of_simulation() it writes a report aggregated by scope and
+ * sorted by wall clock time (as CSV if the file name ends with .csv) and optionally a trace in the Chrome trace event
+ * format which can be viewed using chrome://tracing or Perfetto. Recording stops afterwards.
+ */
+class startup_profiler : public sc_core::sc_module, public sc_core::sc_stage_callback_if {
+public:
+    using time_stamp = perf_estimator::time_stamp;
+    using duration = boost::posix_time::time_duration;
+    /**
+     * @class scope
+     * @brief records the time and heap growth between its construction and end() resp. its destruction
+     *
+     * Scopes need to be used from the SystemC thread and nest properly. If no profiler is active they do nothing.
+     */
+    class scope {
+    public:
+        scope(char const* category, std::string const& name);
+
+        scope(const scope&) = delete;
+
+        scope& operator=(const scope&) = delete;
+
+        ~scope() { end(); }
+        //! changes the name of the scope, e.g. if it is only known at the end
+        void set_name(std::string const& name);
+        //! ends the scope before its destruction
+        void end();
+
+    private:
+        startup_profiler* prof;
+        size_t idx{0};
+    };
+    /**
+     * @class tally
+     * @brief accumulates the time of frequent, short operations like broker lookups
+     *
+     * The operations are only counted and reported as sum, no heap growth is measured and no trace event is created.
+     */
+    class tally {
+    public:
+        tally(char const* category, char const* name)
+        : prof(inst)
+        , category(category)
+        , name(name) {
+            if(prof)
+                start.set();
+        }
+
+        tally(const tally&) = delete;
+
+        tally& operator=(const tally&) = delete;
+
+        ~tally() {
+            if(prof && prof == inst)
+                prof->add_tally(category, name, start);
+        }
+
+    private:
+        startup_profiler* prof;
+        char const* category;
+        char const* name;
+        time_stamp start{no_stamp()};
+    };
+    /**
+     * @fn  startup_profiler(const std::string&, const std::string&, unsigned)
+     * @brief constructs the profiler and starts recording
+     *
+     * @param report_file the name of the report file, if empty the report is logged
+     * @param trace_file the name of the Chrome trace file, no trace is written if empty
+     * @param sampling_interval_us the interval of sampling the active module in microseconds of process time, 0
+     * disables the sampling
+     */
+    startup_profiler(std::string const& report_file = "", std::string const& trace_file = "", unsigned sampling_interval_us = 1000);
+
+    startup_profiler(const startup_profiler&) = delete;
+
+    startup_profiler& operator=(const startup_profiler&) = delete;
+
+    ~startup_profiler();
+    /**
+     * @fn void write_report(std::ostream&, bool)const
+     * @brief writes the recorded scopes aggregated by category and name, sorted by their total time
+     *
+     * @param os the output stream
+     * @param csv write comma separated values instead of a table
+     */
+    void write_report(std::ostream& os, bool csv = false) const;
+    /**
+     * @fn void write_chrome_trace(std::ostream&)const
+     * @brief writes the recorded phases and scopes in the Chrome trace event format
+     *
+     * @param os the output stream
+     */
+    void write_chrome_trace(std::ostream& os) const;
+    /**
+     * @fn startup_profiler* get()
+     * @brief returns the profiler currently recording
+     *
+     * @return pointer to the profiler or nullptr if none is recording
+     */
+    static startup_profiler* get() { return inst; }
+
+protected:
+    void before_end_of_elaboration() override;
+    void end_of_elaboration() override;
+    void start_of_simulation() override;
+    void stage_callback(const sc_core::sc_stage& stage) override;
+
+private:
+    struct record {
+        std::string category;
+        std::string name;
+        duration start, wall, child_wall;
+        double cpu;
+        int64_t heap_start, heap_delta;
+        unsigned depth;
+    };
+    struct aggregate {
+        uint64_t count{0};
+        duration total, self;
+        double cpu{0};
+        int64_t heap{0};
+    };
+    //! the state of the sampling of the active module
+    struct sampler;
+    //! a time stamp not being taken to avoid the overhead if no profiler is active
+    static time_stamp const& no_stamp();
+    void begin_phase(char const* name);
+    void end_record(record& r, time_stamp const& now, int64_t heap) const;
+    void add_tally(char const* category, char const* name, time_stamp const& start);
+    void start_sampling(unsigned interval_us);
+    void stop_sampling();
+    void evaluate_samples();
+    void finish();
+    static int64_t heap_size();
+
+    static startup_profiler* inst;
+    std::string const report_file, trace_file;
+    time_stamp const origin;
+    std::vector<record> phases;
+    std::vector<record> scopes;
+    std::vector<size_t> open_scopes;
+    std::map<std::pair<std::string, std::string>, aggregate> tallies;
+    //! the samples aggregated per phase and module
+    std::map<std::pair<std::string, std::string>, aggregate> sampled;
+    //! the consecutive samples of the same phase and module
+    std::vector<record> sampled_slices;
+    std::unique_ptr<sampler> smpl;
+    bool registered{false};
+};
+namespace impl {
+//! the base of profiled being constructed before the wrapped module
+struct ctor_scope {
+    startup_profiler::scope ctor;
+    ctor_scope(char const* name)
+    : ctor("constructor", name) {}
+};
+} // namespace impl
+/**
+ * @class profiled
+ * @brief a module wrapper recording the constructor and the elaboration callbacks of a module with the
+ * @ref scc::startup_profiler
+ *
+ * Usage: scc::profiled<my_module> inst{"inst", args...}; instead of my_module inst{"inst", args...};
+ * The callbacks of MODULE need to be accessible (protected or public).
+ *
+ * @tparam MODULE the module type, its constructor needs to take the sc_module_name as first argument
+ */
+template <typename MODULE> class profiled : private impl::ctor_scope, public MODULE {
+public:
+    template <typename... ARGS>
+    profiled(sc_core::sc_module_name const& nm, ARGS&&... args)
+    : impl::ctor_scope(static_cast<char const*>(nm))
+    , MODULE(nm, std::forward<ARGS>(args)...) {
+        impl::ctor_scope::ctor.set_name(this->name());
+        impl::ctor_scope::ctor.end();
+    }
+
+protected:
+    void before_end_of_elaboration() override {
+        startup_profiler::scope s("before_end_of_elaboration", this->name());
+        MODULE::before_end_of_elaboration();
+    }
+    void end_of_elaboration() override {
+        startup_profiler::scope s("end_of_elaboration", this->name());
+        MODULE::end_of_elaboration();
+    }
+    void start_of_simulation() override {
+        startup_profiler::scope s("start_of_simulation", this->name());
+        MODULE::start_of_simulation();
+    }
+};
+} // namespace scc
+/** @} */ // end of scc-sysc
+#endif /* _SCC_STARTUP_PROFILER_H_ */
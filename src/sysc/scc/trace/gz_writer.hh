@@ -10,13 +10,14 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstring>
 #include <deque>
 #include <mutex>
 #include <rigtorp/SPSCQueue.h>
 #include <string>
 #include <thread>
-#include <zlib.h>
+#include <util/gzip_streambuf.h>
 
 namespace scc {
 namespace trace {
@@ -29,7 +30,7 @@ class gz_writer {
     std::condition_variable cond;
 
     std::deque<char*> pool_buffer;
-    gzFile vcd_out{nullptr};
+    util::gzip_ostreambuf vcd_out;
     std::thread logger;
 
     inline void write_out() {
@@ -38,7 +39,7 @@ class gz_writer {
             write_queue.pop_front();
             auto len = strlen(value);
             if(len)
-                gzwrite(vcd_out, value, strlen(value));
+                vcd_out.sputn(value, len);
             memset(value, 0, buffer_size);
             pool.push_back(value);
         }
@@ -67,8 +68,16 @@ public:
     std::mutex writer_mtx;
     using lock_type = std::unique_lock<std::mutex>;
     static const size_t buffer_size = 512;
-    gz_writer(std::string const& filename) {
-        vcd_out = gzopen(filename.c_str(), "w3");
+    /**
+     * @brief opens a gzip compressed output file
+     *
+     * @param filename the name of the file to write
+     * @param level the gzip compression level
+     * @param threads if not 0 the output is compressed as independent gzip members on the given number of threads
+     * @param buf_size the size of the blocks being compressed
+     */
+    gz_writer(std::string const& filename, int level = 3, unsigned threads = 0, size_t buf_size = 1024 * 1024)
+    : vcd_out(filename, level, threads, buf_size) {
         logger = std::thread([this]() { log(); });
         enlarge_pool();
     }
@@ -80,11 +89,11 @@ public:
             write("");
         }
         logger.join();
-        gzclose(vcd_out);
+        vcd_out.close();
         char* value;
         pool.clear();
         for(auto b : pool_buffer)
-            delete b;
+            delete[] b;
     }
 
     inline void write_single(std::string const& msg) {
@@ -18,15 +18,21 @@
 
 #include "types.hh"
 #ifndef FWRITE
-#include <cstdio>
-#define FWRITE(BUF, SZ, LEN, FP) std::fwrite(BUF, SZ, LEN, FP)
-#define FPTR FILE*
+#include <streambuf>
+#define FWRITE(BUF, SZ, LEN, FP) FP->sputn(BUF, (SZ) * (LEN))
+#define FPTR std::streambuf*
 #endif
+#include <cstdlib>
 #include <fmt/format.h>
+#include <fstream>
+#include <memory>
 #include <scc/utilities.h>
 #include <unordered_map>
 #include <util/ities.h>
 #include <vector>
+#ifdef HAS_ZLIB
+#include <util/gzip_streambuf.h>
+#endif
 
 namespace scc {
 namespace trace {
@@ -51,6 +57,29 @@ template <typename T> inline void vcdEmitValueChangeReal(FPTR os, std::string co
     FWRITE(buf.c_str(), 1, buf.size(), os);
 }
 
+/**
+ * @brief opens the output of a VCD trace file
+ *
+ * If the environment variable SCC_VCD_COMPRESSION_LEVEL is set to a level of 1 to 9 the output is written gzip compressed
+ * to name.vcd.gz, SCC_VCD_COMPRESSION_THREADS sets the number of threads compressing in parallel (see
+ * util::gzip_ostreambuf). Otherwise, and if SCC is built without zlib, the output is written to name.vcd.
+ *
+ * @param name the base name of the file
+ */
+inline std::unique_ptr<std::streambuf> create_vcd_streambuf(std::string const& name) {
+#ifdef HAS_ZLIB
+    auto* level = getenv("SCC_VCD_COMPRESSION_LEVEL");
+    if(level && atoi(level) > 0) {
+        auto* threads = getenv("SCC_VCD_COMPRESSION_THREADS");
+        return scc::make_unique<util::gzip_ostreambuf>(fmt::format("{}.vcd.gz", name), std::min(atoi(level), 9),
+                                                       threads ? strtoul(threads, nullptr, 0) : 0);
+    }
+#endif
+    auto buf = scc::make_unique<std::filebuf>();
+    buf->open(fmt::format("{}.vcd", name), std::ios::out | std::ios::trunc);
+    return buf;
+}
+
 inline size_t get_buffer_size(int length) {
     size_t sz = (static_cast<size_t>(length) + 4096) & (~static_cast<size_t>(4096 - 1));
     return std::max<uint64_t>(1024UL, sz);
@@ -24,6 +24,7 @@
 #include "report.h"
 #include "sc_vcd_trace.h"
 #include "scv/scv_tr_db.h"
+#include "startup_profiler.h"
 #include "utilities.h"
 #include <scc/sc_vcd_trace.h>
 #include <scc/trace.h>
@@ -114,7 +115,13 @@ void tracer::init_tx_db(file_type type, std::string const&& name) {
                 SCVNS scv_tr_plain_init();
                 break;
             case 2:
-                SCVNS scv_tr_compressed_init();
+#ifdef HAS_ZLIB
+                // compress on worker threads if requested
+                if(getenv("SCC_SCV_TR_COMPRESSION_THREADS"))
+                    SCVNS scv_tr_gzip_init();
+                else
+#endif
+                    SCVNS scv_tr_compressed_init();
                 break;
             default:
                 SCVNS scv_tr_lz4_init();
@@ -144,6 +151,10 @@ void tracer::init_tx_db(file_type type, std::string const&& name) {
             SCVNS scv_tr_mtc_init();
             ss << ".txlog";
             break;
+        case CHUNKED:
+            SCVNS scv_tr_chunked_init();
+            ss << ".txlog";
+            break;
         }
         if(type == LWFTR || type == LWCFTR) {
             lwtr_db = new lwtr::tx_db(name.c_str());
@@ -158,6 +169,7 @@ void tracer::init_tx_db(file_type type, std::string const&& name) {
 
 void tracer::end_of_elaboration() {
     if(trf) {
+        startup_profiler::scope profile("tracer", "descend");
         for(auto o : sc_get_top_level_objects())
             descend(o, default_trace_enable_handle.get_cci_value().get<bool>());
     }
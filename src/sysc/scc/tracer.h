@@ -55,6 +55,12 @@ public:
      * @brief defines the transaction trace output type
      *
      * CUSTOM means the caller needs to initialize the database driver (scv_tr_text_init() or alike)
+     * CHUNKED writes independently compressed chunks with a trailing time and stream index allowing to seek
+     * COMPRESSED uses LZ4 unless SCC_SCV_TR_COMPRESSION_LEVEL selects plain text (0) or gzip (2). Setting
+     * SCC_SCV_TR_COMPRESSION_THREADS compresses gzip on the given number of threads (see scv_tr_gzip_init()).
+     *
+     * PULL_VCD and PUSH_VCD write gzip compressed files if SCC_VCD_COMPRESSION_LEVEL is set (see
+     * trace::create_vcd_streambuf()), FST compresses on a separate thread if SCC_FST_PARALLEL_WRITER is set to 1.
      */
     enum file_type {
         NONE,
@@ -67,6 +73,7 @@ public:
         LWFTR,
         LWCFTR,
         CUSTOM,
+        CHUNKED,
         SC_VCD = TEXT,
         PULL_VCD = COMPRESSED,
         PUSH_VCD = SQLITE,
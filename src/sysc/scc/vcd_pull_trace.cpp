@@ -32,12 +32,12 @@
 #define FPRINT(FP, FMTSTR)                                                                                                                 \
     {                                                                                                                                      \
         auto buf = fmt::format(FMTSTR);                                                                                                    \
-        std::fwrite(buf.c_str(), 1, buf.size(), FP);                                                                                       \
+        FP->sputn(buf.c_str(), buf.size());                                                                                                \
     }
 #define FPRINTF(FP, FMTSTR, ...)                                                                                                           \
     {                                                                                                                                      \
         auto buf = fmt::format(FMTSTR, __VA_ARGS__);                                                                                       \
-        std::fwrite(buf.c_str(), 1, buf.size(), FP);                                                                                       \
+        FP->sputn(buf.c_str(), buf.size());                                                                                                \
     }
 
 namespace scc {
@@ -47,7 +47,7 @@ namespace scc {
 vcd_pull_trace_file::vcd_pull_trace_file(const char* name, std::function<bool()>& enable)
 : name(name)
 , check_enabled(enable) {
-    vcd_out = fopen(fmt::format("{}.vcd", name).c_str(), "w");
+    vcd_out = trace::create_vcd_streambuf(name);
 
 #if SC_VERSION_MAJOR < 3
 #if defined(WITH_SC_TRACING_PHASE_CALLBACKS)
@@ -64,7 +64,7 @@ vcd_pull_trace_file::vcd_pull_trace_file(const char* name, std::function<bool()>
 vcd_pull_trace_file::~vcd_pull_trace_file() {
     if(vcd_out) {
         FPRINTF(vcd_out, "#{}\n", sc_core::sc_time_stamp() / 1_ps);
-        fclose(vcd_out);
+        vcd_out.reset();
     }
     for(auto t : all_traces)
         delete t.trc;
@@ -194,7 +194,7 @@ void vcd_pull_trace_file::init() {
     std::stringstream ss;
     ss << "tracing " << active_traces.size() << " distinct traces out of " << all_traces.size() << " traces";
     write_comment(ss.str());
-    scope.print(vcd_out);
+    scope.print(vcd_out.get());
 }
 
 std::string vcd_pull_trace_file::prune_name(std::string const& orig_name) {
@@ -233,7 +233,7 @@ void vcd_pull_trace_file::cycle(bool delta_cycle) {
         FPRINT(vcd_out, "$enddefinitions  $end\n\n$dumpvars\n");
         for(auto& e : active_traces) {
             e.compare_and_update(e.trc);
-            e.trc->record(vcd_out);
+            e.trc->record(vcd_out.get());
         }
         FPRINT(vcd_out, "$end\n\n");
     } else {
@@ -247,7 +247,7 @@ void vcd_pull_trace_file::cycle(bool delta_cycle) {
         if(changed_traces.size()) {
             FPRINTF(vcd_out, "#{}\n", sc_core::sc_time_stamp() / 1_ps);
             for(auto& t : changed_traces)
-                t->record(vcd_out);
+                t->record(vcd_out.get());
         }
     }
 }
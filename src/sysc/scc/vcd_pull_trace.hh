@@ -18,7 +18,9 @@
 #define SCC_VCD_PULL_TRACE_H
 
 #include <functional>
+#include <memory>
 #include <sysc/kernel/sc_ver.h>
+#include <streambuf>
 #include <sysc/tracing/sc_trace.h>
 #include <vector>
 
@@ -105,7 +107,7 @@ private:
     std::string obtain_name();
     std::function<bool()> check_enabled;
 
-    FILE* vcd_out{nullptr};
+    std::unique_ptr<std::streambuf> vcd_out;
     struct trace_entry {
         bool (*compare_and_update)(trace::vcd_trace*);
         trace::vcd_trace* trc;
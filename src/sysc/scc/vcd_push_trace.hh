@@ -19,8 +19,10 @@
 
 #include <deque>
 #include <functional>
+#include <memory>
 #include <scc/observer.h>
 #include <sysc/kernel/sc_ver.h>
+#include <streambuf>
 #include <sysc/tracing/sc_trace.h>
 #include <vector>
 
@@ -137,7 +139,7 @@ private:
     std::string obtain_name();
     std::function<bool()> check_enabled;
 
-    FILE* vcd_out{nullptr};
+    std::unique_ptr<std::streambuf> vcd_out;
     struct trace_entry : public observer::notification_handle {
         bool (*compare_and_update)(trace::vcd_trace*);
         trace::vcd_trace* trc;
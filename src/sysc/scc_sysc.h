@@ -30,12 +30,15 @@
 #include "scc/mt19937_rng.h"
 #include "scc/ordered_semaphore.h"
 #include "scc/peq.h"
+#include "scc/perf_counter.h"
 #include "scc/perf_estimator.h"
+#include "scc/process_profiler.h"
 #include "scc/report.h"
 #include "scc/sc_logic_7.h"
 #include "scc/sc_owning_signal.h"
 #include "scc/sc_variable.h"
 #include "scc/sc_vcd_trace.h"
+#include "scc/startup_profiler.h"
 #include "scc/scv/scv_tr_db.h"
 #include "scc/tick2time.h"
 #include "scc/time2tick.h"
@@ -55,6 +58,7 @@
 #include "tlm/scc/scv/tlm_recording_extension.h"
 
 #include "tlm/scc/initiator_mixin.h"
+#include "tlm/scc/socket_stats.h"
 #include "tlm/scc/tlm2_pv_av.h"
 #include "tlm/scc/tlm_extensions.h"
 #include "tlm/scc/tlm_id.h"
@@ -0,0 +1,57 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _TLM_SCC_ATOMIC_EXTENSION_H_
+#define _TLM_SCC_ATOMIC_EXTENSION_H_
+
+#include <cstdint>
+#include <tlm>
+#include <util/atomic_memory.h>
+
+//! @brief SystemC TLM
+namespace tlm {
+//! @brief SCC TLM utilities
+namespace scc {
+/**
+ * @brief marks a transaction as atomic memory operation (AMO, LR/SC or exclusive access)
+ *
+ * The data length needs to be 1, 2, 4 or 8 and the address needs to be naturally aligned. The data buffer holds the
+ * operand in host byte order and receives the value of the location before the operation. LOAD_RESERVED is sent as
+ * read command, all other operations as write command. For STORE_CONDITIONAL and COMPARE_SWAP the target sets
+ * success to indicate if the value has been stored.
+ */
+struct atomic_extension : tlm::tlm_extension<atomic_extension> {
+    tlm_extension_base* clone() const override { return new atomic_extension(*this); }
+    void copy_from(tlm_extension_base const& from) override { *this = static_cast<atomic_extension const&>(from); }
+
+    atomic_extension() = default;
+
+    atomic_extension(util::amo_e op, unsigned initiator_id = 0, uint64_t compare = 0)
+    : op(op)
+    , initiator_id(initiator_id)
+    , compare(compare) {}
+    //! the operation to perform
+    util::amo_e op{util::amo_e::SWAP};
+    //! the id of the initiator owning a reservation
+    unsigned initiator_id{0};
+    //! the value expected at the location for COMPARE_SWAP
+    uint64_t compare{0};
+    //! the result of a STORE_CONDITIONAL or COMPARE_SWAP
+    bool success{false};
+};
+} // namespace scc
+} // namespace tlm
+#endif // _TLM_SCC_ATOMIC_EXTENSION_H_
@@ -0,0 +1,222 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "bulk_loader.h"
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <scc/report.h>
+#include <sstream>
+#include <stdexcept>
+#include <util/ihex.h>
+#include <util/mmap_region.h>
+#include <util/thread_pool.h>
+
+namespace tlm {
+namespace scc {
+namespace {
+//! the size of the pieces being written in parallel
+constexpr uint64_t direct_chunk_size = 16 * 1024 * 1024;
+//! the maximum size of a single debug transaction
+constexpr uint64_t dbg_chunk_size = 64 * 1024;
+
+char const elf_magic[] = {0x7f, 'E', 'L', 'F'};
+enum { ELF_CLASS32 = 1, ELF_CLASS64 = 2, ELF_DATA2LSB = 1, ET_EXEC = 2, ET_DYN = 3, PT_LOAD = 1 };
+
+struct elf_reader {
+    const uint8_t* base;
+    uint64_t size;
+    bool little_endian;
+
+    uint64_t get(uint64_t offs, unsigned bytes) const {
+        if(offs + bytes > size)
+            throw std::runtime_error("ELF file is truncated");
+        uint64_t ret = 0;
+        for(auto i = 0U; i < bytes; ++i) {
+            auto shift = little_endian ? 8 * i : 8 * (bytes - 1 - i);
+            ret |= static_cast<uint64_t>(base[offs + i]) << shift;
+        }
+        return ret;
+    }
+};
+} // namespace
+
+void bulk_loader::collect(memory_node const& node) {
+    if(node.direct_write) {
+        targets.push_back(target{node.start, node.end, &node});
+        return;
+    }
+    for(auto const& e : node.elemets)
+        collect(e);
+}
+
+bool bulk_loader::write_dbg(job const& j) {
+    for(uint64_t pos = 0; pos < j.len;) {
+        auto count = static_cast<unsigned>(std::min(j.len - pos, dbg_chunk_size));
+        auto written = dbg_write(j.addr + pos, count, j.data + pos);
+        if(!written)
+            return false;
+        pos += written;
+    }
+    return true;
+}
+
+bool bulk_loader::execute(std::vector<job> const& jobs) {
+    std::vector<job> direct, serial;
+    std::vector<memory_node const*> direct_nodes;
+    for(auto j : jobs) {
+        while(j.len) {
+            auto it = std::upper_bound(targets.begin(), targets.end(), j.addr, [](uint64_t a, target const& t) { return a < t.start; });
+            uint64_t count = j.len;
+            if(it != targets.begin() && std::prev(it)->end >= j.addr) {
+                auto const& t = *std::prev(it);
+                if(t.end - j.addr < j.len - 1)
+                    count = t.end - j.addr + 1;
+                count = std::min(count, direct_chunk_size);
+                direct.push_back(job{j.addr - t.start + t.node->target_start, count, j.data});
+                direct_nodes.push_back(t.node);
+            } else {
+                if(it != targets.end() && it->start - j.addr < j.len)
+                    count = it->start - j.addr;
+                serial.push_back(job{j.addr, count, j.data});
+            }
+            j.addr += count;
+            j.data += count;
+            j.len -= count;
+        }
+    }
+    std::vector<std::future<bool>> results;
+    results.reserve(direct.size());
+    if(direct.size() > 1 && threads > 1) {
+        util::thread_pool pool;
+        pool.start(std::min<size_t>(threads, direct.size()));
+        for(size_t i = 0; i < direct.size(); ++i) {
+            auto const& j = direct[i];
+            auto node = direct_nodes[i];
+            results.push_back(pool.enqueue([j, node]() -> bool { return node->direct_write(j.addr, j.len, j.data); }));
+        }
+        for(auto& r : results)
+            r.wait();
+    } else {
+        for(size_t i = 0; i < direct.size(); ++i) {
+            std::promise<bool> p;
+            p.set_value(direct_nodes[i]->direct_write(direct[i].addr, direct[i].len, direct[i].data));
+            results.push_back(p.get_future());
+        }
+    }
+    auto ret = true;
+    for(size_t i = 0; i < direct.size(); ++i)
+        if(!results[i].get()) {
+            SCCWARN("bulk_loader") << "Direct write of 0x" << std::hex << direct[i].len << " bytes to " << direct_nodes[i]->name
+                                   << " failed, falling back to debug transactions";
+            auto const& j = direct[i];
+            auto node = direct_nodes[i];
+            // convert the target address back into the address seen by the initiator
+            ret &= write_dbg(job{j.addr - node->target_start + node->start, j.len, j.data});
+        }
+    for(auto const& j : serial)
+        if(!write_dbg(j)) {
+            SCCERR("bulk_loader") << "Could not write 0x" << std::hex << j.len << " bytes to address 0x" << j.addr;
+            ret = false;
+        }
+    return ret;
+}
+
+bool bulk_loader::write(uint64_t addr, uint64_t len, const uint8_t* data) { return execute({job{addr, len, data}}); }
+
+uint64_t bulk_loader::load_elf(std::string const& name, uint8_t expected_elf_class, uint16_t expected_elf_machine) {
+    util::mmap_region file(name, false, 0, 0, true);
+    elf_reader elf{file.data(), file.size(), true};
+    if(file.size() < 16 || memcmp(file.data(), elf_magic, sizeof(elf_magic)))
+        throw std::runtime_error(name + " is not an ELF file");
+    auto elf_class = file.data()[4];
+    elf.little_endian = file.data()[5] == ELF_DATA2LSB;
+    if(elf_class != ELF_CLASS32 && elf_class != ELF_CLASS64)
+        throw std::runtime_error("Unknown ELF class");
+    if(expected_elf_class && elf_class != expected_elf_class)
+        throw std::runtime_error("ELF Class missmatch");
+    auto type = elf.get(16, 2);
+    if(type != ET_EXEC && type != ET_DYN)
+        throw std::runtime_error("Input is neither an executable nor a pie executable (dyn)");
+    if(expected_elf_machine && elf.get(18, 2) != expected_elf_machine)
+        throw std::runtime_error("ELF Machine type missmatch");
+    auto const is64 = elf_class == ELF_CLASS64;
+    auto const word = is64 ? 8U : 4U;
+    auto entry = elf.get(24, word);
+    auto phoff = elf.get(is64 ? 32 : 28, word);
+    auto phentsize = elf.get(is64 ? 54 : 42, 2);
+    auto phnum = elf.get(is64 ? 56 : 44, 2);
+    std::vector<job> jobs;
+    for(uint64_t i = 0; i < phnum; ++i) {
+        auto ph = phoff + i * phentsize;
+        if(elf.get(ph, 4) != PT_LOAD)
+            continue;
+        auto offset = is64 ? elf.get(ph + 8, 8) : elf.get(ph + 4, 4);
+        auto paddr = is64 ? elf.get(ph + 24, 8) : elf.get(ph + 12, 4);
+        auto filesz = is64 ? elf.get(ph + 32, 8) : elf.get(ph + 16, 4);
+        if(!filesz)
+            continue;
+        if(offset > file.size() || filesz > file.size() - offset)
+            throw std::runtime_error("ELF segment exceeds the file size");
+        jobs.push_back(job{paddr, filesz, file.data() + offset});
+    }
+    if(!execute(jobs)) {
+        std::ostringstream oss;
+        oss << "Problem writing segments of " << name;
+        throw std::runtime_error(oss.str());
+    }
+    return entry;
+}
+
+bool bulk_loader::load_ihex(std::string const& name) {
+    std::ifstream is(name);
+    if(!is.is_open())
+        return false;
+    // contiguous records are merged into blocks, a deque keeps the references stable
+    std::deque<std::vector<uint8_t>> blocks;
+    std::vector<uint64_t> block_addr;
+    auto res = util::ihex::parse(is, [&blocks, &block_addr](uint64_t addr, uint64_t len, const uint8_t* data) -> bool {
+        if(blocks.empty() || block_addr.back() + blocks.back().size() != addr) {
+            blocks.emplace_back();
+            block_addr.push_back(addr);
+        }
+        blocks.back().insert(blocks.back().end(), data, data + len);
+        return true;
+    });
+    if(!res)
+        return false;
+    std::vector<job> jobs;
+    jobs.reserve(blocks.size());
+    for(size_t i = 0; i < blocks.size(); ++i)
+        jobs.push_back(job{block_addr[i], blocks[i].size(), blocks[i].data()});
+    return execute(jobs);
+}
+
+uint64_t bulk_loader::load_binary(std::string const& name, uint64_t addr) {
+    std::unique_ptr<util::mmap_region> file;
+    try {
+        file.reset(new util::mmap_region(name, false, 0, 0, true));
+    } catch(std::runtime_error& e) {
+        SCCERR("bulk_loader") << "Cannot load " << name << ": " << e.what();
+        return 0;
+    }
+    return execute({job{addr, file->size(), file->data()}}) ? file->size() : 0;
+}
+} // namespace scc
+} // namespace tlm
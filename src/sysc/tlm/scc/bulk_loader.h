@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _TLM_SCC_BULK_LOADER_H_
+#define _TLM_SCC_BULK_LOADER_H_
+
+#include "memory_map_collector.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+//! @brief SystemC TLM
+namespace tlm {
+//! @brief SCC TLM utilities
+namespace scc {
+/**
+ * @brief loads (large) images into the memories reachable from an initiator port
+ *
+ * The memory map is gathered once using the memory_map_collector mechanism. Data for memories providing a
+ * memory_node::direct_write function (e.g. scc::memory) is written directly into their backing store, the
+ * pieces are written in parallel on a thread pool. All other address ranges are written using debug transactions
+ * from the calling thread. Files are read using a memory mapping so that no additional copy is needed.
+ *
+ * Direct writes bypass any operation callback registered at a memory, similar to DMI accesses. The loader
+ * shall be used before the simulation starts or while the simulation is paused.
+ */
+class bulk_loader {
+public:
+    /**
+     * @brief constructs the loader and gathers the memory map
+     *
+     * @param port the port (socket) used to access the memories
+     * @param threads the number of threads used to write data, 0 uses the number of hardware threads
+     */
+    template <typename TYPES = tlm::tlm_base_protocol_types>
+    explicit bulk_loader(sc_core::sc_port_b<tlm::tlm_fw_transport_if<TYPES>>& port, unsigned threads = 0);
+    /**
+     * @brief writes a block of data
+     *
+     * @return true if all data could be written
+     */
+    bool write(uint64_t addr, uint64_t len, const uint8_t* data);
+    /**
+     * @brief loads the PT_LOAD segments of an ELF file to their physical addresses
+     *
+     * @param name the file name
+     * @param expected_elf_class the expected ELF class (1 for ELF32, 2 for ELF64), 0 accepts both
+     * @param expected_elf_machine the expected ELF machine, 0 accepts all
+     * @return the entry point address
+     */
+    uint64_t load_elf(std::string const& name, uint8_t expected_elf_class = 0, uint16_t expected_elf_machine = 0);
+    /**
+     * @brief loads an Intel hex file, contiguous records are written as one block
+     *
+     * @return true if the file could be parsed and written
+     */
+    bool load_ihex(std::string const& name);
+    /**
+     * @brief loads a raw binary file
+     *
+     * @param name the file name
+     * @param addr the address where to load the file to
+     * @return the number of bytes loaded
+     */
+    uint64_t load_binary(std::string const& name, uint64_t addr);
+    /**
+     * @brief returns the gathered memory map
+     */
+    memory_node const& memory_map() const { return root; }
+
+private:
+    struct target {
+        uint64_t start;
+        uint64_t end;
+        memory_node const* node;
+    };
+    struct job {
+        uint64_t addr;
+        uint64_t len;
+        const uint8_t* data;
+    };
+    void collect(memory_node const& node);
+    bool execute(std::vector<job> const& jobs);
+    bool write_dbg(job const& j);
+
+    memory_node root;
+    unsigned const threads;
+    std::function<unsigned(uint64_t, unsigned, const uint8_t*)> dbg_write;
+    std::vector<target> targets;
+};
+
+template <typename TYPES>
+bulk_loader::bulk_loader(sc_core::sc_port_b<tlm::tlm_fw_transport_if<TYPES>>& port, unsigned threads)
+: root(gather_memory(port))
+, threads(threads ? threads : std::max(1U, std::thread::hardware_concurrency()))
+, dbg_write([&port](uint64_t addr, unsigned len, const uint8_t* data) -> unsigned {
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_address(addr);
+    gp.set_data_ptr(const_cast<uint8_t*>(data));
+    gp.set_data_length(len);
+    gp.set_streaming_width(len);
+    return port->transport_dbg(gp);
+}) {
+    collect(root);
+    std::sort(targets.begin(), targets.end(), [](target const& a, target const& b) { return a.start < b.start; });
+}
+} // namespace scc
+} // namespace tlm
+#endif // _TLM_SCC_BULK_LOADER_H_
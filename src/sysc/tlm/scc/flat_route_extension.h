@@ -0,0 +1,118 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _TLM_SCC_FLAT_ROUTE_EXTENSION_H_
+#define _TLM_SCC_FLAT_ROUTE_EXTENSION_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <sysc/communication/sc_mutex.h>
+#include <tlm>
+#include <vector>
+
+//! @brief SystemC TLM
+namespace tlm {
+//! @brief SCC TLM utilities
+namespace scc {
+/**
+ * @brief an end-to-end route from an interconnect input to the final target
+ */
+struct flat_route {
+    //! the first address of the range
+    uint64_t start;
+    //! the last address of the range (inclusive)
+    uint64_t end;
+    //! the value to subtract from the address to get the address at the final target
+    uint64_t offset;
+    //! the forward interface of the final target, nullptr if the range is not mapped
+    tlm::tlm_fw_transport_if<tlm::tlm_base_protocol_types>* fw;
+    //! the mutexes of the interconnects along the path guarding the access to the final target, outermost first
+    std::vector<sc_core::sc_mutex*> mtxs;
+};
+/**
+ * @brief a sorted list of flat_route entries covering the whole 64bit address space
+ */
+using flat_route_table = std::vector<flat_route>;
+/**
+ * @brief finds the route for an address in O(log n), the table needs to cover the whole address space
+ */
+inline flat_route const& find_route(flat_route_table const& table, uint64_t addr) {
+    auto it = std::upper_bound(table.begin(), table.end(), addr, [](uint64_t a, flat_route const& r) { return a < r.start; });
+    return *(it - 1);
+}
+/**
+ * @brief the extension used to query the flattened routing table of an interconnect
+ *
+ * The extension is sent with a TLM_IGNORE_COMMAND debug transaction. An interconnect supporting fabric flattening
+ * fills in its routes as seen from the socket receiving the query. All other components ignore it and are
+ * treated as final targets.
+ */
+struct flat_route_extension : tlm::tlm_extension<flat_route_extension> {
+    tlm_extension_base* clone() const override { return new flat_route_extension(*this); }
+    void copy_from(tlm_extension_base const& from) override { throw std::runtime_error("copying of flat_route_extension not allowed"); }
+
+    flat_route_table routes;
+};
+/**
+ * @brief queries the flattened routing table of the target bound to an initiator port
+ *
+ * The routes refer to the interface bound to the port, hence accesses using them bypass the statistics of a
+ * tlm::scc::initiator_mixin.
+ *
+ * @param port the initiator port
+ * @return the routes of the connected interconnect or a single route to the connected target
+ */
+template <typename TYPES = tlm::tlm_base_protocol_types>
+flat_route_table query_flat_routes(sc_core::sc_port_b<tlm::tlm_fw_transport_if<TYPES>>& port) {
+    flat_route_extension ext;
+    tlm::tlm_generic_payload trans;
+    trans.set_command(tlm::TLM_IGNORE_COMMAND);
+    trans.set_extension(&ext);
+    port->transport_dbg(trans);
+    trans.set_extension<flat_route_extension>(nullptr);
+    if(ext.routes.empty())
+        return flat_route_table{flat_route{0, std::numeric_limits<uint64_t>::max(), 0, port.operator->(), {}}};
+    return std::move(ext.routes);
+}
+/**
+ * @brief adds the routes of a downstream table for the range [lo, hi] to a table
+ *
+ * @param table the table to extend
+ * @param child the table of the downstream component, it needs to cover the whole address space
+ * @param lo the first address of the range
+ * @param hi the last address of the range
+ * @param shift the value being subtracted from addresses when forwarding to the downstream component
+ * @param mtx the mutex guarding the access to the downstream component, it is locked before the ones of the child routes
+ */
+inline void add_flat_routes(flat_route_table& table, flat_route_table const& child, uint64_t lo, uint64_t hi, uint64_t shift,
+                            sc_core::sc_mutex* mtx = nullptr) {
+    auto const clo = lo - shift;
+    auto const chi = hi - shift;
+    for(auto it = std::upper_bound(child.begin(), child.end(), clo, [](uint64_t a, flat_route const& r) { return a < r.start; }) - 1;
+        it != child.end(); ++it) {
+        table.push_back(flat_route{std::max(it->start, clo) + shift, std::min(it->end, chi) + shift, it->offset + shift, it->fw, {}});
+        if(mtx)
+            table.back().mtxs.push_back(mtx);
+        table.back().mtxs.insert(table.back().mtxs.end(), it->mtxs.begin(), it->mtxs.end());
+        if(it->end >= chi)
+            break;
+    }
+}
+} // namespace scc
+} // namespace tlm
+#endif // _TLM_SCC_FLAT_ROUTE_EXTENSION_H_
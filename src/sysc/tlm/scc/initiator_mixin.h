@@ -18,6 +18,7 @@
 #define _TLM_SCC_INITIATOR_MIXIN_H_
 
 #include "scc/utilities.h"
+#include "socket_stats.h"
 #include <functional>
 #include <sstream>
 #include <tlm>
@@ -32,6 +33,9 @@ namespace scc {
  *
  * an initiator socket mixin adding default implementation of callback functions similar to tlm::simple_initiator_socket
  *
+ * If the library is built with ENABLE_TLM_STATS (defining WITH_TLM_STATS) the outgoing transactions issued thru
+ * operator->() are counted in a @ref tlm::scc::socket_stats, otherwise the statistics compile to nothing.
+ *
  * @tparam BASE_TYPE
  * @tparam TYPES
  */
@@ -56,9 +60,22 @@ public:
      */
     explicit initiator_mixin(const sc_core::sc_module_name& name)
     : BASE_TYPE(name)
-    , bw_if(this->name()) {
+    , bw_if(this->name())
+    , m_stats(this->name())
+#ifdef WITH_TLM_STATS
+    , fw_stats_if(this)
+#endif
+    {
         this->m_export.bind(bw_if);
     }
+#ifdef WITH_TLM_STATS
+    /**
+     * return the forward interface of the bound target wrapped by the statistics
+     *
+     * @return the forward interface
+     */
+    fw_interface_type* operator->() { return &fw_stats_if; }
+#endif
     /**
      * register a non-blocking backward path callback function
      *
@@ -75,6 +92,12 @@ public:
     void register_invalidate_direct_mem_ptr(std::function<void(sc_dt::uint64, sc_dt::uint64)> cb) {
         bw_if.set_invalidate_direct_mem_function(cb);
     }
+    /**
+     * return the transaction statistics of this socket
+     *
+     * @return the statistics, an empty placeholder if WITH_TLM_STATS is not defined
+     */
+    mixin_stats& get_stats() { return m_stats; }
 
 private:
     class bw_transport_if : public tlm::tlm_bw_transport_if<TYPES> {
@@ -127,8 +150,46 @@ private:
         invalidate_dmi_fct m_invalidate_direct_mem_ptr;
     };
 
+#ifdef WITH_TLM_STATS
+    class fw_stats_transport_if : public tlm::tlm_fw_transport_if<TYPES> {
+    public:
+        fw_stats_transport_if(initiator_mixin* owner)
+        : m_owner(owner) {}
+
+        sync_enum_type nb_transport_fw(transaction_type& trans, phase_type& phase, sc_core::sc_time& t) {
+            m_owner->m_stats.record_nb_transport(trans, phase);
+            return m_owner->BASE_TYPE::operator->()->nb_transport_fw(trans, phase, t);
+        }
+
+        void b_transport(transaction_type& trans, sc_core::sc_time& t) {
+            // the latency includes the time the call was blocked
+            auto const start = sc_core::sc_time_stamp() + t;
+            m_owner->BASE_TYPE::operator->()->b_transport(trans, t);
+            m_owner->m_stats.record_b_transport(trans, start, sc_core::sc_time_stamp() + t);
+        }
+
+        bool get_direct_mem_ptr(transaction_type& trans, tlm::tlm_dmi& dmi_data) {
+            auto const granted = m_owner->BASE_TYPE::operator->()->get_direct_mem_ptr(trans, dmi_data);
+            m_owner->m_stats.record_dmi(granted);
+            return granted;
+        }
+
+        unsigned int transport_dbg(transaction_type& trans) {
+            m_owner->m_stats.record_dbg();
+            return m_owner->BASE_TYPE::operator->()->transport_dbg(trans);
+        }
+
+    private:
+        initiator_mixin* m_owner;
+    };
+#endif
+
 private:
     bw_transport_if bw_if;
+    mixin_stats m_stats;
+#ifdef WITH_TLM_STATS
+    fw_stats_transport_if fw_stats_if;
+#endif
 };
 } // namespace scc
 } // namespace tlm
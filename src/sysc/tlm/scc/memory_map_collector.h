@@ -18,10 +18,13 @@
 #define _TLM_SCC_MEMORY_MAP_COLLECTOR_H_
 
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <sstream>
 #include <stdexcept>
+#include <string>
 #include <tlm>
+#include <vector>
 
 //! @brief SystemC TLM
 namespace tlm {
@@ -30,8 +33,15 @@ namespace scc {
 struct memory_node {
     uint64_t start{0};
     uint64_t end{std::numeric_limits<uint64_t>::max()};
+    //! the address the target sees for an access to start, this is not 0 if the range is not remapped by a router
+    uint64_t target_start{0};
     std::string name;
     std::vector<memory_node> elemets;
+    /**
+     * if set by a memory the backing store can be written directly (bypassing the interconnect) using target addresses.
+     * The function needs to be thread-safe for accesses to non-overlapping address ranges.
+     */
+    std::function<bool(uint64_t, uint64_t, const uint8_t*)> direct_write;
     memory_node(uint64_t start, uint64_t end)
     : start(start)
     , end(end) {}
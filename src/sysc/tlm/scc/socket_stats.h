@@ -0,0 +1,289 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _TLM_SCC_SOCKET_STATS_H_
+#define _TLM_SCC_SOCKET_STATS_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <tlm>
+#include <type_traits>
+#include <vector>
+
+//! @brief SystemC TLM
+namespace tlm {
+//! @brief SCC TLM utilities
+namespace scc {
+/**
+ * @class latency_histogram
+ * @brief a log-bucketed histogram of latencies in the style of HdrHistogram
+ *
+ * Each power of two is divided into 8 linear sub-buckets, so the relative error of a value is at most 12.5%
+ * while all 64bit values fit into 496 buckets. The buckets are allocated upon the first record.
+ */
+class latency_histogram {
+public:
+    static constexpr unsigned sub_bits = 3;
+    static constexpr unsigned sub_count = 1U << sub_bits;
+    static constexpr unsigned bucket_count = sub_count + (64 - sub_bits) * sub_count;
+
+    latency_histogram() = default;
+
+    latency_histogram(latency_histogram const& o) { merge(o); }
+
+    latency_histogram& operator=(latency_histogram const& o) {
+        if(this != &o) {
+            reset();
+            merge(o);
+        }
+        return *this;
+    }
+
+    void record(uint64_t value) {
+        if(!buckets)
+            buckets.reset(new uint64_t[bucket_count]());
+        buckets[index(value)]++;
+        cnt++;
+        sum += value;
+        min_val = std::min(min_val, value);
+        max_val = std::max(max_val, value);
+    }
+    //! adds the values of another histogram
+    void merge(latency_histogram const& o) {
+        if(!o.cnt)
+            return;
+        if(!buckets)
+            buckets.reset(new uint64_t[bucket_count]());
+        for(unsigned i = 0; i < bucket_count; ++i)
+            buckets[i] += o.buckets[i];
+        cnt += o.cnt;
+        sum += o.sum;
+        min_val = std::min(min_val, o.min_val);
+        max_val = std::max(max_val, o.max_val);
+    }
+
+    void reset() {
+        buckets.reset();
+        cnt = sum = max_val = 0;
+        min_val = std::numeric_limits<uint64_t>::max();
+    }
+
+    uint64_t count() const { return cnt; }
+
+    uint64_t min() const { return cnt ? min_val : 0; }
+
+    uint64_t max() const { return max_val; }
+
+    double mean() const { return cnt ? static_cast<double>(sum) / cnt : 0.0; }
+    /**
+     * @brief returns the value below which the given fraction of the recorded values falls
+     *
+     * @param fraction the fraction in the range [0, 1], e.g. 0.99 for the 99th percentile
+     * @return the upper bound of the bucket containing the percentile, limited to the maximum value
+     */
+    uint64_t percentile(double fraction) const {
+        if(!cnt)
+            return 0;
+        auto const rank = std::max<uint64_t>(1, static_cast<uint64_t>(fraction * cnt + 0.5));
+        uint64_t acc = 0;
+        for(unsigned i = 0; i < bucket_count; ++i) {
+            acc += buckets[i];
+            if(acc >= rank)
+                return std::min(max_val, i + 1 < bucket_count ? lower_bound(i + 1) - 1 : max_val);
+        }
+        return max_val;
+    }
+
+    static unsigned index(uint64_t value) {
+        if(value < sub_count)
+            return static_cast<unsigned>(value);
+        auto const exp = msb(value);
+        return sub_count + (exp - sub_bits) * sub_count + static_cast<unsigned>((value >> (exp - sub_bits)) & (sub_count - 1));
+    }
+
+    static uint64_t lower_bound(unsigned idx) {
+        if(idx < sub_count)
+            return idx;
+        auto const exp = (idx - sub_count) / sub_count + sub_bits;
+        return static_cast<uint64_t>(sub_count + (idx - sub_count) % sub_count) << (exp - sub_bits);
+    }
+
+private:
+    static unsigned msb(uint64_t value) {
+#ifdef __GNUG__
+        return 63 - __builtin_clzll(value);
+#else
+        unsigned res = 0;
+        while(value >>= 1)
+            ++res;
+        return res;
+#endif
+    }
+
+    std::unique_ptr<uint64_t[]> buckets;
+    uint64_t cnt{0}, sum{0}, min_val{std::numeric_limits<uint64_t>::max()}, max_val{0};
+};
+/**
+ * @class socket_stats
+ * @brief plain per-socket transaction counters
+ *
+ * The counters are incremented without any synchronization in the hot path, aggregation happens only when dumping.
+ * All instances register themselves by name so that dump_all() can report every socket of a design. The latency is
+ * the delay annotated by the target of a b_transport call, it is recorded in units of the time resolution and reported
+ * in ps. Reads, writes and bytes are only counted for payloads derived from tlm::tlm_generic_payload.
+ *
+ * The telemetry of the @ref scc::perf_estimator reads the counters of all sockets using for_each() and records the
+ * transactions (b_transport and BEGIN_REQ of nb_transport) and the bytes of each socket.
+ */
+class socket_stats {
+public:
+    uint64_t b_transports{0}, nb_transports{0}, dbg_transports{0};
+    uint64_t reads{0}, writes{0}, read_bytes{0}, write_bytes{0};
+    uint64_t dmi_requests{0}, dmi_grants{0};
+    latency_histogram latency;
+
+    explicit socket_stats(std::string const& name)
+    : name(name) {
+        registry().push_back(this);
+    }
+
+    socket_stats(socket_stats const&) = delete;
+
+    socket_stats& operator=(socket_stats const&) = delete;
+
+    ~socket_stats() {
+        auto& reg = registry();
+        reg.erase(std::remove(reg.begin(), reg.end(), this), reg.end());
+    }
+
+    template <typename TRANS>
+    typename std::enable_if<std::is_base_of<tlm::tlm_generic_payload, TRANS>::value>::type record_access(TRANS const& trans) {
+        if(trans.get_command() == tlm::TLM_READ_COMMAND) {
+            reads++;
+            read_bytes += trans.get_data_length();
+        } else if(trans.get_command() == tlm::TLM_WRITE_COMMAND) {
+            writes++;
+            write_bytes += trans.get_data_length();
+        }
+    }
+
+    template <typename TRANS>
+    typename std::enable_if<!std::is_base_of<tlm::tlm_generic_payload, TRANS>::value>::type record_access(TRANS const&) {}
+
+    template <typename TRANS> void record_b_transport(TRANS const& trans, sc_core::sc_time const& before, sc_core::sc_time const& after) {
+        b_transports++;
+        record_access(trans);
+        latency.record(after > before ? (after - before).value() : 0);
+    }
+
+    template <typename TRANS, typename PHASE> void record_nb_transport(TRANS const& trans, PHASE const& phase) {
+        if(phase == tlm::BEGIN_REQ) {
+            nb_transports++;
+            record_access(trans);
+        }
+    }
+
+    void record_dmi(bool granted) {
+        dmi_requests++;
+        if(granted)
+            dmi_grants++;
+    }
+
+    void record_dbg() { dbg_transports++; }
+
+    std::string const& get_name() const { return name; }
+    //! the number of b_transport and nb_transport transactions
+    uint64_t transactions() const { return b_transports + nb_transports; }
+    //! the number of bytes read and written
+    uint64_t bytes() const { return read_bytes + write_bytes; }
+
+    void reset() {
+        b_transports = nb_transports = dbg_transports = reads = writes = read_bytes = write_bytes = dmi_requests = dmi_grants = 0;
+        latency.reset();
+    }
+    /**
+     * @brief writes the counters of this socket as a single line
+     *
+     * @param os the output stream
+     * @param elapsed the simulated time used to calculate the bandwidth, if zero the current simulation time is used
+     */
+    void dump(std::ostream& os, sc_core::sc_time elapsed = sc_core::SC_ZERO_TIME) const {
+        if(elapsed == sc_core::SC_ZERO_TIME)
+            elapsed = sc_core::sc_time_stamp();
+        auto const secs = elapsed.to_seconds();
+        auto const bw = secs > 0 ? bytes() / secs / (1024 * 1024) : 0.0;
+        os << name << ": b_transport=" << b_transports << " nb_transport=" << nb_transports << " dbg=" << dbg_transports
+           << " reads=" << reads << " writes=" << writes << " read_bytes=" << read_bytes << " write_bytes=" << write_bytes
+           << std::fixed << std::setprecision(3) << " bandwidth=" << bw << "MiB/s"
+           << " dmi=" << dmi_grants << "/" << dmi_requests;
+        if(latency.count()) {
+            auto const ps = sc_core::sc_get_time_resolution().to_seconds() * 1e12;
+            os << " latency[ps] min=" << latency.min() * ps << " mean=" << latency.mean() * ps
+               << " p50=" << latency.percentile(0.5) * ps << " p99=" << latency.percentile(0.99) * ps << " max=" << latency.max() * ps;
+        }
+        os << "\n";
+    }
+    /**
+     * @brief writes the counters of all sockets which have seen any access, sorted by name
+     */
+    static void dump_all(std::ostream& os, sc_core::sc_time elapsed = sc_core::SC_ZERO_TIME) {
+        std::vector<socket_stats const*> sorted(registry().begin(), registry().end());
+        std::sort(sorted.begin(), sorted.end(), [](socket_stats const* a, socket_stats const* b) { return a->name < b->name; });
+        for(auto const* s : sorted)
+            if(s->b_transports || s->nb_transports || s->dbg_transports || s->dmi_requests)
+                s->dump(os, elapsed);
+    }
+    /**
+     * @brief calls func for each socket in the order of construction
+     */
+    static void for_each(std::function<void(socket_stats const&)> const& func) {
+        for(auto const* s : registry())
+            func(*s);
+    }
+
+private:
+    static std::vector<socket_stats*>& registry() {
+        static std::vector<socket_stats*> reg;
+        return reg;
+    }
+    std::string const name;
+};
+/**
+ * @class no_socket_stats
+ * @brief the counters of the mixins if TLM statistics are not compiled in (WITH_TLM_STATS is not defined)
+ */
+struct no_socket_stats {
+    explicit no_socket_stats(std::string const&) {}
+    template <typename TRANS> void record_b_transport(TRANS const&, sc_core::sc_time const&, sc_core::sc_time const&) {}
+    template <typename TRANS, typename PHASE> void record_nb_transport(TRANS const&, PHASE const&) {}
+    void record_dmi(bool) {}
+    void record_dbg() {}
+};
+#ifdef WITH_TLM_STATS
+using mixin_stats = socket_stats;
+#else
+using mixin_stats = no_socket_stats;
+#endif
+} // namespace scc
+} // namespace tlm
+
+#endif // _TLM_SCC_SOCKET_STATS_H_
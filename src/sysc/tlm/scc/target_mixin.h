@@ -21,6 +21,7 @@
 #endif
 
 #include "scc/utilities.h"
+#include "socket_stats.h"
 #include <functional>
 #include <sstream>
 #include <tlm>
@@ -32,6 +33,9 @@ namespace tlm {
 namespace scc {
 /**
  * an target socket mixin adding default implementation of callback functions similar to tlm::simple_target_socket
+ *
+ * If the library is built with ENABLE_TLM_STATS (defining WITH_TLM_STATS) the incoming transactions are counted in a
+ * @ref tlm::scc::socket_stats, otherwise the statistics compile to nothing.
  */
 template <typename BASE_TYPE, typename TYPES = tlm::tlm_base_protocol_types> class target_mixin : public BASE_TYPE {
     //    friend class fw_process;
@@ -57,6 +61,7 @@ public:
      */
     explicit target_mixin(const sc_core::sc_module_name& n)
     : BASE_TYPE(n)
+    , m_stats(this->name())
     , m_fw_process(this)
     , m_bw_process(this)
     , m_current_transaction(nullptr) {
@@ -75,7 +80,7 @@ public:
      *
      * @param cb
      */
-    void register_nb_transport_fw(std::function<sync_enum_type(transaction_type&, phase_type&, sc_core::sc_time&)> cb) {
+    virtual void register_nb_transport_fw(std::function<sync_enum_type(transaction_type&, phase_type&, sc_core::sc_time&)> cb) {
         assert(!sc_core::sc_get_curr_simcontext()->elaboration_done());
         m_fw_process.set_nb_transport_ptr(cb);
     }
@@ -84,7 +89,7 @@ public:
      *
      * @param cb
      */
-    void register_b_transport(std::function<void(transaction_type&, sc_core::sc_time&)> cb) {
+    virtual void register_b_transport(std::function<void(transaction_type&, sc_core::sc_time&)> cb) {
         assert(!sc_core::sc_get_curr_simcontext()->elaboration_done());
         m_fw_process.set_b_transport_ptr(cb);
     }
@@ -92,7 +97,7 @@ public:
      *
      * @param cb
      */
-    void register_transport_dbg(std::function<unsigned int(transaction_type&)> cb) {
+    virtual void register_transport_dbg(std::function<unsigned int(transaction_type&)> cb) {
         assert(!sc_core::sc_get_curr_simcontext()->elaboration_done());
         m_fw_process.set_transport_dbg_ptr(cb);
     }
@@ -101,10 +106,16 @@ public:
      *
      * @param cb
      */
-    void register_get_direct_mem_ptr(std::function<bool(transaction_type&, tlm::tlm_dmi&)> cb) {
+    virtual void register_get_direct_mem_ptr(std::function<bool(transaction_type&, tlm::tlm_dmi&)> cb) {
         assert(!sc_core::sc_get_curr_simcontext()->elaboration_done());
         m_fw_process.set_get_direct_mem_ptr(cb);
     }
+    /**
+     * return the transaction statistics of this socket
+     *
+     * @return the statistics, an empty placeholder if WITH_TLM_STATS is not defined
+     */
+    mixin_stats& get_stats() { return m_stats; }
 
 private:
     // make call on bw path.
@@ -220,6 +231,7 @@ private:
         }
         // Interface implementation
         sync_enum_type nb_transport_fw(transaction_type& trans, phase_type& phase, sc_core::sc_time& t) {
+            m_owner->m_stats.record_nb_transport(trans, phase);
             if(m_nb_transport_ptr) {
                 // forward call
                 return m_nb_transport_ptr(trans, phase, t);
@@ -257,6 +269,17 @@ private:
         }
 
         void b_transport(transaction_type& trans, sc_core::sc_time& t) {
+#ifdef WITH_TLM_STATS
+            // the latency includes the time the call was blocked
+            auto const start = sc_core::sc_time_stamp() + t;
+            forward_b_transport(trans, t);
+            m_owner->m_stats.record_b_transport(trans, start, sc_core::sc_time_stamp() + t);
+#else
+            forward_b_transport(trans, t);
+#endif
+        }
+
+        void forward_b_transport(transaction_type& trans, sc_core::sc_time& t) {
             if(m_b_transport_ptr) {
                 // forward call
                 m_b_transport_ptr(trans, t);
@@ -297,6 +320,7 @@ private:
         }
 
         unsigned int transport_dbg(transaction_type& trans) {
+            m_owner->m_stats.record_dbg();
             if(m_transport_dbg_ptr) {
                 // forward call
                 return m_transport_dbg_ptr(trans);
@@ -309,7 +333,9 @@ private:
         bool get_direct_mem_ptr(transaction_type& trans, tlm::tlm_dmi& dmi_data) {
             if(m_get_direct_mem_ptr) {
                 // forward call
-                return m_get_direct_mem_ptr(trans, dmi_data);
+                auto const granted = m_get_direct_mem_ptr(trans, dmi_data);
+                m_owner->m_stats.record_dmi(granted);
+                return granted;
 
             } else {
                 // No DMI support
@@ -483,6 +509,7 @@ private:
     };
 
 private:
+    mixin_stats m_stats;
     fw_process m_fw_process;
     bw_process m_bw_process;
     std::map<transaction_type*, sc_core::sc_event*> m_pending_trans;
@@ -0,0 +1,138 @@
+#include "testbench.h"
+#include <factory.h>
+#include <scc/delayed_clock_event.h>
+#include <tlm/scc/tlm_gp_shared.h>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+#include <vector>
+
+using namespace sc_core;
+
+namespace {
+//! drives a scc::delayed_clock_event and, as reference, an event being notified 1ns after every rising clock edge
+template <bool POSEDGE_FIRST> struct clock_event_tb : public sc_core::sc_module {
+    sc_core::sc_clock clk;
+    sc_core::sc_in<bool> clk_i{"clk_i"};
+    scc::delayed_clock_event clk_delayed{clk_i, 1_ns};
+    sc_core::sc_event ref_evt;
+
+    SC_HAS_PROCESS(clock_event_tb);
+    clock_event_tb()
+    : clock_event_tb(sc_gen_unique_name("clock_event_tb", false)) {}
+
+    clock_event_tb(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm)
+    , clk{"clk", 10_ns, 0.4, POSEDGE_FIRST ? SC_ZERO_TIME : 3_ns, POSEDGE_FIRST} {
+        clk_i(clk);
+        SC_METHOD(clk_delay);
+        sensitive << clk_i.pos();
+        SC_METHOD(ref_delay);
+        sensitive << clk_i.pos();
+        dont_initialize();
+    }
+
+    void clk_delay() { clk_delayed.on_clock(); }
+
+    void ref_delay() { ref_evt.notify(1_ns); }
+};
+
+factory::add<clock_event_tb<true>> posedge_first_tb;
+factory::add<clock_event_tb<false>> negedge_first_tb;
+//! a request for the delayed clock event after some idle cycles, at an offset to the rising edge and some delta cycles
+struct request {
+    unsigned idle_cycles;
+    sc_time offset;
+    unsigned deltas;
+};
+
+std::vector<request> const requests{{0, SC_ZERO_TIME, 0}, {0, SC_ZERO_TIME, 2}, {0, 500_ps, 0}, {1, 1_ns, 0},
+                                    {0, 5_ns, 0},         {3, SC_ZERO_TIME, 0}, {2, 999_ps, 1}, {0, SC_ZERO_TIME, 1},
+                                    {5, 9_ns, 0},         {0, 1_ns, 1},         {4, 1_ps, 0}};
+
+template <typename TB> void compare_clock_events() {
+    auto& dut = factory::get<TB>();
+    std::vector<sc_time> times, ref_times;
+    auto drive = [&dut](std::vector<sc_time>& res, bool use_ref) {
+        for(auto const& r : requests) {
+            for(unsigned i = 0; i <= r.idle_cycles; ++i)
+                wait(dut.clk.posedge_event());
+            if(r.offset > SC_ZERO_TIME)
+                wait(r.offset);
+            for(unsigned i = 0; i < r.deltas; ++i)
+                wait(SC_ZERO_TIME);
+            if(use_ref)
+                wait(dut.ref_evt);
+            else
+                wait(dut.clk_delayed.get());
+            res.push_back(sc_time_stamp());
+        }
+    };
+    auto p = sc_spawn([&drive, &times]() { drive(times, false); });
+    auto ref_p = sc_spawn([&drive, &ref_times]() { drive(ref_times, true); });
+    sc_start(100 * dut.clk.period());
+    REQUIRE(p.terminated());
+    REQUIRE(ref_p.terminated());
+    REQUIRE(ref_times.size() == requests.size());
+    REQUIRE(times == ref_times);
+}
+} // namespace
+
+TEST_CASE("delayed_clock_event_timing", "[AHB][pin-level]") {
+    compare_clock_events<clock_event_tb<true>>();
+    compare_clock_events<clock_event_tb<false>>();
+}
+
+TEST_CASE("ahb_idle_cycle_timing", "[AHB][pin-level]") {
+    auto& dut = factory::get<testbench>();
+    // the times the target receives the transactions
+    std::vector<std::pair<sc_time, bool>> accesses;
+    dut.tsck.register_b_transport([&accesses](tlm::tlm_generic_payload& trans, sc_time& d) {
+        accesses.emplace_back(sc_time_stamp(), trans.is_write());
+        trans.set_response_status(tlm::TLM_OK_RESPONSE);
+    });
+    dut.rst_n.write(false);
+    sc_start(4 * dut.clk.period());
+    dut.rst_n.write(true);
+    sc_start(dut.clk.period());
+    dut.HSEL.write(true);
+    sc_start(dut.clk.period());
+    dut.addr_phases.clear();
+
+    auto run = sc_spawn([&dut]() {
+        uint64_t addr{0x100};
+        for(unsigned idle_cycles : {0, 0, 1, 2, 3, 7, 1, 0}) {
+            for(auto cmd : {tlm::TLM_WRITE_COMMAND, tlm::TLM_READ_COMMAND}) {
+                tlm::scc::tlm_gp_shared_ptr trans = tlm::scc::tlm_mm<>::get().allocate<ahb::ahb_extension>(4);
+                trans->set_address(addr);
+                trans->set_data_length(4);
+                trans->set_streaming_width(4);
+                trans->get_extension<ahb::ahb_extension>()->set_burst(ahb::burst_e::INCR);
+                trans->set_command(cmd);
+                sc_time d;
+                dut.isck->b_transport(*trans, d);
+                REQUIRE(trans->get_response_status() == tlm::TLM_OK_RESPONSE);
+                addr += 4;
+            }
+            // deselecting the target while being idle must not change the timing either
+            if(idle_cycles > 2)
+                dut.HSEL.write(false);
+            for(unsigned i = 0; i < idle_cycles; ++i)
+                wait(dut.clk.posedge_event());
+            dut.HSEL.write(true);
+        }
+    });
+    unsigned cycles{0};
+    while(cycles < 1000 && !run.terminated()) {
+        sc_start(10 * dut.clk.period());
+        cycles += 10;
+    }
+    REQUIRE(run.terminated());
+    // the target reacts in the same cycles as a target sampling the bus at every rising clock edge: reads are
+    // forwarded in the cycle of the address phase, writes once the write data is sampled at the falling edge
+    REQUIRE(accesses.size() == 16);
+    REQUIRE(dut.addr_phases.size() == accesses.size());
+    for(size_t i = 0; i < accesses.size(); ++i) {
+        auto const expected = dut.addr_phases[i] + (accesses[i].second ? dut.clk_period / 2 : SC_ZERO_TIME);
+        CHECK(accesses[i].first == expected);
+    }
+}
@@ -32,6 +32,8 @@ public:
     // target side
     ahb::pin::target<DWIDTH, 32> tgt_bfm{"tgt_bfm"};
     tlm::scc::target_mixin<tlm::tlm_target_socket<scc::LT>> tsck{"tsck"};
+    //! the times of the address phases as seen by sampling the bus at every rising clock edge
+    std::vector<sc_core::sc_time> addr_phases;
 
 public:
     SC_HAS_PROCESS(testbench);
@@ -70,6 +72,14 @@ public:
         tgt_bfm.HREADY_o(HREADY);
         tgt_bfm.HRESP_o(HRESP);
         tgt_bfm.isckt(tsck);
+        SC_METHOD(sample_addr_phase);
+        sensitive << clk.posedge_event();
+        dont_initialize();
+    }
+
+    void sample_addr_phase() {
+        if(HSEL.read() && HREADY.read() && HTRANS.read() > 1)
+            addr_phases.push_back(sc_core::sc_time_stamp());
     }
 
     void run1() {}
@@ -87,11 +87,8 @@ tlm::tlm_generic_payload* prepare_trans(uint64_t start_address, unsigned addr_in
     trans->set_streaming_width(len);
     ext->set_size(scc::ilog2(width));
     sc_assert(len < (bus_cfg::BUSWIDTH / 8) || len % (bus_cfg::BUSWIDTH / 8) == 0);
-    auto length = (len * 8 - 1) / (8 * width);
-    //    if(width == (bus_cfg::BUSWIDTH / 8) && start_address % (bus_cfg::BUSWIDTH / 8))
-    //        length++;
-    if(start_address % (bus_cfg::BUSWIDTH / 8) + width > (bus_cfg::BUSWIDTH / 8))
-        length++;
+    // the first beat of an unaligned burst transfers only the bytes from the start address to the next aligned address
+    auto length = (start_address % width + len - 1) / width;
     ext->set_length(length);
     // ext->set_burst(len * 8 > bus_cfg::buswidth ? axi::burst_e::INCR : axi::burst_e::FIXED);
     ext->set_burst(axi::burst_e::INCR);
@@ -281,8 +278,15 @@ void axi4_narrow_burst(bool pipelined_wrreq, bool write_bp, bool unaligned = fal
         auto const& send_tx = e.second.first;
         auto const& recv_tx = e.second.second;
         REQUIRE(send_tx.size() == recv_tx.size());
-        for(auto i = 0; i < send_tx.size(); ++i)
+        for(auto i = 0; i < send_tx.size(); ++i) {
+            if(unaligned) {
+                // the target reads all bytes of the last beat
+                CHECK(send_tx[i]->get_data_length() <= recv_tx[i]->get_data_length());
+                recv_tx[i]->set_data_length(send_tx[i]->get_data_length());
+                recv_tx[i]->set_streaming_width(send_tx[i]->get_streaming_width());
+            }
             CHECK(is_equal(*send_tx[i], *recv_tx[i]));
+        }
     }
 }
 
@@ -292,7 +296,7 @@ TEST_CASE("axi4_burst_alignment_unaligned_addr", "[AXI][pin-level]") { axi4_burs
 
 TEST_CASE("axi4_narrow_burst", "[AXI][pin-level]") { axi4_narrow_burst(false, false); }
 
-// TEST_CASE("axi4_narrow_burst_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(false, false, true); }
+TEST_CASE("axi4_narrow_burst_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(false, false, true); }
 
 TEST_CASE("axi4_burst_alignment_with_bp", "[AXI][pin-level]") { axi4_burst_alignment(false, true); }
 
@@ -300,7 +304,7 @@ TEST_CASE("axi4_burst_alignment_with_bp_unaligned_addr", "[AXI][pin-level]") { a
 
 TEST_CASE("axi4_narrow_burst_with_bp", "[AXI][pin-level]") { axi4_narrow_burst(false, true); }
 
-// TEST_CASE("axi4_narrow_burst_with_bp_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(false, true, true); }
+TEST_CASE("axi4_narrow_burst_with_bp_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(false, true, true); }
 
 TEST_CASE("axi4_burst_alignment_pipelined_write", "[AXI][pin-level]") { axi4_burst_alignment(true, false); }
 
@@ -308,7 +312,7 @@ TEST_CASE("axi4_burst_alignment_pipelined_write_unaligned_addr", "[AXI][pin-leve
 
 TEST_CASE("axi4_narrow_burst_pipelined_write", "[AXI][pin-level]") { axi4_narrow_burst(true, false); }
 
-// TEST_CASE("axi4_narrow_burst_pipelined_write_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(true, false, true); }
+TEST_CASE("axi4_narrow_burst_pipelined_write_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(true, false, true); }
 
 TEST_CASE("axi4_burst_alignment_pipelined_write_with_bp", "[AXI][pin-level]") { axi4_burst_alignment(true, true); }
 
@@ -316,4 +320,4 @@ TEST_CASE("axi4_burst_alignment_pipelined_write_with_bp_unaligned_addr", "[AXI][
 
 TEST_CASE("axi4_narrow_burst_pipelined_write_with_bp", "[AXI][pin-level]") { axi4_narrow_burst(true, true); }
 
-// TEST_CASE("axi4_narrow_burst_pipelined_write_with_bp_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(true, true, true); }
+TEST_CASE("axi4_narrow_burst_pipelined_write_with_bp_unaligned_addr", "[AXI][pin-level]") { axi4_narrow_burst(true, true, true); }
@@ -3,8 +3,13 @@
 
 #include <axi/pe/axi_initiator.h>
 #include <axi/pe/simple_target.h>
+#ifdef USE_METHOD_BFMS
+#include <axi/pin/axi4_method_initiator.h>
+#include <axi/pin/axi4_method_target.h>
+#else
 #include <axi/pin/axi4_initiator.h>
 #include <axi/pin/axi4_target.h>
+#endif
 #include <axi/scv/recorder_modules.h>
 #include <scc.h>
 
@@ -15,6 +20,13 @@ using namespace axi::pe;
 class testbench : public sc_core::sc_module {
 public:
     using bus_cfg = axi::axi4_cfg</*BUSWIDTH=*/64, /*ADDRWIDTH=*/32, /*IDWIDTH=*/4, /*USERWIDTH=*/1>;
+#ifdef USE_METHOD_BFMS
+    using initiator_bfm = axi::pin::axi4_method_initiator<bus_cfg>;
+    using target_bfm = axi::pin::axi4_method_target<bus_cfg>;
+#else
+    using initiator_bfm = axi::pin::axi4_initiator<bus_cfg>;
+    using target_bfm = axi::pin::axi4_target<bus_cfg>;
+#endif
 
     sc_core::sc_time clk_period{10, sc_core::SC_NS};
     sc_core::sc_clock clk{"clk", clk_period, 0.5, sc_core::SC_ZERO_TIME, true};
@@ -22,14 +34,14 @@ public:
     // initiator side
     axi::axi_initiator_socket<bus_cfg::BUSWIDTH> intor{"intor"};
     axi::scv::axi_recorder_module<bus_cfg::BUSWIDTH> intor_rec{"intor_rec"};
-    axi::pin::axi4_initiator<bus_cfg> intor_bfm{"intor_bfm"};
+    initiator_bfm intor_bfm{"intor_bfm"};
     // signal accurate bus
     axi::aw_axi<bus_cfg, axi::signal_types> aw;
     axi::wdata_axi<bus_cfg, axi::signal_types> wdata;
     axi::b_axi<bus_cfg, axi::signal_types> b;
     axi::ar_axi<bus_cfg, axi::signal_types> ar;
     axi::rresp_axi<bus_cfg, axi::signal_types> rresp;
-    axi::pin::axi4_target<bus_cfg> tgt_bfm{"tgt_bfm"};
+    target_bfm tgt_bfm{"tgt_bfm"};
     // target side
     axi::scv::axi_recorder_module<bus_cfg::BUSWIDTH> tgt_rec{"tgt_rec"};
     axi::axi_target_socket<bus_cfg::BUSWIDTH> tgt{"tgt"};
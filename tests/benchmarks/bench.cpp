@@ -0,0 +1,243 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "bench.h"
+#include <algorithm>
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
+#include <rapidjson/ostreamwrapper.h>
+#include <rapidjson/prettywriter.h>
+#include <regex>
+#include <thread>
+#include <unistd.h>
+
+namespace bench {
+namespace {
+struct benchmark {
+    std::string name;
+    body_fct body;
+    std::function<void()> elaborate;
+};
+
+std::vector<benchmark>& registry() {
+    static std::vector<benchmark> reg;
+    return reg;
+}
+
+uint64_t const max_iterations = 1000000000ULL;
+
+result run_benchmark(benchmark const& b, double min_time) {
+    uint64_t iters = 1;
+    while(true) {
+        state s(iters);
+        b.body(s);
+        auto const elapsed = s.get_real_time();
+        if(s.get_error().size() || elapsed >= min_time || iters >= max_iterations) {
+            result res;
+            res.name = b.name;
+            res.iterations = iters;
+            res.real_time = elapsed * 1e9 / iters;
+            res.cpu_time = s.get_cpu_time() * 1e9 / iters;
+            res.label = s.get_label();
+            res.error = s.get_error();
+            if(s.get_items_processed() && elapsed > 0)
+                res.counters.emplace_back("items_per_second", s.get_items_processed() / elapsed);
+            return res;
+        }
+        // predict the iterations needed like Google Benchmark does, but grow by at most a factor of 10
+        auto const multiplier = elapsed > 0 ? std::min(10.0, min_time * 1.4 / elapsed) : 10.0;
+        iters = std::min(max_iterations, std::max(iters + 1, static_cast<uint64_t>(iters * multiplier)));
+    }
+}
+
+std::string get_host_name() {
+    char buf[256];
+    return gethostname(buf, sizeof(buf)) == 0 ? std::string(buf) : std::string("unknown");
+}
+} // namespace
+
+bool get_option(std::string const& arg, std::string const& opt, std::string& val) {
+    if(arg.size() <= opt.size() || arg.compare(0, opt.size(), opt) != 0 || arg[opt.size()] != '=')
+        return false;
+    val = arg.substr(opt.size() + 1);
+    return true;
+}
+
+registrar::registrar(char const* name, body_fct body, std::function<void()> elaborate) {
+    registry().push_back({name, body, elaborate});
+}
+
+std::vector<std::unique_ptr<sc_core::sc_object>>& fixtures() {
+    static std::vector<std::unique_ptr<sc_core::sc_object>> fix;
+    return fix;
+}
+
+void write_json(std::ostream& os, std::vector<result> const& results) {
+    rapidjson::OStreamWrapper stream(os);
+    rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(stream);
+    writer.StartObject();
+    writer.Key("context");
+    writer.StartObject();
+    char date[64];
+    auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+    writer.Key("date");
+    writer.String(date);
+    writer.Key("host_name");
+    writer.String(get_host_name().c_str());
+    writer.Key("num_cpus");
+    writer.Uint(std::thread::hardware_concurrency());
+    writer.Key("library_build_type");
+#ifdef NDEBUG
+    writer.String("release");
+#else
+    writer.String("debug");
+#endif
+    writer.Key("systemc_version");
+    writer.String(sc_core::sc_release());
+    writer.EndObject();
+    writer.Key("benchmarks");
+    writer.StartArray();
+    for(auto const& r : results) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(r.name.c_str());
+        writer.Key("run_name");
+        writer.String(r.name.c_str());
+        writer.Key("run_type");
+        writer.String("iteration");
+        writer.Key("iterations");
+        writer.Uint64(r.iterations);
+        writer.Key("real_time");
+        writer.Double(r.real_time);
+        writer.Key("cpu_time");
+        writer.Double(r.cpu_time);
+        writer.Key("time_unit");
+        writer.String("ns");
+        for(auto const& c : r.counters) {
+            writer.Key(c.first.c_str());
+            writer.Double(c.second);
+        }
+        if(r.label.size()) {
+            writer.Key("label");
+            writer.String(r.label.c_str());
+        }
+        if(r.error.size()) {
+            writer.Key("error_occurred");
+            writer.Bool(true);
+            writer.Key("error_message");
+            writer.String(r.error.c_str());
+        }
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    os << "\n";
+}
+
+void write_table(std::ostream& os, std::vector<result> const& results) {
+    size_t width = 9;
+    for(auto const& r : results)
+        width = std::max(width, r.name.size());
+    os << fmt::format("{:<{}} {:>15} {:>15} {:>12}\n", "Benchmark", width, "Time", "CPU", "Iterations");
+    os << std::string(width + 45, '-') << "\n";
+    for(auto const& r : results) {
+        if(r.error.size()) {
+            os << fmt::format("{:<{}} ERROR OCCURRED: '{}'\n", r.name, width, r.error);
+            continue;
+        }
+        os << fmt::format("{:<{}} {:>12.1f} ns {:>12.1f} ns {:>12}", r.name, width, r.real_time, r.cpu_time, r.iterations);
+        for(auto const& c : r.counters)
+            os << fmt::format(" {}={:.4g}", c.first, c.second);
+        if(r.label.size())
+            os << " " << r.label;
+        os << "\n";
+    }
+}
+
+bool write_results(std::vector<result> const& results, std::string const& out_file, bool json) {
+    if(out_file.size()) {
+        std::ofstream ofs(out_file);
+        if(!ofs) {
+            std::cerr << "could not open " << out_file << " for writing\n";
+            return false;
+        }
+        write_json(ofs, results);
+    }
+    if(json)
+        write_json(std::cout, results);
+    else
+        write_table(std::cout, results);
+    return true;
+}
+
+int run_benchmarks(int argc, char* argv[]) {
+    std::string filter{"."}, out_file;
+    double min_time = 0.5;
+    bool list_only = false, json = false;
+    for(int i = 1; i < argc; ++i) {
+        std::string const arg(argv[i]);
+        std::string val;
+        if(get_option(arg, "--benchmark_filter", val))
+            filter = val;
+        else if(get_option(arg, "--benchmark_min_time", val))
+            min_time = std::stod(val); // a trailing 's' as accepted by newer Google Benchmark versions is ignored
+        else if(get_option(arg, "--benchmark_out", val))
+            out_file = val;
+        else if(get_option(arg, "--benchmark_format", val))
+            json = val == "json";
+        else if(arg == "--benchmark_list_tests" || arg == "--benchmark_list_tests=true")
+            list_only = true;
+        else {
+            std::cerr << "usage: " << argv[0]
+                      << " [--benchmark_filter=<regex>] [--benchmark_min_time=<seconds>] [--benchmark_out=<file>]"
+                         " [--benchmark_format=<console|json>] [--benchmark_list_tests]\n";
+            return arg == "--help" || arg == "-h" ? 0 : 1;
+        }
+    }
+    std::regex const re(filter);
+    std::vector<benchmark const*> selected;
+    for(auto const& b : registry())
+        if(std::regex_search(b.name, re))
+            selected.push_back(&b);
+    if(list_only) {
+        for(auto* b : selected)
+            std::cout << b->name << "\n";
+        return 0;
+    }
+    if(selected.empty()) {
+        std::cerr << "no benchmark matches '" << filter << "'\n";
+        return 1;
+    }
+    for(auto* b : selected)
+        if(b->elaborate)
+            b->elaborate();
+    std::vector<result> results;
+    sc_core::sc_spawn(
+        [&selected, &results, min_time]() {
+            for(auto* b : selected)
+                results.push_back(run_benchmark(*b, min_time));
+            sc_core::sc_stop();
+        },
+        "bench_runner");
+    sc_core::sc_start();
+    fixtures().clear();
+    if(!write_results(results, out_file, json))
+        return 1;
+    return std::any_of(results.begin(), results.end(), [](result const& r) { return r.error.size(); }) ? 1 : 0;
+}
+} // namespace bench
@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _BENCHMARKS_BENCH_H_
+#define _BENCHMARKS_BENCH_H_
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <systemc>
+#include <vector>
+
+/**
+ * @brief a minimal micro-benchmark harness for SystemC models
+ *
+ * The command line and the JSON output follow Google Benchmark so that its tooling (and tests/benchmarks/compare.py)
+ * can be used. In contrast to Google Benchmark the bodies run inside a SystemC thread, hence they may call wait() and
+ * use modules (fixtures) which have been instantiated during elaboration. Since a SystemC kernel can only be elaborated
+ * once per process, only the fixtures of the selected benchmarks are created before the simulation starts.
+ */
+namespace bench {
+/**
+ * @class state
+ * @brief the iteration and timing state passed to a benchmark body
+ *
+ * The body is called with a growing number of iterations until the timed part runs long enough. Everything before the
+ * first call of keep_running() is setup and not measured.
+ */
+class state {
+public:
+    explicit state(uint64_t max_iterations)
+    : max_iterations(max_iterations)
+    , remaining(max_iterations) {}
+    /**
+     * @brief returns true as long as the measured loop shall continue, starts the timer upon the first call
+     */
+    bool keep_running() {
+        if(!started) {
+            started = true;
+            resume_timing();
+        }
+        if(remaining) {
+            --remaining;
+            return true;
+        }
+        pause_timing();
+        return false;
+    }
+    //! stops the timer, e.g. to exclude per iteration setup
+    void pause_timing() {
+        if(running) {
+            real_time += std::chrono::duration<double>(clock::now() - real_start).count();
+            cpu_time += static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+            running = false;
+        }
+    }
+    //! restarts the timer
+    void resume_timing() {
+        if(!running) {
+            real_start = clock::now();
+            cpu_start = std::clock();
+            running = true;
+        }
+    }
+    //! the number of iterations of this run
+    uint64_t iterations() const { return max_iterations; }
+    //! sets the number of processed items (e.g. signals or transactions) to report a throughput
+    void set_items_processed(uint64_t items) { items_processed = items; }
+
+    uint64_t get_items_processed() const { return items_processed; }
+    //! sets a label shown next to the result
+    void set_label(std::string const& l) { label = l; }
+
+    std::string const& get_label() const { return label; }
+    //! marks the benchmark as failed, the body should return immediately
+    void skip_with_error(std::string const& msg) {
+        error = msg;
+        remaining = 0;
+    }
+
+    std::string const& get_error() const { return error; }
+
+    double get_real_time() const { return real_time; }
+
+    double get_cpu_time() const { return cpu_time; }
+
+private:
+    using clock = std::chrono::steady_clock;
+    uint64_t const max_iterations;
+    uint64_t remaining;
+    uint64_t items_processed{0};
+    bool started{false}, running{false};
+    clock::time_point real_start;
+    std::clock_t cpu_start{0};
+    double real_time{0.}, cpu_time{0.};
+    std::string label, error;
+};
+/**
+ * @struct result
+ * @brief the result of a benchmark or scenario as written to the JSON output
+ *
+ * The times are per iteration in ns. The counters are written as additional fields of the benchmark entry.
+ */
+struct result {
+    std::string name;
+    uint64_t iterations{0};
+    double real_time{0.}, cpu_time{0.};
+    std::string label, error;
+    std::vector<std::pair<std::string, double>> counters;
+};
+//! returns true and sets val if arg has the form <opt>=<val>
+bool get_option(std::string const& arg, std::string const& opt, std::string& val);
+//! writes the results in the Google Benchmark JSON format
+void write_json(std::ostream& os, std::vector<result> const& results);
+//! writes the results as human readable table
+void write_table(std::ostream& os, std::vector<result> const& results);
+//! writes the results to the file given by --benchmark_out= or as JSON/table to stdout as requested
+bool write_results(std::vector<result> const& results, std::string const& out_file, bool json);
+
+//! prevents the compiler from optimizing away the computation of value
+template <typename T> inline void do_not_optimize(T const& value) {
+#ifdef __GNUC__
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static_cast<void>(*reinterpret_cast<char const volatile*>(&value));
+#endif
+}
+
+using body_fct = std::function<void(state&)>;
+/**
+ * @struct registrar
+ * @brief registers a benchmark at static initialization time, use SCC_BENCHMARK or SCC_BENCHMARK_F
+ */
+struct registrar {
+    registrar(char const* name, body_fct body, std::function<void()> elaborate = std::function<void()>());
+};
+//! returns the list of modules created by fixture() which are deleted once the simulation finished
+std::vector<std::unique_ptr<sc_core::sc_object>>& fixtures();
+/**
+ * @brief returns the fixture of the given type, creating it upon the first call
+ *
+ * The fixture needs to be a sc_module with a constructor taking the module name. It is created during elaboration
+ * and shared by all benchmarks using it.
+ */
+template <typename FIXTURE> FIXTURE& fixture() {
+    static FIXTURE* inst = nullptr;
+    if(!inst) {
+        inst = new FIXTURE(sc_core::sc_gen_unique_name("fixture"));
+        fixtures().emplace_back(inst);
+    }
+    return *inst;
+}
+/**
+ * @brief runs the benchmarks selected on the command line
+ *
+ * Supported options are --benchmark_filter=<regex>, --benchmark_min_time=<seconds>, --benchmark_out=<file>,
+ * --benchmark_format=<console|json> and --benchmark_list_tests. To be called from sc_main before sc_start() was called.
+ *
+ * @return the exit code for sc_main
+ */
+int run_benchmarks(int argc, char* argv[]);
+} // namespace bench
+
+#define SCC_BENCHMARK_CONCAT2(A, B) A##B
+#define SCC_BENCHMARK_CONCAT(A, B) SCC_BENCHMARK_CONCAT2(A, B)
+/**
+ * registers the function FCT(bench::state&) as benchmark NAME
+ */
+#define SCC_BENCHMARK(NAME, FCT) static ::bench::registrar SCC_BENCHMARK_CONCAT(bench_registrar_, __LINE__)(NAME, FCT)
+/**
+ * registers the function FCT(bench::state&, FIXTURE&) as benchmark NAME using the fixture module FIXTURE
+ */
+#define SCC_BENCHMARK_F(FIXTURE, NAME, FCT)                                                                                                \
+    static ::bench::registrar SCC_BENCHMARK_CONCAT(bench_registrar_, __LINE__)(                                                            \
+        NAME, [](::bench::state& s) { FCT(s, ::bench::fixture<FIXTURE>()); }, []() { ::bench::fixture<FIXTURE>(); })
+
+#endif // _BENCHMARKS_BENCH_H_
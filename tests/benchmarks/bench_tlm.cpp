@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "bench.h"
+#include "bench_tlm.h"
+#include <scc/peq.h>
+#include <scc/router.h>
+#include <scc/utilities.h>
+#include <tlm/scc/tlm_mm.h>
+#if SC_VERSION_MAJOR > 2
+#include <tlm/scc/quantum_keeper_mt.h>
+#endif
+
+namespace {
+using bench::mem_type;
+using bench::memory_fixture;
+
+void memory_read(bench::state& state, memory_fixture& f) { bench::run_b_transport(state, f.isck, tlm::TLM_READ_COMMAND); }
+SCC_BENCHMARK_F(memory_fixture, "memory/read", memory_read);
+
+void memory_write(bench::state& state, memory_fixture& f) { bench::run_b_transport(state, f.isck, tlm::TLM_WRITE_COMMAND); }
+SCC_BENCHMARK_F(memory_fixture, "memory/write", memory_write);
+
+void memory_dmi(bench::state& state, memory_fixture& f) {
+    tlm::tlm_generic_payload gp;
+    tlm::tlm_dmi dmi;
+    uint64_t addr = 0;
+    bool granted = true;
+    while(state.keep_running()) {
+        gp.set_command(tlm::TLM_READ_COMMAND);
+        gp.set_address(addr);
+        dmi.init();
+        granted &= f.isck->get_direct_mem_ptr(gp, dmi);
+        addr = (addr + bench::access_stride) & (bench::mem_size - 1);
+    }
+    if(!granted)
+        state.skip_with_error("DMI request was not granted");
+}
+SCC_BENCHMARK_F(memory_fixture, "memory/get_direct_mem_ptr", memory_dmi);
+
+// a router with 8 memories of 1MB each, the accesses are distributed across all of them
+unsigned const router_targets = 8;
+
+struct router_fixture : sc_core::sc_module {
+    bench::initiator_socket isck{"isck"};
+    scc::router<scc::LT> router{"router", router_targets, 1};
+    sc_core::sc_vector<mem_type> mems{"mem", router_targets};
+
+    router_fixture(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {
+        isck(router.target[0]);
+        for(unsigned i = 0; i < router_targets; ++i)
+            router.bind_target(mems[i].target, i, i * bench::mem_size, bench::mem_size);
+    }
+};
+
+void router_b_transport(bench::state& state, router_fixture& f) {
+    bench::run_b_transport(state, f.isck, tlm::TLM_READ_COMMAND, router_targets * bench::mem_size);
+}
+SCC_BENCHMARK_F(router_fixture, "router/b_transport", router_b_transport);
+
+struct peq_fixture : sc_core::sc_module {
+    scc::peq<uint64_t> peq{"peq"};
+
+    peq_fixture(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {}
+};
+
+void peq_notify_get(bench::state& state, peq_fixture& f) {
+    uint64_t i = 0;
+    while(state.keep_running()) {
+        f.peq.notify(i++);
+        bench::do_not_optimize(f.peq.get());
+    }
+}
+SCC_BENCHMARK_F(peq_fixture, "peq/notify_get", peq_notify_get);
+
+// a burst of timed notifications so that get() needs to wait for the simulation time to advance
+unsigned const peq_burst = 16;
+
+void peq_timed_notify_get(bench::state& state, peq_fixture& f) {
+    while(state.keep_running()) {
+        for(uint64_t i = 0; i < peq_burst; ++i)
+            f.peq.notify(i, sc_core::sc_time(static_cast<double>(i), sc_core::SC_NS));
+        for(unsigned i = 0; i < peq_burst; ++i)
+            bench::do_not_optimize(f.peq.get());
+    }
+    state.set_items_processed(state.iterations() * peq_burst);
+}
+SCC_BENCHMARK_F(peq_fixture, "peq/timed_notify_get", peq_timed_notify_get);
+
+void tlm_mm_allocate_free(bench::state& state) {
+    auto& mm = tlm::scc::tlm_mm<>::get();
+    while(state.keep_running()) {
+        auto* gp = mm.allocate();
+        gp->acquire();
+        bench::do_not_optimize(gp);
+        gp->release();
+    }
+}
+SCC_BENCHMARK("tlm_mm/allocate_free", tlm_mm_allocate_free);
+
+void tlm_mm_allocate_data_free(bench::state& state) {
+    auto& mm = tlm::scc::tlm_mm<>::get();
+    while(state.keep_running()) {
+        auto* gp = mm.allocate(64);
+        gp->acquire();
+        bench::do_not_optimize(gp);
+        gp->release();
+    }
+}
+SCC_BENCHMARK("tlm_mm/allocate_data64_free", tlm_mm_allocate_data_free);
+
+#if SC_VERSION_MAJOR > 2
+// the quantum keeper thread synchronizes every 100 iterations, the helper thread keeps the SystemC time advancing
+struct quantumkeeper_mt_fixture : sc_core::sc_module {
+    tlm::scc::quantumkeeper_mt qk;
+    bool active{false};
+    sc_core::sc_event start_evt;
+
+    quantumkeeper_mt_fixture(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {
+        tlm::tlm_global_quantum::instance().set(sc_core::sc_time(1, sc_core::SC_US));
+        SC_HAS_PROCESS(quantumkeeper_mt_fixture);
+        SC_THREAD(advance);
+    }
+
+    void advance() {
+        while(true) {
+            if(!active)
+                wait(start_evt);
+            wait(tlm::tlm_global_quantum::instance().get());
+        }
+    }
+};
+
+void quantumkeeper_mt_sync(bench::state& state, quantumkeeper_mt_fixture& f) {
+    f.active = true;
+    f.start_evt.notify();
+    f.qk.run_thread([&state, &f]() {
+        sc_core::sc_time const inc(10, sc_core::SC_NS);
+        while(state.keep_running())
+            f.qk.check_and_sync(inc);
+        return f.qk.get_local_absolute_time();
+    });
+    f.active = false;
+}
+SCC_BENCHMARK_F(quantumkeeper_mt_fixture, "quantumkeeper_mt/check_and_sync", quantumkeeper_mt_sync);
+#endif
+} // namespace
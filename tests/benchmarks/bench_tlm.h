@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _BENCHMARKS_BENCH_TLM_H_
+#define _BENCHMARKS_BENCH_TLM_H_
+
+#include "bench.h"
+#include <array>
+#include <scc/memory.h>
+#include <scc/utilities.h>
+#include <tlm/scc/initiator_mixin.h>
+#include <tlm/scc/tlm_mm.h>
+#include <tlm>
+
+namespace bench {
+//! the size of the memories used by the TLM benchmarks
+unsigned long long const mem_size = 1ULL << 20;
+//! the address increment between two accesses, a cache line
+unsigned const access_stride = 64;
+
+using initiator_socket = tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>>;
+
+using mem_type = scc::memory<mem_size, scc::LT>;
+/**
+ * @struct memory_fixture
+ * @brief an initiator socket directly bound to a memory
+ */
+struct memory_fixture : sc_core::sc_module {
+    initiator_socket isck{"isck"};
+    mem_type mem{"mem"};
+
+    memory_fixture(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {
+        isck(mem.target);
+    }
+};
+/**
+ * @brief issues 8 byte accesses with a stride of access_stride thru the given socket until the benchmark finishes
+ *
+ * @param state the benchmark state
+ * @param isck the socket to use
+ * @param cmd the command of the accesses
+ * @param addr_range the (power of 2) size of the address range to cycle thru
+ * @param use_mm if true each access uses a new payload from tlm::scc::tlm_mm as SCC initiators do, otherwise a single
+ * payload without memory manager is reused
+ */
+template <typename SOCKET>
+void run_b_transport(state& state, SOCKET& isck, tlm::tlm_command cmd, uint64_t addr_range = mem_size, bool use_mm = false) {
+    std::array<uint8_t, 8> data{};
+    tlm::tlm_generic_payload plain_gp;
+    sc_core::sc_time delay;
+    uint64_t addr = 0;
+    bool ok = true;
+    while(state.keep_running()) {
+        auto* gp = use_mm ? tlm::scc::tlm_mm<>::get().allocate() : &plain_gp;
+        if(use_mm)
+            gp->acquire();
+        gp->set_command(cmd);
+        gp->set_address(addr);
+        gp->set_data_ptr(data.data());
+        gp->set_data_length(data.size());
+        gp->set_streaming_width(data.size());
+        gp->set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        isck->b_transport(*gp, delay);
+        ok &= gp->is_response_ok();
+        if(use_mm) {
+            gp->set_data_ptr(nullptr);
+            gp->release();
+        }
+        addr = (addr + access_stride) & (addr_range - 1);
+    }
+    if(!ok)
+        state.skip_with_error("b_transport returned an error response");
+}
+} // namespace bench
+
+#endif // _BENCHMARKS_BENCH_TLM_H_
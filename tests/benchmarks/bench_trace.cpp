@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "bench.h"
+#include "bench_tlm.h"
+#include <lwtr/lwtr.h>
+#include <scc/scv/scv_tr_db.h>
+#include <scc/trace.h>
+#include <tlm/scc/lwtr/tlm2_lwtr.h>
+#include <tlm/scc/scv/tlm_recorder_module.h>
+
+namespace {
+/**
+ * signals changing every ns, the trace file only records while the benchmark using it runs so that the other
+ * benchmarks are not slowed down by it
+ */
+unsigned const signal_count = 64;
+
+struct signal_fixture : sc_core::sc_module {
+    sc_core::sc_vector<sc_core::sc_signal<uint32_t>> sigs{"sig", signal_count};
+    sc_core::sc_trace_file* tf{nullptr};
+    bool enabled{false};
+
+    signal_fixture(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {}
+
+    std::function<bool()> enable_fct() {
+        return [this]() { return enabled; };
+    }
+
+    void trace_signals() {
+        for(auto& s : sigs)
+            sc_core::sc_trace(tf, s, s.name());
+    }
+};
+
+struct vcd_pull_fixture : signal_fixture {
+    vcd_pull_fixture(sc_core::sc_module_name const& nm)
+    : signal_fixture(nm) {
+        tf = scc::create_vcd_pull_trace_file("bench_vcd_pull", enable_fct());
+        trace_signals();
+    }
+    ~vcd_pull_fixture() { scc::close_vcd_pull_trace_file(tf); }
+};
+
+struct vcd_push_fixture : signal_fixture {
+    vcd_push_fixture(sc_core::sc_module_name const& nm)
+    : signal_fixture(nm) {
+        tf = scc::create_vcd_push_trace_file("bench_vcd_push", enable_fct());
+        trace_signals();
+    }
+    ~vcd_push_fixture() { scc::close_vcd_push_trace_file(tf); }
+};
+
+#ifdef WITH_FST
+struct fst_fixture : signal_fixture {
+    fst_fixture(sc_core::sc_module_name const& nm)
+    : signal_fixture(nm) {
+        tf = scc::create_fst_trace_file("bench_fst", enable_fct());
+        trace_signals();
+    }
+    ~fst_fixture() { scc::close_fst_trace_file(tf); }
+};
+#endif
+
+void change_signals(bench::state& state, signal_fixture& f) {
+    f.enabled = true;
+    uint32_t val = 0;
+    sc_core::sc_time const period(1, sc_core::SC_NS);
+    while(state.keep_running()) {
+        ++val;
+        for(auto& s : f.sigs)
+            s.write(val);
+        sc_core::wait(period);
+    }
+    f.enabled = false;
+    state.set_items_processed(state.iterations() * f.sigs.size());
+}
+// the reference without any trace file, the difference to it is the cost of tracing
+SCC_BENCHMARK_F(signal_fixture, "trace/none", change_signals);
+SCC_BENCHMARK_F(vcd_pull_fixture, "trace/vcd_pull", change_signals);
+SCC_BENCHMARK_F(vcd_push_fixture, "trace/vcd_push", change_signals);
+#ifdef WITH_FST
+SCC_BENCHMARK_F(fst_fixture, "trace/fst", change_signals);
+#endif
+
+lwtr::tx_db* create_lwtr_db() {
+    lwtr::tx_ftr_init(false);
+    return new lwtr::tx_db("bench_lwtr");
+}
+
+struct lwtr_fixture : sc_core::sc_module {
+    std::unique_ptr<lwtr::tx_db> db{create_lwtr_db()};
+    bench::initiator_socket isck{"isck"};
+    tlm::scc::lwtr::tlm2_lwtr_recorder<scc::LT> rec{"rec", true, db.get()};
+    bench::mem_type mem{"mem"};
+
+    lwtr_fixture(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {
+        isck(rec.ts);
+        rec.is(mem.target);
+    }
+};
+
+SCVNS scv_tr_db* create_scv_db() {
+    SCVNS scv_tr_ftr_init(false);
+    return new SCVNS scv_tr_db("bench_scv");
+}
+
+struct scv_fixture : sc_core::sc_module {
+    std::unique_ptr<SCVNS scv_tr_db> db{create_scv_db()};
+    bench::initiator_socket isck{"isck"};
+    tlm::scc::scv::tlm_recorder_module<scc::LT> rec{"rec", true, db.get()};
+    bench::mem_type mem{"mem"};
+
+    scv_fixture(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {
+        isck(rec.ts);
+        rec.is(mem.target);
+    }
+};
+
+template <typename FIXTURE> void record_transactions(bench::state& state, FIXTURE& f) {
+    bench::run_b_transport(state, f.isck, tlm::TLM_WRITE_COMMAND, bench::mem_size, true);
+}
+// the reference without a recorder, the difference to it is the cost of recording
+SCC_BENCHMARK_F(bench::memory_fixture, "tx_recording/none", record_transactions<bench::memory_fixture>);
+SCC_BENCHMARK_F(lwtr_fixture, "tx_recording/lwtr", record_transactions<lwtr_fixture>);
+SCC_BENCHMARK_F(scv_fixture, "tx_recording/scv", record_transactions<scv_fixture>);
+} // namespace
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "bench.h"
+#include <array>
+#include <limits>
+#include <random>
+#include <util/pool_allocator.h>
+#include <util/range_lut.h>
+
+namespace {
+// 64 targets of 64kB each with a 64kB gap in between, about half of the lookups hit a target
+unsigned const lut_entries = 64;
+uint64_t const lut_range = 0x10000;
+
+void range_lut_lookup(bench::state& state) {
+    util::range_lut<unsigned> lut(std::numeric_limits<unsigned>::max());
+    for(unsigned i = 0; i < lut_entries; ++i)
+        lut.addEntry(i, i * 2 * lut_range, lut_range);
+    std::array<uint64_t, 1024> addresses;
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<uint64_t> dist(0, lut_entries * 2 * lut_range + lut_range);
+    for(auto& a : addresses)
+        a = dist(rng);
+    size_t idx = 0;
+    while(state.keep_running()) {
+        bench::do_not_optimize(lut.getEntry(addresses[idx]));
+        idx = (idx + 1) & (addresses.size() - 1);
+    }
+}
+SCC_BENCHMARK("range_lut/lookup", range_lut_lookup);
+
+void pool_allocator_alloc_free(bench::state& state) {
+    auto& alloc = util::pool_allocator<256>::get();
+    while(state.keep_running()) {
+        auto* p = alloc.allocate();
+        bench::do_not_optimize(p);
+        alloc.free(p);
+    }
+}
+SCC_BENCHMARK("pool_allocator/alloc_free", pool_allocator_alloc_free);
+
+void pool_allocator_burst(bench::state& state) {
+    auto& alloc = util::pool_allocator<256>::get();
+    std::array<void*, 64> ptrs;
+    while(state.keep_running()) {
+        for(auto& p : ptrs)
+            p = alloc.allocate();
+        bench::do_not_optimize(ptrs);
+        for(auto* p : ptrs)
+            alloc.free(p);
+    }
+    state.set_items_processed(state.iterations() * ptrs.size());
+}
+SCC_BENCHMARK("pool_allocator/burst64", pool_allocator_burst);
+} // namespace
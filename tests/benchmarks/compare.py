@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+################################################################################
+# Copyright 2026 MINRES Technologies GmbH
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+"""Compares benchmark results in Google Benchmark JSON format against a stored baseline.
+
+Several result files (e.g. of scc_benchmarks and of the scenario runs) can be given for the baseline and the current
+run, they are merged by benchmark name. The exit code is 1 if any benchmark got slower than the threshold allows.
+
+    compare.py baseline.json current.json [more_current.json ...] --threshold 10
+    compare.py --baseline a.json b.json --current c.json d.json
+"""
+
+import argparse
+import json
+import sys
+
+TIME_UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(files):
+    """Returns a dict name -> benchmark entry with the times normalized to ns, aggregates are skipped."""
+    result = {}
+    for fname in files:
+        with open(fname) as f:
+            data = json.load(f)
+        for bm in data.get("benchmarks", []):
+            if bm.get("run_type", "iteration") != "iteration" or bm.get("error_occurred", False):
+                continue
+            factor = TIME_UNITS[bm.get("time_unit", "ns")]
+            entry = dict(bm)
+            entry["real_time"] = bm["real_time"] * factor
+            entry["cpu_time"] = bm["cpu_time"] * factor
+            result[bm["name"]] = entry
+    return result
+
+
+def format_time(ns):
+    for unit in ("s", "ms", "us"):
+        if ns >= TIME_UNITS[unit]:
+            return "{:.3f}{}".format(ns / TIME_UNITS[unit], unit)
+    return "{:.1f}ns".format(ns)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("files", nargs="*", help="the baseline followed by the current result file(s)")
+    parser.add_argument("--baseline", nargs="+", default=[], help="baseline result file(s)")
+    parser.add_argument("--current", nargs="+", default=[], help="current result file(s)")
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent (default: %(default)s)")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="cpu_time",
+                        help="the time to compare (default: %(default)s)")
+    parser.add_argument("--filter", default="", help="only compare benchmarks whose name contains this string")
+    args = parser.parse_args()
+
+    if args.baseline:
+        baseline_files, current_files = args.baseline, args.current + args.files
+    else:
+        baseline_files, current_files = args.files[:1], args.current + args.files[1:]
+    if not baseline_files or not current_files:
+        parser.error("a baseline and at least one current result file are required")
+
+    baseline = load(baseline_files)
+    current = load(current_files)
+    names = [n for n in current if args.filter in n]
+    width = max([len(n) for n in names] + [9])
+    print("{:<{w}} {:>12} {:>12} {:>9}".format("Benchmark", "Baseline", "Current", "Change", w=width))
+    print("-" * (width + 36))
+    regressions = []
+    for name in sorted(names):
+        cur = current[name][args.metric]
+        if name not in baseline:
+            print("{:<{w}} {:>12} {:>12} {:>9}".format(name, "-", format_time(cur), "new", w=width))
+            continue
+        base = baseline[name][args.metric]
+        change = (cur - base) / base * 100.0 if base > 0 else 0.0
+        mark = ""
+        if change > args.threshold:
+            mark = " REGRESSION"
+            regressions.append(name)
+        print("{:<{w}} {:>12} {:>12} {:>+8.1f}%{}".format(name, format_time(base), format_time(cur), change, mark, w=width))
+    for name in sorted(n for n in baseline if n not in current and args.filter in n):
+        print("{:<{w}} {:>12} {:>12} {:>9}".format(name, format_time(baseline[name][args.metric]), "-", "missing", w=width))
+    if regressions:
+        print("\n{} benchmark(s) slower than the threshold of {}%: {}".format(len(regressions), args.threshold,
+                                                                            ", ".join(regressions)))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+/*
+ * The end-to-end scenario runner. In contrast to the micro benchmarks each scenario is a complete small platform which
+ * is elaborated and simulated for a fixed simulated time, as a SystemC kernel can only be elaborated once a single
+ * scenario is run per invocation. The result uses the same JSON format as the micro benchmarks with one iteration
+ * being the whole simulation.
+ */
+
+#include "bench.h"
+#include "bench_tlm.h"
+#include <algorithm>
+#include <iostream>
+#include <lwtr/lwtr.h>
+#include <random>
+#include <scc/configurer.h>
+#include <scc/report.h>
+#include <scc/router.h>
+#include <scc/trace.h>
+#include <tlm/scc/lwtr/tlm2_lwtr.h>
+#include <tlm_utils/tlm_quantumkeeper.h>
+
+namespace {
+/**
+ * @struct scenario_top
+ * @brief the top level module of a scenario
+ */
+struct scenario_top : sc_core::sc_module {
+    scenario_top(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {}
+    //! the number of items (clock cycles, transactions, signal changes) processed during the simulation
+    virtual uint64_t processed_items() const = 0;
+};
+/**
+ * a bare clock as tests/sim_speed uses it, it measures the raw scheduler performance
+ */
+struct clock_top : scenario_top {
+    sc_core::sc_clock clk{"clk", 1, sc_core::SC_NS};
+
+    clock_top(sc_core::sc_module_name const& nm)
+    : scenario_top(nm) {}
+
+    uint64_t processed_items() const override { return static_cast<uint64_t>(sc_core::sc_time_stamp() / clk.period()); }
+};
+/**
+ * a loosely timed initiator issuing random 8 byte reads and writes, each access takes 10ns
+ */
+struct lt_initiator : sc_core::sc_module {
+    bench::initiator_socket isck{"isck"};
+    uint64_t transactions{0};
+
+    lt_initiator(sc_core::sc_module_name const& nm, uint64_t addr_range)
+    : sc_core::sc_module(nm)
+    , addr_range(addr_range) {
+        SC_HAS_PROCESS(lt_initiator);
+        SC_THREAD(run);
+    }
+
+private:
+    void run() {
+        tlm_utils::tlm_quantumkeeper qk;
+        qk.reset();
+        std::mt19937_64 rng(std::hash<std::string>()(name()));
+        std::uniform_int_distribution<uint64_t> addr_dist(0, addr_range / 8 - 1);
+        std::array<uint8_t, 8> data{};
+        tlm::tlm_generic_payload gp;
+        gp.set_data_ptr(data.data());
+        gp.set_data_length(data.size());
+        gp.set_streaming_width(data.size());
+        sc_core::sc_time const access_time(10, sc_core::SC_NS);
+        while(true) {
+            gp.set_command(rng() & 1 ? tlm::TLM_WRITE_COMMAND : tlm::TLM_READ_COMMAND);
+            gp.set_address(addr_dist(rng) * 8);
+            gp.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+            auto delay = qk.get_local_time();
+            isck->b_transport(gp, delay);
+            if(!gp.is_response_ok())
+                SCCERR(SCMOD) << "access to 0x" << std::hex << gp.get_address() << " failed";
+            qk.set(delay + access_time);
+            transactions++;
+            if(qk.need_sync())
+                qk.sync();
+        }
+    }
+    uint64_t const addr_range;
+};
+/**
+ * 4 LT initiators accessing 4 memories thru a router, optionally recording all transactions of the initiators
+ */
+template <bool RECORD> struct tlm_lt_top : scenario_top {
+    static constexpr unsigned count = 4;
+    using recorder_type = tlm::scc::lwtr::tlm2_lwtr_recorder<scc::LT>;
+    std::unique_ptr<lwtr::tx_db> db;
+    sc_core::sc_vector<lt_initiator> initiators{"initiator"};
+    sc_core::sc_vector<recorder_type> recorders{"recorder"};
+    scc::router<scc::LT> router{"router", count, count};
+    sc_core::sc_vector<bench::mem_type> mems{"mem", count};
+
+    tlm_lt_top(sc_core::sc_module_name const& nm)
+    : scenario_top(nm) {
+        tlm_utils::tlm_quantumkeeper::set_global_quantum(sc_core::sc_time(1, sc_core::SC_US));
+        initiators.init(count, [](char const* name, size_t) { return new lt_initiator(name, count * bench::mem_size); });
+        if(RECORD) {
+            lwtr::tx_ftr_init(false);
+            db.reset(new lwtr::tx_db("scenario_tlm_lt"));
+            recorders.init(count, [this](char const* name, size_t) { return new recorder_type(name, true, db.get()); });
+        }
+        for(unsigned i = 0; i < count; ++i) {
+            if(RECORD) {
+                initiators[i].isck(recorders[i].ts);
+                recorders[i].is(router.target[i]);
+            } else
+                initiators[i].isck(router.target[i]);
+            router.bind_target(mems[i].target, i, i * bench::mem_size, bench::mem_size);
+        }
+    }
+
+    uint64_t processed_items() const override {
+        uint64_t res = 0;
+        for(auto const& i : initiators)
+            res += i.transactions;
+        return res;
+    }
+};
+/**
+ * a number of signals changing every clock cycle traced into a trace file
+ */
+template <sc_core::sc_trace_file* (*CREATE)(char const*, std::function<bool()>), void (*CLOSE)(sc_core::sc_trace_file*)>
+struct trace_top : scenario_top {
+    static constexpr unsigned count = 256;
+    sc_core::sc_clock clk{"clk", 10, sc_core::SC_NS};
+    sc_core::sc_vector<sc_core::sc_signal<uint32_t>> sigs{"sig", count};
+    uint64_t cycles{0};
+
+    trace_top(sc_core::sc_module_name const& nm, char const* file_name)
+    : scenario_top(nm)
+    , tf(CREATE(file_name, std::function<bool()>())) {
+        sc_core::sc_trace(tf, clk, clk.name());
+        for(auto& s : sigs)
+            sc_core::sc_trace(tf, s, s.name());
+        SC_HAS_PROCESS(trace_top);
+        SC_METHOD(update);
+        sensitive << clk.posedge_event();
+        dont_initialize();
+    }
+
+    ~trace_top() { CLOSE(tf); }
+
+    uint64_t processed_items() const override { return cycles * count; }
+
+private:
+    void update() {
+        ++cycles;
+        for(unsigned i = 0; i < count; ++i)
+            sigs[i].write(static_cast<uint32_t>(cycles * (i + 1)));
+    }
+    sc_core::sc_trace_file* tf;
+};
+
+struct scenario {
+    char const* name;
+    char const* description;
+    sc_core::sc_time duration;
+    std::function<scenario_top*()> create;
+};
+
+std::vector<scenario> const& scenarios() {
+    using namespace sc_core;
+    static std::vector<scenario> const sc{
+        {"clock", "a bare 1GHz sc_clock", sc_time(10, SC_MS), []() -> scenario_top* { return new clock_top("top"); }},
+        {"tlm_lt", "4 LT initiators, a router and 4 memories", sc_time(10, SC_MS),
+         []() -> scenario_top* { return new tlm_lt_top<false>("top"); }},
+        {"tlm_lt_recorded", "tlm_lt with lwtr recording of all initiator transactions", sc_time(10, SC_MS),
+         []() -> scenario_top* { return new tlm_lt_top<true>("top"); }},
+        {"trace_vcd_pull", "256 signals changing every 10ns traced to a VCD file", sc_time(1, SC_MS),
+         []() -> scenario_top* {
+             return new trace_top<scc::create_vcd_pull_trace_file, scc::close_vcd_pull_trace_file>("top", "scenario_vcd_pull");
+         }},
+        {"trace_vcd_push", "256 signals changing every 10ns traced to a VCD file written while simulating", sc_time(1, SC_MS),
+         []() -> scenario_top* {
+             return new trace_top<scc::create_vcd_push_trace_file, scc::close_vcd_push_trace_file>("top", "scenario_vcd_push");
+         }},
+#ifdef WITH_FST
+        {"trace_fst", "256 signals changing every 10ns traced to a FST file", sc_time(1, SC_MS),
+         []() -> scenario_top* { return new trace_top<scc::create_fst_trace_file, scc::close_fst_trace_file>("top", "scenario_fst"); }},
+#endif
+    };
+    return sc;
+}
+
+int usage(char const* prog, int ret) {
+    std::cerr << "usage: " << prog
+              << " --scenario=<name> [--scale=<factor>] [--benchmark_out=<file>] [--benchmark_format=<console|json>] | --list\n";
+    return ret;
+}
+} // namespace
+
+int sc_main(int argc, char* argv[]) {
+    sc_core::sc_report_handler::set_actions("/IEEE_Std_1666/deprecated", sc_core::SC_DO_NOTHING);
+    scc::init_logging(scc::LogConfig().logLevel(scc::log::WARNING).logAsync(false));
+    scc::configurer cfg("");
+    std::string name, out_file;
+    double scale = 1.0;
+    bool json = false;
+    for(int i = 1; i < argc; ++i) {
+        std::string const arg(argv[i]);
+        std::string val;
+        if(arg == "--list") {
+            for(auto const& s : scenarios())
+                std::cout << s.name << ": " << s.description << " (" << s.duration << ")\n";
+            return 0;
+        } else if(bench::get_option(arg, "--scenario", val))
+            name = val;
+        else if(bench::get_option(arg, "--scale", val))
+            scale = std::stod(val);
+        else if(bench::get_option(arg, "--benchmark_out", val))
+            out_file = val;
+        else if(bench::get_option(arg, "--benchmark_format", val))
+            json = val == "json";
+        else
+            return usage(argv[0], arg == "--help" || arg == "-h" ? 0 : 1);
+    }
+    auto it = std::find_if(scenarios().begin(), scenarios().end(), [&name](scenario const& s) { return name == s.name; });
+    if(it == scenarios().end() || scale <= 0)
+        return usage(argv[0], 1);
+    std::unique_ptr<scenario_top> top(it->create());
+    auto const duration = it->duration * scale;
+    auto const real_start = std::chrono::steady_clock::now();
+    auto const cpu_start = std::clock();
+    sc_core::sc_start(duration);
+    auto const real_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - real_start).count();
+    auto const cpu_time = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    bench::result res;
+    res.name = std::string("scenario/") + it->name;
+    res.iterations = 1;
+    res.real_time = real_time * 1e9;
+    res.cpu_time = cpu_time * 1e9;
+    res.counters.emplace_back("sim_time_s", sc_core::sc_time_stamp().to_seconds());
+    res.counters.emplace_back("sim_wall_ratio", sc_core::sc_time_stamp().to_seconds() / real_time);
+    res.counters.emplace_back("items_per_second", top->processed_items() / real_time);
+    sc_core::sc_stop();
+    top.reset();
+    if(!bench::write_results({res}, out_file, json))
+        return 1;
+    return sc_core::sc_report_handler::get_count(sc_core::SC_ERROR) ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+#include <algorithm>
+#include <array>
+#include <axi/axi_initiator.h>
+#include <axi/axi_target.h>
+#include <axi/pin/axi4_initiator.h>
+#include <axi/pin/axi4_target.h>
+#include <cstring>
+#include <factory.h>
+#include <scc/fidelity_switch.h>
+#include <scc/utilities.h>
+#include <systemc>
+#include <tlm/scc/initiator_mixin.h>
+#include <tlm/scc/target_mixin.h>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+//! a target taking 10ns per access and granting DMI to its storage
+struct slow_target : public sc_module {
+    tlm::scc::target_mixin<tlm::tlm_target_socket<scc::LT>> tsck{"tsck"};
+    std::array<uint8_t, 256> storage{};
+    unsigned accesses{0};
+
+    slow_target(sc_module_name const& nm)
+    : sc_module(nm) {
+        tsck.register_b_transport([this](tlm::tlm_generic_payload& gp, sc_time& d) {
+            wait(10_ns);
+            ++accesses;
+            if(gp.is_write())
+                memcpy(storage.data() + gp.get_address(), gp.get_data_ptr(), gp.get_data_length());
+            else
+                memcpy(gp.get_data_ptr(), storage.data() + gp.get_address(), gp.get_data_length());
+            gp.set_response_status(tlm::TLM_OK_RESPONSE);
+        });
+        tsck.register_transport_dbg([this](tlm::tlm_generic_payload& gp) -> unsigned {
+            memcpy(gp.get_data_ptr(), storage.data() + gp.get_address(), gp.get_data_length());
+            return gp.get_data_length();
+        });
+        tsck.register_get_direct_mem_ptr([this](tlm::tlm_generic_payload& gp, tlm::tlm_dmi& dmi_data) -> bool {
+            dmi_data.set_start_address(0);
+            dmi_data.set_end_address(storage.size() - 1);
+            dmi_data.set_dmi_ptr(storage.data());
+            dmi_data.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ_WRITE);
+            return true;
+        });
+    }
+};
+//! the detailed path converts the LT transactions to AXI and sends them over the pin-level BFMs
+struct fidelity_tb : public sc_module {
+    using bus_cfg = axi::axi4_cfg</*BUSWIDTH=*/64, /*ADDRWIDTH=*/32, /*IDWIDTH=*/4, /*USERWIDTH=*/1>;
+    sc_time clk_period{10_ns};
+    sc_clock clk{"clk", clk_period, 0.5, SC_ZERO_TIME, true};
+    tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>> isck{"isck"};
+    scc::fidelity_switch<> fsw{"fsw"};
+    axi::axi_initiator<bus_cfg::BUSWIDTH> axi_intor{"axi_intor"};
+    axi::pin::axi4_initiator<bus_cfg> intor_bfm{"intor_bfm"};
+    axi::aw_axi<bus_cfg, axi::signal_types> aw;
+    axi::wdata_axi<bus_cfg, axi::signal_types> wdata;
+    axi::b_axi<bus_cfg, axi::signal_types> b;
+    axi::ar_axi<bus_cfg, axi::signal_types> ar;
+    axi::rresp_axi<bus_cfg, axi::signal_types> rresp;
+    axi::pin::axi4_target<bus_cfg> tgt_bfm{"tgt_bfm"};
+    axi::axi_target<bus_cfg::BUSWIDTH> axi_tgt{"axi_tgt"};
+    slow_target target{"target"};
+    unsigned invalidations{0};
+    //! the number of address phases seen on the pins
+    unsigned pin_accesses{0};
+
+    SC_HAS_PROCESS(fidelity_tb);
+    fidelity_tb()
+    : fidelity_tb(sc_gen_unique_name("fidelity_tb", false)) {}
+
+    fidelity_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        isck(fsw.tsck);
+        fsw.isck(target.tsck);
+        fsw.detailed_isck(axi_intor.tsck);
+        axi_intor.clk_i(clk);
+        intor_bfm.clk_i(clk);
+        tgt_bfm.clk_i(clk);
+        axi_tgt.clk_i(clk);
+        axi_intor.isck(intor_bfm.tsckt);
+        intor_bfm.bind_aw(aw);
+        intor_bfm.bind_w(wdata);
+        intor_bfm.bind_b(b);
+        intor_bfm.bind_ar(ar);
+        intor_bfm.bind_r(rresp);
+        tgt_bfm.bind_aw(aw);
+        tgt_bfm.bind_w(wdata);
+        tgt_bfm.bind_b(b);
+        tgt_bfm.bind_ar(ar);
+        tgt_bfm.bind_r(rresp);
+        tgt_bfm.isckt(axi_tgt.tsck);
+        axi_tgt.isck(fsw.detailed_tsck);
+        isck.register_invalidate_direct_mem_ptr([this](sc_dt::uint64, sc_dt::uint64) { ++invalidations; });
+        SC_METHOD(count_pin_accesses);
+        sensitive << clk.posedge_event();
+        dont_initialize();
+    }
+
+    void count_pin_accesses() {
+        if(aw.aw_valid.read() && aw.aw_ready.read())
+            ++pin_accesses;
+        if(ar.ar_valid.read() && ar.ar_ready.read())
+            ++pin_accesses;
+    }
+};
+
+factory::add<fidelity_tb> tb;
+
+sc_process_handle access(tlm::tlm_command cmd, uint64_t addr, uint32_t& data) {
+    return sc_spawn([cmd, addr, &data]() {
+        tlm::tlm_generic_payload gp;
+        gp.set_command(cmd);
+        gp.set_address(addr);
+        gp.set_data_ptr(reinterpret_cast<unsigned char*>(&data));
+        gp.set_data_length(sizeof(data));
+        gp.set_streaming_width(sizeof(data));
+        sc_time d;
+        factory::get<fidelity_tb>().isck->b_transport(gp, d);
+    });
+}
+
+//! runs the simulation until the given processes have finished
+void run_until_done(std::initializer_list<sc_process_handle> procs) {
+    for(unsigned cycles = 0; cycles < 100; ++cycles) {
+        if(std::all_of(procs.begin(), procs.end(), [](sc_process_handle const& p) { return p.terminated(); }))
+            return;
+        sc_start(factory::get<fidelity_tb>().clk_period);
+    }
+}
+
+bool get_dmi(fidelity_tb& dut) {
+    tlm::tlm_generic_payload gp;
+    tlm::tlm_dmi dmi;
+    gp.set_command(tlm::TLM_READ_COMMAND);
+    gp.set_address(0);
+    return dut.isck->get_direct_mem_ptr(gp, dmi);
+}
+} // namespace
+
+TEST_CASE("fidelity_switch_mode_change", "[fidelity_switch][tlm-level]") {
+    auto& dut = factory::get<fidelity_tb>();
+    REQUIRE(get_dmi(dut));
+    uint32_t wdata0{0x11223344}, wdata1{0x55667788}, rdata{0};
+    // a transaction being outstanding in fast mode
+    auto fast_tx = access(tlm::TLM_WRITE_COMMAND, 0x10, wdata0);
+    sc_start(1_ns);
+    dut.fsw.set_detailed(true);
+    // DMI is revoked right away while the mode change waits for the outstanding transaction
+    REQUIRE(dut.invalidations == 1);
+    REQUIRE_FALSE(get_dmi(dut));
+    REQUIRE_FALSE(dut.fsw.is_detailed());
+    auto detailed_tx = access(tlm::TLM_WRITE_COMMAND, 0x14, wdata1);
+    sc_start(5_ns);
+    REQUIRE_FALSE(dut.fsw.is_detailed());
+    REQUIRE(dut.pin_accesses == 0);
+    run_until_done({fast_tx, detailed_tx});
+    REQUIRE(fast_tx.terminated());
+    REQUIRE(detailed_tx.terminated());
+    REQUIRE(dut.fsw.is_detailed());
+    REQUIRE(dut.pin_accesses == 1);
+    REQUIRE(dut.target.accesses == 2);
+    REQUIRE_FALSE(get_dmi(dut));
+    // back to fast mode with a transaction outstanding in the detailed path
+    auto detailed_rd = access(tlm::TLM_READ_COMMAND, 0x10, rdata);
+    sc_start(1_ns);
+    dut.fsw.set_detailed(false);
+    REQUIRE(dut.invalidations == 1);
+    REQUIRE_FALSE(get_dmi(dut));
+    uint32_t rdata1{0};
+    auto fast_rd = access(tlm::TLM_READ_COMMAND, 0x14, rdata1);
+    run_until_done({detailed_rd, fast_rd});
+    REQUIRE(detailed_rd.terminated());
+    REQUIRE(fast_rd.terminated());
+    REQUIRE_FALSE(dut.fsw.is_detailed());
+    REQUIRE(dut.pin_accesses == 2);
+    REQUIRE(dut.target.accesses == 4);
+    REQUIRE(rdata == wdata0);
+    REQUIRE(rdata1 == wdata1);
+    REQUIRE(get_dmi(dut));
+    // debug accesses always use the direct path
+    dut.fsw.set_detailed(true);
+    REQUIRE(dut.invalidations == 2);
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_READ_COMMAND);
+    gp.set_address(0x14);
+    gp.set_data_ptr(reinterpret_cast<unsigned char*>(&rdata));
+    gp.set_data_length(sizeof(rdata));
+    REQUIRE(dut.isck->transport_dbg(gp) == sizeof(rdata));
+    REQUIRE(rdata == wdata1);
+    REQUIRE(dut.pin_accesses == 2);
+    dut.fsw.set_detailed(false);
+}
@@ -0,0 +1,228 @@
+#include <array>
+#include <cstring>
+#include <factory.h>
+#include <functional>
+#include <scc/line_buffer.h>
+#include <scc/utilities.h>
+#include <systemc>
+#include <tlm/scc/initiator_mixin.h>
+#include <tlm/scc/target_mixin.h>
+#include <vector>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+//! a memory recording the accesses it receives, it grants DMI for the upper half
+struct line_buffer_target : public sc_module {
+    struct access {
+        tlm::tlm_command cmd;
+        uint64_t addr;
+        unsigned len;
+        std::vector<uint8_t> be;
+        bool dbg;
+        sc_time time;
+    };
+    tlm::scc::target_mixin<tlm::tlm_target_socket<scc::LT>> tsck{"tsck"};
+    std::array<uint8_t, 8192> storage{};
+    std::vector<access> accesses;
+
+    line_buffer_target(sc_module_name const& nm)
+    : sc_module(nm) {
+        tsck.register_b_transport([this](tlm::tlm_generic_payload& gp, sc_time& d) { transfer(gp, false); });
+        tsck.register_transport_dbg([this](tlm::tlm_generic_payload& gp) -> unsigned { return transfer(gp, true); });
+        tsck.register_get_direct_mem_ptr([this](tlm::tlm_generic_payload& gp, tlm::tlm_dmi& dmi_data) -> bool {
+            if(gp.get_address() < 0x800 || gp.get_address() > 0xfff)
+                return false;
+            dmi_data.set_start_address(0x800);
+            dmi_data.set_end_address(0xfff);
+            dmi_data.set_dmi_ptr(storage.data() + 0x800);
+            dmi_data.set_granted_access(tlm::tlm_dmi::DMI_ACCESS_READ_WRITE);
+            return true;
+        });
+    }
+
+    unsigned transfer(tlm::tlm_generic_payload& gp, bool dbg) {
+        auto const len = gp.get_data_length();
+        access a{gp.get_command(), gp.get_address(), len, {}, dbg, sc_time_stamp()};
+        auto be = gp.get_byte_enable_ptr();
+        if(be)
+            a.be.assign(be, be + gp.get_byte_enable_length());
+        accesses.push_back(a);
+        for(auto i = 0U; i < len; ++i)
+            if(gp.is_read())
+                gp.get_data_ptr()[i] = storage[gp.get_address() + i];
+            else if(!be || be[i])
+                storage[gp.get_address() + i] = gp.get_data_ptr()[i];
+        gp.set_response_status(tlm::TLM_OK_RESPONSE);
+        return len;
+    }
+};
+
+struct line_buffer_tb : public sc_module {
+    tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>> isck{"isck"};
+    scc::line_buffer<> lb{"lb"};
+    line_buffer_target target{"target"};
+
+    line_buffer_tb()
+    : line_buffer_tb(sc_gen_unique_name("line_buffer_tb", false)) {}
+
+    line_buffer_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        isck(lb.tsck);
+        lb.isck(target.tsck);
+        lb.line_size.set_value(16);
+        lb.add_region(0, 4_kB);
+    }
+};
+
+factory::add<line_buffer_tb> tb;
+
+void access(tlm::tlm_command cmd, uint64_t addr, uint32_t& data) {
+    tlm::tlm_generic_payload gp;
+    gp.set_command(cmd);
+    gp.set_address(addr);
+    gp.set_data_ptr(reinterpret_cast<unsigned char*>(&data));
+    gp.set_data_length(sizeof(data));
+    gp.set_streaming_width(sizeof(data));
+    sc_time d;
+    factory::get<line_buffer_tb>().isck->b_transport(gp, d);
+    REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+}
+//! runs the accesses in a thread of the simulation
+void run(std::function<void()> const& f) {
+    auto p = sc_spawn(f);
+    sc_start(1_ns);
+    REQUIRE(p.terminated());
+}
+} // namespace
+
+TEST_CASE("line_buffer_write_combining", "[line_buffer][tlm-level]") {
+    auto& dut = factory::get<line_buffer_tb>();
+    auto& acc = dut.target.accesses;
+    acc.clear();
+    // a completed line is written as a whole
+    run([]() {
+        for(uint32_t i = 0; i < 4; ++i) {
+            uint32_t data = 0x11111111 * (i + 1);
+            access(tlm::TLM_WRITE_COMMAND, 4 * i, data);
+        }
+    });
+    REQUIRE(acc.size() == 1);
+    REQUIRE(acc[0].cmd == tlm::TLM_WRITE_COMMAND);
+    REQUIRE(acc[0].addr == 0x0);
+    REQUIRE(acc[0].len == 16);
+    REQUIRE(acc[0].be.empty());
+    REQUIRE(dut.target.storage[0xc] == 0x44);
+    acc.clear();
+    // a partial line is written with byte enables once the flush delay expires
+    auto const start = sc_time_stamp();
+    run([]() {
+        uint32_t data0 = 0xaaaaaaaa, data1 = 0xbbbbbbbb;
+        access(tlm::TLM_WRITE_COMMAND, 0x10, data0);
+        access(tlm::TLM_WRITE_COMMAND, 0x18, data1);
+    });
+    REQUIRE(acc.empty());
+    sc_start(150_ns);
+    REQUIRE(acc.size() == 1);
+    REQUIRE(acc[0].addr == 0x10);
+    REQUIRE(acc[0].len == 12);
+    REQUIRE(acc[0].be == std::vector<uint8_t>{0xff, 0xff, 0xff, 0xff, 0, 0, 0, 0, 0xff, 0xff, 0xff, 0xff});
+    REQUIRE(acc[0].time == start + 100_ns);
+    REQUIRE(dut.target.storage[0x14] == 0);
+    REQUIRE(dut.target.storage[0x18] == 0xbb);
+}
+
+TEST_CASE("line_buffer_read_after_write", "[line_buffer][tlm-level]") {
+    auto& dut = factory::get<line_buffer_tb>();
+    auto& acc = dut.target.accesses;
+    dut.target.storage[0x20] = 0x5a;
+    acc.clear();
+    // the prefetched line contains the pending write data
+    uint32_t rdata0{0}, rdata1{0};
+    run([&rdata0, &rdata1]() {
+        uint32_t data = 0x12345678;
+        access(tlm::TLM_WRITE_COMMAND, 0x24, data);
+        access(tlm::TLM_READ_COMMAND, 0x20, rdata0);
+        access(tlm::TLM_READ_COMMAND, 0x24, rdata1);
+    });
+    REQUIRE(acc.size() == 1);
+    REQUIRE(acc[0].cmd == tlm::TLM_READ_COMMAND);
+    REQUIRE(acc[0].addr == 0x20);
+    REQUIRE(acc[0].len == 16);
+    REQUIRE((rdata0 & 0xff) == 0x5a);
+    REQUIRE(rdata1 == 0x12345678);
+    REQUIRE(dut.target.storage[0x24] == 0);
+    sc_start(150_ns);
+    REQUIRE(acc.size() == 2);
+    REQUIRE(dut.target.storage[0x24] == 0x78);
+}
+
+TEST_CASE("line_buffer_device_ordering", "[line_buffer][tlm-level]") {
+    auto& dut = factory::get<line_buffer_tb>();
+    auto& acc = dut.target.accesses;
+    acc.clear();
+    // an access to a device region is ordered after the buffered writes
+    run([]() {
+        uint32_t data = 0xcafe;
+        access(tlm::TLM_WRITE_COMMAND, 0x30, data);
+        access(tlm::TLM_WRITE_COMMAND, 0x1000, data);
+        access(tlm::TLM_READ_COMMAND, 0x1004, data);
+    });
+    REQUIRE(acc.size() == 3);
+    REQUIRE(acc[0].addr == 0x30);
+    REQUIRE(acc[1].addr == 0x1000);
+    REQUIRE(acc[1].cmd == tlm::TLM_WRITE_COMMAND);
+    REQUIRE(acc[2].addr == 0x1004);
+    REQUIRE(acc[2].len == 4);
+}
+
+TEST_CASE("line_buffer_dmi", "[line_buffer][tlm-level]") {
+    auto& dut = factory::get<line_buffer_tb>();
+    auto& acc = dut.target.accesses;
+    acc.clear();
+    // a DMI request commits the pending write and drops the prefetch line
+    uint32_t rdata{0};
+    run([&rdata]() {
+        uint32_t data = 0x01020304;
+        access(tlm::TLM_READ_COMMAND, 0x880, rdata);
+        access(tlm::TLM_WRITE_COMMAND, 0x840, data);
+    });
+    REQUIRE(acc.size() == 1);
+    tlm::tlm_generic_payload gp;
+    tlm::tlm_dmi dmi;
+    gp.set_command(tlm::TLM_READ_COMMAND);
+    gp.set_address(0x880);
+    REQUIRE(dut.isck->get_direct_mem_ptr(gp, dmi));
+    REQUIRE(acc.size() == 2);
+    REQUIRE(acc[1].dbg);
+    REQUIRE(acc[1].addr == 0x840);
+    REQUIRE(dut.target.storage[0x840] == 0x04);
+    acc.clear();
+    // while the DMI pointer is valid its range is not buffered
+    dmi.get_dmi_ptr()[0x80] = 0x77;
+    run([&rdata]() {
+        uint32_t data = 0x0a0b0c0d;
+        access(tlm::TLM_WRITE_COMMAND, 0x844, data);
+        access(tlm::TLM_READ_COMMAND, 0x880, rdata);
+    });
+    REQUIRE(acc.size() == 2);
+    REQUIRE(acc[0].addr == 0x844);
+    REQUIRE(acc[0].len == 4);
+    REQUIRE(acc[1].addr == 0x880);
+    REQUIRE(acc[1].len == 4);
+    REQUIRE((rdata & 0xff) == 0x77);
+    REQUIRE(dmi.get_dmi_ptr()[0x44] == 0x0d);
+    acc.clear();
+    // after the invalidation accesses are buffered again
+    dut.target.tsck->invalidate_direct_mem_ptr(0, 0xfff);
+    run([]() {
+        uint32_t data = 0x0e0f1011;
+        access(tlm::TLM_WRITE_COMMAND, 0x848, data);
+    });
+    REQUIRE(acc.empty());
+    sc_start(150_ns);
+    REQUIRE(acc.size() == 1);
+    REQUIRE(acc[0].addr == 0x848);
+}
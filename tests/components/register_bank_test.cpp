@@ -0,0 +1,222 @@
+#include <array>
+#include <cstring>
+#include <factory.h>
+#include <scc/register.h>
+#include <scc/resetable.h>
+#include <scc/tlm_target.h>
+#include <scc/utilities.h>
+#include <systemc>
+#include <tlm/scc/initiator_mixin.h>
+#include <utility>
+#include <vector>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+struct register_bank_tb : public sc_module, public scc::resetable {
+    std::array<uint32_t, 8> regs{};
+    scc::sc_register_bank<uint32_t, 8> bank{"bank", regs, 0x0, *this};
+
+    register_bank_tb()
+    : register_bank_tb(sc_gen_unique_name("register_bank_tb", false)) {}
+
+    register_bank_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        bank.set_reset_value(1, 0xdeadbeef);
+        bank.set_masks(2, 0x0000ffff, 0x00ff00ff);
+    }
+    //! brings the bank into its reset state
+    void do_reset() {
+        reset_start();
+        reset_stop();
+    }
+};
+
+factory::add<register_bank_tb> tb;
+//! a register file with a bank of single registers at 0x0 and a bank accessed as a whole at 0x20
+struct register_target_tb : public sc_module, public scc::resetable, public scc::tlm_target<> {
+    tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>> isck{"isck"};
+    sc_time clk{10_ns};
+    std::array<uint32_t, 8> regs{};
+    std::array<uint32_t, 8> ctrl{};
+    scc::sc_register_bank<uint32_t, 8> regs_bank{"regs_bank", regs, 0x0, *this};
+    scc::sc_register_bank<uint32_t, 8> ctrl_bank{"ctrl_bank", ctrl, 0x0, *this};
+
+    register_target_tb()
+    : register_target_tb(sc_gen_unique_name("register_target_tb", false)) {}
+
+    register_target_tb(sc_module_name const& nm)
+    : sc_module(nm)
+    , scc::tlm_target<>(clk) {
+        isck(socket);
+        addResource(static_cast<scc::indexed_resource_access_if&>(regs_bank), 0x0);
+        addResource(static_cast<scc::resource_access_if&>(ctrl_bank), 0x20);
+        enable_dirty_tracking();
+    }
+};
+
+factory::add<register_target_tb> target_tb;
+
+tlm::tlm_response_status access(tlm::tlm_command cmd, uint64_t addr, uint8_t* data, unsigned len, uint8_t* be = nullptr) {
+    tlm::tlm_generic_payload gp;
+    gp.set_command(cmd);
+    gp.set_address(addr);
+    gp.set_data_ptr(data);
+    gp.set_data_length(len);
+    gp.set_streaming_width(len);
+    if(be) {
+        gp.set_byte_enable_ptr(be);
+        gp.set_byte_enable_length(len);
+    }
+    sc_time d;
+    factory::get<register_target_tb>().isck->b_transport(gp, d);
+    return gp.get_response_status();
+}
+//! collects the dirty ranges of the register file
+std::vector<std::pair<uint64_t, uint64_t>> dirty_ranges(bool clear = false) {
+    std::vector<std::pair<uint64_t, uint64_t>> res;
+    auto collect = [&res](uint64_t start, uint64_t len) { res.emplace_back(start, len); };
+    factory::get<register_target_tb>().get_dirty_map()->for_each_dirty(collect, clear);
+    return res;
+}
+//! runs the accesses in a thread of the simulation
+void run(std::function<void()> const& f) {
+    auto p = sc_spawn(f);
+    sc_start(1_ns);
+    REQUIRE(p.terminated());
+}
+} // namespace
+
+TEST_CASE("register_bank_reset_and_masks", "[register_bank][tlm-level]") {
+    auto& dut = factory::get<register_bank_tb>();
+    dut.regs.fill(0x55555555);
+    dut.do_reset();
+    REQUIRE(dut.regs[0] == 0);
+    REQUIRE(dut.regs[1] == 0xdeadbeef);
+    REQUIRE(dut.regs[7] == 0);
+    sc_time d;
+    // the write mask protects bits, the read mask hides them
+    uint32_t data = 0xffffffff;
+    REQUIRE(dut.bank[2].write(reinterpret_cast<uint8_t*>(&data), sizeof(data), 0, d));
+    REQUIRE(dut.regs[2] == 0x00ff00ff);
+    REQUIRE(dut.bank[2].read(reinterpret_cast<uint8_t*>(&data), sizeof(data), 0, d));
+    REQUIRE(data == 0x000000ff);
+    // a partial write keeps the other bytes
+    uint8_t byte = 0x12;
+    REQUIRE(dut.bank[0].write(&byte, 1, 2, d));
+    REQUIRE(dut.regs[0] == 0x00120000);
+}
+
+TEST_CASE("register_bank_split_access", "[register_bank][tlm-level]") {
+    auto& dut = factory::get<register_bank_tb>();
+    dut.do_reset();
+    sc_time d;
+    // an access spanning 3 registers at an unaligned offset
+    std::array<uint8_t, 8> wdata{{1, 2, 3, 4, 5, 6, 7, 8}};
+    REQUIRE(dut.bank.write(wdata.data(), wdata.size(), 6, d));
+    REQUIRE(dut.regs[1] == 0x0201beef);
+    REQUIRE(dut.regs[2] == 0x00050003);
+    REQUIRE(dut.regs[3] == 0x00000807);
+    std::array<uint8_t, 8> rdata{};
+    REQUIRE(dut.bank.read(rdata.data(), rdata.size(), 6, d));
+    REQUIRE(rdata == (std::array<uint8_t, 8>{{1, 2, 3, 0, 0, 0, 7, 8}}));
+    // accesses beyond the bank are rejected
+    REQUIRE_FALSE(dut.bank.write(wdata.data(), wdata.size(), 28, d));
+    REQUIRE_FALSE(dut.bank.read(rdata.data(), rdata.size(), 28, d));
+}
+
+TEST_CASE("register_bank_debug_view", "[register_bank][tlm-level]") {
+    auto& dut = factory::get<register_bank_tb>();
+    dut.do_reset();
+    sc_time d;
+    uint32_t data = 0x12345678;
+    REQUIRE(dut.bank[2].write(reinterpret_cast<uint8_t*>(&data), sizeof(data), 0, d));
+    // debug reads bypass the read mask
+    std::array<uint32_t, 3> dbg{};
+    REQUIRE(dut.bank.read_dbg(reinterpret_cast<uint8_t*>(dbg.data()), sizeof(dbg), 4));
+    REQUIRE(dbg[0] == 0xdeadbeef);
+    REQUIRE(dbg[1] == 0x00340078);
+    REQUIRE(dbg[2] == 0);
+    // debug writes bypass the write mask
+    data = 0xffffffff;
+    REQUIRE(dut.bank.write_dbg(reinterpret_cast<uint8_t*>(&data), sizeof(data), 8));
+    REQUIRE(dut.regs[2] == 0xffffffff);
+    REQUIRE(dut.bank[3].write_dbg(reinterpret_cast<uint8_t*>(&data), 2, 2));
+    REQUIRE(dut.regs[3] == 0xffff0000);
+    REQUIRE_FALSE(dut.bank.write_dbg(reinterpret_cast<uint8_t*>(&data), sizeof(data), 30));
+    REQUIRE_FALSE(dut.bank[3].read_dbg(reinterpret_cast<uint8_t*>(&data), sizeof(data), 1));
+}
+
+TEST_CASE("register_bank_write_callback", "[register_bank][tlm-level]") {
+    auto& dut = factory::get<register_bank_tb>();
+    dut.do_reset();
+    std::vector<size_t> cb_regs;
+    dut.bank.set_write_cb([&cb_regs](scc::sc_register_bank<uint32_t, 8>& bank, size_t idx, uint32_t const& v, sc_time&) -> bool {
+        cb_regs.push_back(idx);
+        if(idx == 6)
+            return false;
+        bank.value(idx) = v + 1;
+        return true;
+    });
+    // only registers 5 and 6 use the callback, the others take the fast path
+    for(size_t idx = 0; idx < 8; ++idx)
+        dut.bank.enable_write_cb(idx, idx == 5 || idx == 6);
+    sc_time d;
+    std::array<uint32_t, 3> data{{0x100, 0x200, 0x300}};
+    REQUIRE(dut.bank.write(reinterpret_cast<uint8_t*>(data.data()), 2 * sizeof(uint32_t), 16, d));
+    REQUIRE(cb_regs == std::vector<size_t>{5});
+    REQUIRE(dut.regs[4] == 0x100);
+    REQUIRE(dut.regs[5] == 0x201);
+    // a refusing callback fails the access and leaves the register untouched
+    REQUIRE_FALSE(dut.bank[6].write(reinterpret_cast<uint8_t*>(&data[2]), sizeof(uint32_t), 0, d));
+    REQUIRE(cb_regs == (std::vector<size_t>{5, 6}));
+    REQUIRE(dut.regs[6] == 0);
+    // partial writes to registers without callback honor the write mask
+    uint16_t half = 0xffff;
+    REQUIRE(dut.bank[2].write(reinterpret_cast<uint8_t*>(&half), sizeof(half), 2, d));
+    REQUIRE(dut.regs[2] == 0x00ff0000);
+    REQUIRE(cb_regs.size() == 2);
+    dut.bank.set_write_cb(nullptr);
+}
+
+TEST_CASE("register_bank_dirty_tracking", "[register_bank][tlm-level]") {
+    auto& dut = factory::get<register_target_tb>();
+    REQUIRE(dut.get_dirty_map() != nullptr);
+    REQUIRE(dirty_ranges().empty());
+    run([]() {
+        std::array<uint32_t, 2> data{{0x11111111, 0x22222222}};
+        REQUIRE(access(tlm::TLM_WRITE_COMMAND, 0x4, reinterpret_cast<uint8_t*>(&data[0]), 4) == tlm::TLM_OK_RESPONSE);
+        REQUIRE(access(tlm::TLM_WRITE_COMMAND, 0x8, reinterpret_cast<uint8_t*>(&data[1]), 4) == tlm::TLM_OK_RESPONSE);
+        // only the enabled bytes are marked
+        std::array<uint8_t, 4> be{{0, 0xff, 0xff, 0}};
+        REQUIRE(access(tlm::TLM_WRITE_COMMAND, 0x24, reinterpret_cast<uint8_t*>(&data[0]), 4, be.data()) == tlm::TLM_OK_RESPONSE);
+        // the last register of the address map is tracked
+        REQUIRE(access(tlm::TLM_WRITE_COMMAND, 0x3c, reinterpret_cast<uint8_t*>(&data[1]), 4) == tlm::TLM_OK_RESPONSE);
+        // reads and failing writes do not mark
+        REQUIRE(access(tlm::TLM_READ_COMMAND, 0x10, reinterpret_cast<uint8_t*>(&data[0]), 4) == tlm::TLM_OK_RESPONSE);
+        REQUIRE(access(tlm::TLM_WRITE_COMMAND, 0x38, reinterpret_cast<uint8_t*>(data.data()), 12) != tlm::TLM_OK_RESPONSE);
+    });
+    REQUIRE(dut.regs[1] == 0x11111111);
+    REQUIRE(dut.ctrl[1] == 0x00111100);
+    using ranges = std::vector<std::pair<uint64_t, uint64_t>>;
+    auto const expected = ranges{{0x4, 8}, {0x25, 2}, {0x3c, 4}};
+    REQUIRE(dirty_ranges() == expected);
+    // collecting with clear reports the ranges a last time
+    REQUIRE(dirty_ranges(true) == expected);
+    REQUIRE(dirty_ranges().empty());
+    // debug writes are marked as well
+    uint32_t data = 0x33333333;
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_address(0x1c);
+    gp.set_data_ptr(reinterpret_cast<uint8_t*>(&data));
+    gp.set_data_length(sizeof(data));
+    gp.set_streaming_width(sizeof(data));
+    REQUIRE(dut.isck->transport_dbg(gp) == sizeof(data));
+    REQUIRE(dut.regs[7] == 0x33333333);
+    REQUIRE(dirty_ranges() == ranges{{0x1c, 4}});
+    dut.get_dirty_map()->clear();
+    REQUIRE(dirty_ranges().empty());
+}
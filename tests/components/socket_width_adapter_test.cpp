@@ -0,0 +1,265 @@
+#include <factory.h>
+#include <limits>
+#include <numeric>
+#include <scc/socket_width_adapter.h>
+#include <scc/utilities.h>
+#include <systemc>
+#include <tlm/scc/initiator_mixin.h>
+#include <tlm/scc/target_mixin.h>
+#include <vector>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+//! a target recording the accesses it receives
+template <unsigned BUSWIDTH> struct recording_target : public sc_module {
+    struct access {
+        tlm::tlm_command cmd;
+        uint64_t addr;
+        std::vector<uint8_t> data, be;
+        bool dbg;
+        sc_time time;
+    };
+    tlm::scc::target_mixin<tlm::tlm_target_socket<BUSWIDTH>> tsck{"tsck"};
+    std::vector<access> accesses;
+    uint64_t error_addr{std::numeric_limits<uint64_t>::max()};
+
+    recording_target(sc_module_name const& nm)
+    : sc_module(nm) {
+        tsck.register_b_transport([this](tlm::tlm_generic_payload& gp, sc_time& d) {
+            record(gp, false);
+            gp.set_dmi_allowed(gp.get_address() != 0);
+            gp.set_response_status(gp.get_address() == error_addr ? tlm::TLM_ADDRESS_ERROR_RESPONSE : tlm::TLM_OK_RESPONSE);
+        });
+        tsck.register_transport_dbg([this](tlm::tlm_generic_payload& gp) -> unsigned {
+            record(gp, true);
+            return gp.get_data_length();
+        });
+        tsck.register_get_direct_mem_ptr([](tlm::tlm_generic_payload&, tlm::tlm_dmi&) -> bool { return false; });
+    }
+
+    void record(tlm::tlm_generic_payload const& gp, bool dbg) {
+        access a{gp.get_command(), gp.get_address(), {gp.get_data_ptr(), gp.get_data_ptr() + gp.get_data_length()}, {}, dbg,
+                 sc_time_stamp()};
+        if(gp.get_byte_enable_ptr())
+            a.be.assign(gp.get_byte_enable_ptr(), gp.get_byte_enable_ptr() + gp.get_byte_enable_length());
+        accesses.push_back(a);
+    }
+};
+
+struct width_adapter_tb : public sc_module {
+    // wide to narrow, splitting at 16 byte boundaries
+    tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<64>> split_isck{"split_isck"};
+    scc::socket_width_adapter<64, 32> splitter{"splitter"};
+    recording_target<32> split_tgt{"split_tgt"};
+    // narrow to wide, merging up to 32 bytes within 100ns
+    tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<32>> merge_isck{"merge_isck"};
+    scc::socket_width_adapter<32, 64> merger{"merger"};
+    recording_target<64> merge_tgt{"merge_tgt"};
+
+    width_adapter_tb()
+    : width_adapter_tb(sc_gen_unique_name("width_adapter_tb", false)) {}
+
+    width_adapter_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        split_isck(splitter.tsck);
+        splitter.isck(split_tgt.tsck);
+        splitter.max_burst_len.set_value(4);
+        merge_isck(merger.tsck);
+        merger.isck(merge_tgt.tsck);
+        merger.max_burst_len.set_value(4);
+        merger.write_merge_window.set_value(100_ns);
+    }
+};
+
+factory::add<width_adapter_tb> tb;
+
+using write_list = std::vector<std::pair<uint64_t, std::vector<uint8_t>>>;
+//! issues the writes one after the other from a dedicated thread
+template <typename SOCKET> sc_process_handle write(SOCKET& sckt, write_list writes) {
+    return sc_spawn([&sckt, writes]() mutable {
+        for(auto& w : writes) {
+            tlm::tlm_generic_payload gp;
+            gp.set_command(tlm::TLM_WRITE_COMMAND);
+            gp.set_address(w.first);
+            gp.set_data_ptr(w.second.data());
+            gp.set_data_length(w.second.size());
+            gp.set_streaming_width(w.second.size());
+            sc_time d;
+            sckt->b_transport(gp, d);
+        }
+    });
+}
+} // namespace
+
+TEST_CASE("socket_width_adapter_split", "[socket_width_adapter][tlm-level]") {
+    auto& dut = factory::get<width_adapter_tb>();
+    std::vector<uint8_t> data(40), be(40, 0xff);
+    std::iota(data.begin(), data.end(), 0);
+    for(auto i = 0U; i < be.size(); i += 3)
+        be[i] = 0;
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_address(0x108);
+    gp.set_data_ptr(data.data());
+    gp.set_data_length(data.size());
+    gp.set_streaming_width(data.size());
+    gp.set_byte_enable_ptr(be.data());
+    gp.set_byte_enable_length(be.size());
+    sc_time d;
+    dut.split_isck->b_transport(gp, d);
+    REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+    // the bursts end at 16 byte boundaries and carry their slice of data and byte enables
+    auto& acc = dut.split_tgt.accesses;
+    REQUIRE(acc.size() == 3);
+    std::vector<std::pair<uint64_t, unsigned>> const bursts{{0x108, 8}, {0x110, 16}, {0x120, 16}};
+    for(auto i = 0U, offs = 0U; i < bursts.size(); offs += bursts[i].second, ++i) {
+        REQUIRE(acc[i].addr == bursts[i].first);
+        REQUIRE(acc[i].data == std::vector<uint8_t>(data.begin() + offs, data.begin() + offs + bursts[i].second));
+        REQUIRE(acc[i].be == std::vector<uint8_t>(be.begin() + offs, be.begin() + offs + bursts[i].second));
+    }
+    // the attributes of the original transaction are restored
+    REQUIRE(gp.get_address() == 0x108);
+    REQUIRE(gp.get_data_ptr() == data.data());
+    REQUIRE(gp.get_data_length() == data.size());
+    REQUIRE(gp.get_streaming_width() == data.size());
+    REQUIRE(gp.get_byte_enable_ptr() == be.data());
+    REQUIRE(gp.get_byte_enable_length() == be.size());
+    REQUIRE(gp.is_dmi_allowed());
+    // an error stops the sequence and is returned, DMI is only allowed if all bursts allowed it
+    acc.clear();
+    dut.split_tgt.error_addr = 0x10;
+    gp.set_address(0);
+    gp.set_byte_enable_ptr(nullptr);
+    gp.set_byte_enable_length(0);
+    gp.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    dut.split_isck->b_transport(gp, d);
+    REQUIRE(gp.get_response_status() == tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    REQUIRE(acc.size() == 2);
+    REQUIRE(acc[1].addr == 0x10);
+    REQUIRE(gp.get_address() == 0);
+    REQUIRE(gp.get_data_length() == data.size());
+    REQUIRE_FALSE(gp.is_dmi_allowed());
+    dut.split_tgt.error_addr = std::numeric_limits<uint64_t>::max();
+    // a streaming width beyond the data length is kept
+    acc.clear();
+    gp.set_streaming_width(0x100);
+    dut.split_isck->b_transport(gp, d);
+    REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+    REQUIRE(acc.size() == 3);
+    REQUIRE(gp.get_streaming_width() == 0x100);
+}
+
+TEST_CASE("socket_width_adapter_merge", "[socket_width_adapter][tlm-level]") {
+    auto& dut = factory::get<width_adapter_tb>();
+    auto& acc = dut.merge_tgt.accesses;
+    // sequential writes are posted and flushed by a read
+    write(dut.merge_isck, {{0x0, {0, 1, 2, 3}}, {0x4, {4, 5, 6, 7}}, {0x8, {8, 9, 10, 11}}});
+    sc_start(10_ns);
+    REQUIRE(acc.empty());
+    auto rd = sc_spawn([&dut]() {
+        std::vector<uint8_t> data(4);
+        tlm::tlm_generic_payload gp;
+        gp.set_command(tlm::TLM_READ_COMMAND);
+        gp.set_address(0x0);
+        gp.set_data_ptr(data.data());
+        gp.set_data_length(data.size());
+        gp.set_streaming_width(data.size());
+        sc_time d;
+        dut.merge_isck->b_transport(gp, d);
+    });
+    sc_start(10_ns);
+    REQUIRE(rd.terminated());
+    REQUIRE(acc.size() == 2);
+    REQUIRE(acc[0].cmd == tlm::TLM_WRITE_COMMAND);
+    REQUIRE(acc[0].addr == 0x0);
+    REQUIRE(acc[0].data == std::vector<uint8_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    REQUIRE(acc[0].be.empty());
+    REQUIRE(acc[1].cmd == tlm::TLM_READ_COMMAND);
+    acc.clear();
+    // a pending write is flushed when the merge window expires
+    auto const start = sc_time_stamp();
+    write(dut.merge_isck, {{0x100, {1, 2, 3, 4}}});
+    sc_start(50_ns);
+    REQUIRE(acc.empty());
+    sc_start(100_ns);
+    REQUIRE(acc.size() == 1);
+    REQUIRE(acc[0].addr == 0x100);
+    REQUIRE(acc[0].time == start + 100_ns);
+    acc.clear();
+    // a non-sequential write flushes the pending one
+    write(dut.merge_isck, {{0x200, {1, 2, 3, 4}}, {0x300, {5, 6, 7, 8}}});
+    sc_start(10_ns);
+    REQUIRE(acc.size() == 1);
+    REQUIRE(acc[0].addr == 0x200);
+    acc.clear();
+    // debug reads see the pending write, debug writes update it
+    std::vector<uint8_t> data(4);
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_READ_COMMAND);
+    gp.set_address(0x300);
+    gp.set_data_ptr(data.data());
+    gp.set_data_length(data.size());
+    gp.set_streaming_width(data.size());
+    REQUIRE(dut.merge_isck->transport_dbg(gp) == data.size());
+    REQUIRE(data == std::vector<uint8_t>{5, 6, 7, 8});
+    REQUIRE(acc.size() == 1);
+    REQUIRE(acc[0].dbg);
+    REQUIRE(acc[0].cmd == tlm::TLM_READ_COMMAND);
+    data = {0xaa, 0xbb};
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_address(0x302);
+    gp.set_data_ptr(data.data());
+    gp.set_data_length(2);
+    gp.set_streaming_width(2);
+    REQUIRE(dut.merge_isck->transport_dbg(gp) == 2);
+    REQUIRE(acc.size() == 2);
+    REQUIRE(acc[1].dbg);
+    // the pending write is still flushed using a regular transaction
+    sc_start(100_ns);
+    REQUIRE(acc.size() == 3);
+    REQUIRE_FALSE(acc[2].dbg);
+    REQUIRE(acc[2].addr == 0x300);
+    REQUIRE(acc[2].data == std::vector<uint8_t>{5, 6, 0xaa, 0xbb});
+    acc.clear();
+    // DMI requests are denied while a write is pending and trigger its flush
+    write(dut.merge_isck, {{0x400, {1, 2, 3, 4}}});
+    sc_start(10_ns);
+    tlm::tlm_dmi dmi;
+    REQUIRE_FALSE(dut.merge_isck->get_direct_mem_ptr(gp, dmi));
+    REQUIRE(acc.empty());
+    sc_start(1_ns);
+    REQUIRE(acc.size() == 1);
+    REQUIRE_FALSE(acc[0].dbg);
+    REQUIRE(acc[0].addr == 0x400);
+    // nothing is left to be flushed
+    sc_start(200_ns);
+    REQUIRE(acc.size() == 1);
+    acc.clear();
+    // the error of a merged write is returned by the next transaction
+    dut.merge_tgt.error_addr = 0x500;
+    write(dut.merge_isck, {{0x500, {1, 2, 3, 4}}});
+    sc_start(200_ns);
+    REQUIRE(acc.size() == 1);
+    std::vector<tlm::tlm_response_status> status;
+    auto err_rd = sc_spawn([&dut, &status]() {
+        for(auto i = 0; i < 2; ++i) {
+            std::vector<uint8_t> rdata(4);
+            tlm::tlm_generic_payload gp;
+            gp.set_command(tlm::TLM_READ_COMMAND);
+            gp.set_address(0x0);
+            gp.set_data_ptr(rdata.data());
+            gp.set_data_length(rdata.size());
+            gp.set_streaming_width(rdata.size());
+            sc_time d;
+            dut.merge_isck->b_transport(gp, d);
+            status.push_back(gp.get_response_status());
+        }
+    });
+    sc_start(10_ns);
+    REQUIRE(err_rd.terminated());
+    REQUIRE(status == std::vector<tlm::tlm_response_status>{tlm::TLM_ADDRESS_ERROR_RESPONSE, tlm::TLM_OK_RESPONSE});
+    dut.merge_tgt.error_addr = std::numeric_limits<uint64_t>::max();
+}
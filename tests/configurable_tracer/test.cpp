@@ -0,0 +1,73 @@
+#include <cci_configuration>
+#include <factory.h>
+#include <scc/configurable_tracer.h>
+#include <string>
+#include <systemc>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+struct leaf : public sc_module {
+    sc_signal<bool> sig{"sig"};
+    leaf(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+
+struct node : public sc_module {
+    leaf sub{"sub"};
+    node(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+//! a design where only mod2 has a preset value for its trace enable param, attr_mod is controlled by an sc_attribute
+struct tracer_tb : public sc_module {
+    node mod0{"mod0"}, mod1{"mod1"}, mod2{"mod2"}, attr_mod{"attr_mod"};
+    sc_attribute<bool> attr{"enableTracing", false};
+    scc::configurable_tracer tracer{"configurable_tracer", scc::tracer::NONE, scc::tracer::ENABLE};
+
+    tracer_tb()
+    : tracer_tb(sc_gen_unique_name("tracer_tb", false)) {}
+
+    tracer_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        attr_mod.add_attribute(attr);
+        cci::cci_get_broker().set_preset_cci_value(param_name(mod2), cci::cci_value(true));
+    }
+
+    static std::string param_name(sc_object const& obj) { return std::string(obj.name()) + ".enableTracing"; }
+};
+
+factory::add<tracer_tb> tb;
+} // namespace
+
+TEST_CASE("configurable_tracer_lazy_params", "[configurable_tracer]") {
+    auto& dut = factory::get<tracer_tb>();
+    auto broker = cci::cci_get_broker();
+    // the params do not exist before being looked up
+    for(auto& h : broker.get_param_handles())
+        REQUIRE(h.name() != tracer_tb::param_name(dut.mod0));
+    // looking up a param by name creates it
+    auto h0 = broker.get_param_handle(tracer_tb::param_name(dut.mod0));
+    REQUIRE(h0.is_valid());
+    REQUIRE(h0.get_cci_value().get_bool() == false);
+    REQUIRE(h0.name() == tracer_tb::param_name(dut.mod0));
+    auto h2 = broker.get_param_handle(tracer_tb::param_name(dut.mod2));
+    REQUIRE(h2.is_valid());
+    REQUIRE(h2.get_cci_value().get_bool() == true);
+    // a repeated lookup and the explicit request return the same param
+    REQUIRE(broker.get_param_handle(tracer_tb::param_name(dut.mod0)).is_valid());
+    REQUIRE(dut.tracer.get_trace_enable_handle(&dut.mod0).get_cci_value().get_bool() == false);
+    h0.set_cci_value(cci::cci_value(true));
+    REQUIRE(broker.get_param_handle(tracer_tb::param_name(dut.mod0)).get_cci_value().get_bool() == true);
+    // objects not being a module and objects controlled by an attribute do not get a param
+    REQUIRE_FALSE(broker.get_param_handle(tracer_tb::param_name(dut.mod1.sub.sig)).is_valid());
+    REQUIRE_FALSE(broker.get_param_handle(tracer_tb::param_name(dut.attr_mod)).is_valid());
+    REQUIRE_FALSE(broker.get_param_handle(std::string(dut.name()) + ".no_module.enableTracing").is_valid());
+    REQUIRE_FALSE(broker.get_param_handle(std::string(dut.mod1.name()) + ".enableTrace").is_valid());
+    // after elaboration the params of the modules are still created on lookup
+    sc_start(SC_ZERO_TIME);
+    auto h1 = broker.get_param_handle(tracer_tb::param_name(dut.mod1.sub));
+    REQUIRE(h1.is_valid());
+    REQUIRE(h1.get_cci_value().get_bool() == false);
+}
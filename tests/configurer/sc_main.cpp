@@ -38,6 +38,13 @@
 DEFINE_ENUM4CCI(trace_lvl, (NONE)(LOW)(MEDIUM)(HIGH)(FULL))
 DEFINE_NS_ENUM4CCI(test, log_lvl, (NONE)(LOW)(MEDIUM)(HIGH)(FULL))
 
+//! reports an error if a parameter does not hold the value of the configuration file
+template <typename T> void check(cci::cci_param<T> const& param, T const& expected) {
+    if(!(param.get_value() == expected))
+        SCCERR("sc_main") << "parameter " << param.name() << " has value " << param.get_cci_value().to_json() << " instead of "
+                          << cci::cci_value(expected).to_json();
+}
+
 /**
  *  @fn     int sc_main(int argc, char* argv[])
  *  @brief  The testbench for the hierarchical override of parameter values example
@@ -69,6 +76,18 @@ int sc_main(int sc_argc, char* sc_argv[]) {
     SCCINFO("sc_main") << "Begin Simulation.";
     sc_core::sc_start(sc_core::SC_ZERO_TIME);
     SCCINFO("sc_main") << "End Simulation.";
+    // the values of the main file, the included file and the phase specific section need to be applied
+    check(int_param0, 1);
+    check(int_param1, -1);
+    check(int64_param0, int64_t(2));
+    check(int64_param1, int64_t(-2));
+    check(unsigned_param, 3U);
+    check(uint64_param, uint64_t(4));
+    check(float_param, 5.0f);
+    check(double_param, 6.0);
+    check(string_param, std::string("test entry"));
+    check(sc_time_param, sc_core::sc_time(10, sc_core::SC_NS));
+    check(trace_lvl_param, trace_lvl::MEDIUM);
 
     return sc_core::sc_report_handler::get_count(sc_core::SC_ERROR) + sc_core::sc_report_handler::get_count(sc_core::SC_WARNING);
 } // End of 'sc_main'
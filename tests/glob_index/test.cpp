@@ -0,0 +1,102 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch_all.hpp>
+
+#include <regex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <util/glob_index.h>
+#include <util/ities.h>
+
+namespace {
+std::vector<std::string> const patterns{
+    "top.cpu.pc",  "top.*.pc",     "top.c?u.*",   "top.**",      "**.pc",        "top.**.irq", "**",          "*",
+    "top.cpu*",    "*.*.*",        "top.[ab]*",   "top.[a-c]pu", "top.[!a]pu.*", "[]a]",       "[]a].x",      "top.[]",
+    "top.[a",      "top.c\\.u",    "top.\\*",     " top.cpu ",   "top.a**b",     "top.*[.]*",  "top.[z-a]",   "top.[a-]",
+    "top.cp+",     "top.(cpu)",    "top.cpu$",    "top.c|d",     "top.[(]x",     "top..pc",    "^top\\..*pc", "top.[^a]pu.*",
+    "top.[-a]pu",  "top.[+-/]pu",  "top.**.",     ".top"};
+
+std::vector<std::string> const names{
+    "top",        "top.cpu",     "top.cpu.pc", "top.cpu.irq",   "top.bus.cpu.irq", "top.apu",   "top.bpu.x",  "top.dpu.pc",
+    "a",          "]",           "a]",         "]a]",           "]a].x",           "top.c.u",   "top.c\\.u",  "top.*",
+    "top.x",      "top.cpux",    "top.cp+",    "top.cpp",       "top.(cpu)",       "top.cpu$",  "top.c|d",    "top.(x",
+    "top..pc",    "top.pc",      "pc",         "top.a.b",       "top.ab",          "top.-pu",   "top./pu",    "top.,pu",
+    "top.bus.",   ".top",        "",           "top.cpu.pc.x"};
+//! the reference semantics: the regular expression created by glob_to_regex()
+bool regex_matches(std::string const& pattern, std::string const& name) {
+    return std::regex_match(name, std::regex(pattern[0] == '^' ? pattern : util::glob_to_regex(pattern)));
+}
+
+bool is_valid(std::string const& pattern) {
+    try {
+        std::regex(pattern[0] == '^' ? pattern : util::glob_to_regex(pattern));
+        return true;
+    } catch(std::regex_error&) {
+        return false;
+    }
+}
+} // namespace
+
+TEST_CASE("glob_index_matches_glob_to_regex", "[glob_index]") {
+    for(auto const& pattern : patterns) {
+        util::glob_index<bool> index;
+        if(!is_valid(pattern)) {
+            CHECK_THROWS_AS(index.insert(pattern, true), std::regex_error);
+            continue;
+        }
+        REQUIRE(index.insert(pattern, true));
+        for(auto const& name : names) {
+            INFO("pattern '" << pattern << "', name '" << name << "'");
+            CHECK(index.matches(name) == regex_matches(pattern, name));
+        }
+    }
+}
+
+TEST_CASE("glob_index_first_inserted_wins", "[glob_index]") {
+    util::glob_index<int> index;
+    REQUIRE(index.insert("top.**", 1));
+    REQUIRE(index.insert("^top\\.cpu.*", 2));
+    REQUIRE(index.insert("top.cpu.pc", 3));
+    REQUIRE_FALSE(index.insert("top.**", 4));
+    REQUIRE(index.size() == 3);
+    REQUIRE(*index.get("top.**") == 1);
+    REQUIRE(index.get("top.*") == nullptr);
+    REQUIRE(*index.find("top.cpu.pc") == 1);
+    REQUIRE(index.find("cpu.pc") == nullptr);
+    util::glob_index<bool> flags;
+    REQUIRE(flags.insert("top.*", false));
+    REQUIRE(flags.find("top.cpu") != nullptr);
+    REQUIRE_FALSE(*flags.find("top.cpu"));
+}
+
+TEST_CASE("name_index_matches_glob_to_regex", "[glob_index]") {
+    util::name_index<int> index;
+    for(size_t i = 0; i < names.size(); ++i)
+        index.insert(names[i], static_cast<int>(i));
+    REQUIRE(index.size() == names.size());
+    for(auto const& pattern : patterns) {
+        if(!is_valid(pattern)) {
+            CHECK_THROWS_AS(index.for_each_match(pattern, [](std::string const&, int) {}), std::regex_error);
+            continue;
+        }
+        std::multiset<std::string> found, expected;
+        index.for_each_match(pattern, [&found](std::string const& name, int id) {
+            CHECK(names[id] == name);
+            found.insert(name);
+        });
+        for(auto const& name : names)
+            if(regex_matches(pattern, name))
+                expected.insert(name);
+        INFO("pattern '" << pattern << "'");
+        CHECK(found == expected);
+    }
+    REQUIRE(index.erase("top.cpu"));
+    REQUIRE_FALSE(index.erase("top.cpu"));
+    REQUIRE_FALSE(index.erase("top.gpu"));
+    REQUIRE(index.size() == names.size() - 1);
+    std::set<std::string> found;
+    index.for_each_match("top.*", [&found](std::string const& name, int) { found.insert(name); });
+    REQUIRE(found.count("top.cpu") == 0);
+    REQUIRE(found.count("top.apu") == 1);
+}
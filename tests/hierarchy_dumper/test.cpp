@@ -0,0 +1,106 @@
+#include <factory.h>
+#include <fstream>
+#include <memory>
+#include <scc/hierarchy_dumper.h>
+#include <sstream>
+#include <string>
+#include <systemc>
+#include <vector>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+struct driver : public sc_module {
+    sc_out<bool> o{"o"};
+    driver(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+
+struct sink : public sc_module {
+    sc_in<bool> i{"i"};
+    sink(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+
+struct producer : public sc_module {
+    driver drv{"drv"};
+    producer(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+
+struct consumer : public sc_module {
+    sink snk0{"snk0"};
+    sink snk1{"snk1"};
+    struct nested : public sc_module {
+        sink snk{"snk"};
+        nested(sc_module_name const& nm)
+        : sc_module(nm) {}
+    } inner{"inner"};
+    consumer(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+//! holds a dumper, the name prefix hides it from the dump
+struct dump : public sc_module {
+    scc::hierarchy_dumper dumper;
+    dump(sc_module_name const& nm, std::string const& file_name, scc::hierarchy_dumper::file_type format, bool streaming, bool parallel)
+    : sc_module(nm)
+    , dumper(file_name, format, streaming, parallel) {}
+};
+//! the signals connect ports several levels apart so that implicit ports need to be inferred
+struct hierarchy_tb : public sc_module {
+    sc_signal<bool> sig0{"sig0"}, sig1{"sig1"};
+    producer prod0{"prod0"}, prod1{"prod1"};
+    consumer cons{"cons"};
+    std::vector<std::unique_ptr<dump>> dumps;
+
+    hierarchy_tb()
+    : hierarchy_tb(sc_gen_unique_name("hierarchy_tb", false)) {}
+
+    hierarchy_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        prod0.drv.o(sig0);
+        cons.snk0.i(sig0);
+        cons.inner.snk.i(sig0);
+        prod1.drv.o(sig1);
+        cons.snk1.i(sig1);
+        for(auto format : {scc::hierarchy_dumper::ELKT, scc::hierarchy_dumper::DBGJSON})
+            for(auto mode : {"full", "streaming", "parallel"}) {
+                auto const name = std::string("$$$dump_") + mode + std::to_string(format);
+                dumps.emplace_back(new dump(name.c_str(), file_name(format, mode), format, mode[0] == 's', mode[0] == 'p'));
+            }
+    }
+
+    static std::string file_name(scc::hierarchy_dumper::file_type format, std::string const& mode) {
+        return "hierarchy_" + mode + (format == scc::hierarchy_dumper::ELKT ? ".elkt" : ".json");
+    }
+};
+
+factory::add<hierarchy_tb> tb;
+
+std::string read_file(std::string const& name) {
+    std::ifstream is(name);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+} // namespace
+
+TEST_CASE("hierarchy_dumper_modes", "[hierarchy_dumper]") {
+    sc_start(SC_ZERO_TIME);
+    for(auto format : {scc::hierarchy_dumper::ELKT, scc::hierarchy_dumper::DBGJSON}) {
+        auto const full = read_file(hierarchy_tb::file_name(format, "full"));
+        REQUIRE(full.size());
+        // streaming and parallel inference yield the same output
+        REQUIRE(read_file(hierarchy_tb::file_name(format, "streaming")) == full);
+        REQUIRE(read_file(hierarchy_tb::file_name(format, "parallel")) == full);
+    }
+    // the ports crossing the module boundaries are inferred
+    auto const elk = read_file(hierarchy_tb::file_name(scc::hierarchy_dumper::ELKT, "full"));
+    REQUIRE(elk.find("edge hierarchy_tb.prod0.o -> hierarchy_tb.prod0.drv.o") != std::string::npos);
+    REQUIRE(elk.find("edge hierarchy_tb.cons.i -> hierarchy_tb.cons.snk0.i") != std::string::npos);
+    REQUIRE(elk.find("edge hierarchy_tb.cons.inner.i -> hierarchy_tb.cons.inner.snk.i") != std::string::npos);
+    REQUIRE(elk.find("edge hierarchy_tb.prod0.o -> hierarchy_tb.cons.i") != std::string::npos);
+    REQUIRE(elk.find("edge hierarchy_tb.prod1.o -> hierarchy_tb.cons.i") != std::string::npos);
+}
@@ -1,11 +1,16 @@
 
 #include "testbench.h"
 #include <factory.h>
+#include <tlm/scc/atomic_extension.h>
+#include <tlm/scc/bulk_loader.h>
 #include <tlm/scc/tlm_gp_shared.h>
 #undef CHECK
 #include <array>
 #include <catch2/catch_all.hpp>
 #include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <vector>
 
 using namespace sc_core;
 namespace scc {
@@ -67,6 +72,267 @@ TEST_CASE("dmi_access", "[memory][tlm-level]") {
     sc_start(dut.clk.read());
 }
 
+TEST_CASE("dmi_access_host_mapped", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    do_dmi_access(dut.isck0, 256_MB, 64_MB);
+    tlm::tlm_generic_payload gp;
+    sc_core::sc_time t;
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 256_MB + 40_MB, 0x1234567890abcdefULL);
+    dut.isck0->b_transport(gp, t);
+    REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+    delete[] gp.get_data_ptr();
+    tlm::tlm_dmi dmi;
+    gp.set_address(256_MB);
+    REQUIRE(dut.isck0->get_direct_mem_ptr(gp, dmi));
+    uint64_t res;
+    memcpy(&res, dmi.get_dmi_ptr() + 40_MB, sizeof(res));
+    REQUIRE(res == 0x1234567890abcdefULL);
+    sc_start(dut.clk.read());
+}
+
+TEST_CASE("bulk_load", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    tlm::scc::bulk_loader loader(dut.isck0, 4);
+    std::vector<uint8_t> image(4_kB);
+    for(size_t i = 0; i < image.size(); ++i)
+        image[i] = static_cast<uint8_t>(i * 13 + 1);
+    // the ranges cover a remapped memory, the default target and a not remapped memory
+    for(uint64_t addr : {uint64_t(52_MB - 1_kB), uint64_t(64_MB + 16)}) {
+        REQUIRE(loader.write(addr, image.size(), image.data()));
+        std::vector<uint8_t> read_back(image.size());
+        // debug transactions are not split by the router so read back in pieces not crossing a target boundary
+        for(size_t offs = 0; offs < read_back.size(); offs += 1_kB) {
+            tlm::tlm_generic_payload gp;
+            gp.set_command(tlm::TLM_READ_COMMAND);
+            gp.set_address(addr + offs);
+            gp.set_data_ptr(read_back.data() + offs);
+            gp.set_data_length(1_kB);
+            gp.set_streaming_width(1_kB);
+            REQUIRE(dut.isck0->transport_dbg(gp) == 1_kB);
+        }
+        REQUIRE(read_back == image);
+    }
+}
+
+TEST_CASE("flattened_fabric", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    tlm::tlm_generic_payload gp;
+    sc_core::sc_time t;
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 512_MB + 32_kB + 0x10, 0x0123456789abcdefULL);
+    dut.isck2->b_transport(gp, t);
+    REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+    delete[] gp.get_data_ptr();
+    // the address at the memory is the composition of both remappings
+    prepare_trans(gp, tlm::TLM_READ_COMMAND, 0x10, 0ULL);
+    dut.mem7.handle_operation(gp, t);
+    uint64_t res;
+    memcpy(&res, gp.get_data_ptr(), sizeof(res));
+    REQUIRE(res == 0x0123456789abcdefULL);
+    delete[] gp.get_data_ptr();
+    prepare_trans(gp, tlm::TLM_READ_COMMAND, 512_MB + 32_kB + 0x10, 0ULL);
+    REQUIRE(dut.isck2->transport_dbg(gp) == sizeof(uint64_t));
+    memcpy(&res, gp.get_data_ptr(), sizeof(res));
+    REQUIRE(res == 0x0123456789abcdefULL);
+    delete[] gp.get_data_ptr();
+    // addresses unmapped in the nested router result in an address error
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 512_MB + 0x10, 0ULL);
+    dut.isck2->b_transport(gp, t);
+    REQUIRE(gp.get_response_status() == tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    delete[] gp.get_data_ptr();
+}
+
+TEST_CASE("atomic_access", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    sc_core::sc_time t;
+    auto access = [&dut, &t](tlm::tlm_command cmd, util::amo_e op, uint32_t val, unsigned id = 0) -> std::pair<uint32_t, bool> {
+        tlm::tlm_generic_payload gp;
+        tlm::scc::atomic_extension ext(op, id);
+        prepare_trans(gp, cmd, 0x100, val);
+        gp.set_extension(&ext);
+        dut.isck0->b_transport(gp, t);
+        gp.clear_extension(&ext);
+        REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+        uint32_t res;
+        memcpy(&res, gp.get_data_ptr(), sizeof(res));
+        delete[] gp.get_data_ptr();
+        return {res, ext.success};
+    };
+    tlm::tlm_generic_payload gp;
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 0x100, 5U);
+    dut.isck0->b_transport(gp, t);
+    delete[] gp.get_data_ptr();
+    REQUIRE(access(tlm::TLM_WRITE_COMMAND, util::amo_e::ADD, 3).first == 5);
+    REQUIRE(access(tlm::TLM_WRITE_COMMAND, util::amo_e::MAXU, 2).first == 8);
+    // LR/SC succeeds without intermediate write
+    REQUIRE(access(tlm::TLM_READ_COMMAND, util::amo_e::LOAD_RESERVED, 0, 1).first == 8);
+    REQUIRE(access(tlm::TLM_WRITE_COMMAND, util::amo_e::STORE_CONDITIONAL, 9, 1).second);
+    // a write of another initiator breaks the reservation
+    access(tlm::TLM_READ_COMMAND, util::amo_e::LOAD_RESERVED, 0, 1);
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 0x104, 0U);
+    dut.isck0->b_transport(gp, t);
+    delete[] gp.get_data_ptr();
+    REQUIRE_FALSE(access(tlm::TLM_WRITE_COMMAND, util::amo_e::STORE_CONDITIONAL, 10, 1).second);
+    // a DMI write changing the value makes the store conditional fail as well
+    access(tlm::TLM_READ_COMMAND, util::amo_e::LOAD_RESERVED, 0, 2);
+    tlm::tlm_dmi dmi;
+    gp.set_address(0x100);
+    REQUIRE(dut.isck0->get_direct_mem_ptr(gp, dmi));
+    uint32_t dmi_val = 11;
+    memcpy(dmi.get_dmi_ptr() + 0x100 - dmi.get_start_address(), &dmi_val, sizeof(dmi_val));
+    REQUIRE_FALSE(access(tlm::TLM_WRITE_COMMAND, util::amo_e::STORE_CONDITIONAL, 12, 2).second);
+    REQUIRE(access(tlm::TLM_WRITE_COMMAND, util::amo_e::SWAP, 0).first == 11);
+}
+
+TEST_CASE("dirty_tracking", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    sc_core::sc_time t;
+    dut.mem1.enable_dirty_tracking(6);
+    REQUIRE_FALSE(dut.mem1.is_dirty(0, 1_kB));
+    tlm::tlm_generic_payload gp;
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 1_kB + 0x7e, 0x12345678U);
+    dut.isck0->b_transport(gp, t);
+    delete[] gp.get_data_ptr();
+    std::vector<std::pair<uint64_t, uint64_t>> regions;
+    dut.mem1.for_each_dirty([&regions](uint64_t addr, uint64_t len) { regions.emplace_back(addr, len); }, true);
+    REQUIRE(regions.size() == 1);
+    CHECK(regions[0].first == 0x40);
+    CHECK(regions[0].second == 0x80);
+    REQUIRE_FALSE(dut.mem1.is_dirty(0, 1_kB));
+    // a DMI read request is granted read-only access and leaves the memory clean
+    tlm::tlm_dmi dmi;
+    gp.set_address(1_kB);
+    gp.set_command(tlm::TLM_READ_COMMAND);
+    REQUIRE(dut.isck0->get_direct_mem_ptr(gp, dmi));
+    CHECK(dmi.is_read_allowed());
+    CHECK_FALSE(dmi.is_write_allowed());
+    REQUIRE_FALSE(dut.mem1.is_dirty(0, 1_kB));
+    // a DMI write grant marks the whole granted region
+    dmi.init();
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    REQUIRE(dut.isck0->get_direct_mem_ptr(gp, dmi));
+    CHECK(dmi.is_read_write_allowed());
+    CHECK(dut.mem1.is_dirty(0));
+    CHECK(dut.mem1.is_dirty(1_kB - 1));
+    dut.mem1.clear_dirty();
+    REQUIRE_FALSE(dut.mem1.is_dirty(0, 1_kB));
+}
+
+TEST_CASE("checkpoint_restore", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    sc_core::sc_time t;
+    tlm::tlm_generic_payload gp;
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 0x10, 0x1234567890abcdefULL);
+    dut.isck0->b_transport(gp, t);
+    delete[] gp.get_data_ptr();
+    {
+        util::checkpoint_writer writer("memory_test.ckpt", 2);
+        dut.mem0.save_state(writer, "mem/");
+    }
+    // restore the content of mem0 into mem1, the page is faulted in upon the first access
+    auto reader = std::make_shared<util::checkpoint_reader>("memory_test.ckpt");
+    REQUIRE(reader->names("mem/page/").size() == 1);
+    dut.mem1.restore_state(reader, "mem/");
+    prepare_trans(gp, tlm::TLM_READ_COMMAND, 1_kB + 0x10, 0ULL);
+    dut.isck0->b_transport(gp, t);
+    uint64_t res;
+    memcpy(&res, gp.get_data_ptr(), sizeof(res));
+    delete[] gp.get_data_ptr();
+    CHECK(res == 0x1234567890abcdefULL);
+    std::remove("memory_test.ckpt");
+}
+
+TEST_CASE("checkpoint_restore_resets_state", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    sc_core::sc_time t;
+    auto write = [&t](std::function<void(tlm::tlm_generic_payload&, sc_core::sc_time&)> const& f, uint64_t addr, uint64_t val) {
+        tlm::tlm_generic_payload gp;
+        prepare_trans(gp, tlm::TLM_WRITE_COMMAND, addr, val);
+        f(gp, t);
+        REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+        delete[] gp.get_data_ptr();
+    };
+    auto read = [&t](std::function<void(tlm::tlm_generic_payload&, sc_core::sc_time&)> const& f, uint64_t addr) {
+        tlm::tlm_generic_payload gp;
+        prepare_trans(gp, tlm::TLM_READ_COMMAND, addr, 0ULL);
+        f(gp, t);
+        uint64_t res;
+        memcpy(&res, gp.get_data_ptr(), sizeof(res));
+        delete[] gp.get_data_ptr();
+        return res;
+    };
+    auto mem2 = [&dut](tlm::tlm_generic_payload& gp, sc_core::sc_time& d) { dut.mem2.handle_operation(gp, d); };
+    auto mem6 = [&dut](tlm::tlm_generic_payload& gp, sc_core::sc_time& d) { dut.mem6.handle_operation(gp, d); };
+    // the sparse array of mem2 has 2 pages, only the first one is in the checkpoint
+    write(mem2, 0x10, 0x1111111111111111ULL);
+    // the host mapped mem6 stores only non-zero chunks
+    write(mem6, 0x100, 0x2222222222222222ULL);
+    {
+        util::checkpoint_writer writer("memory_restore_test.ckpt", 2);
+        dut.mem2.save_state(writer, "mem2/");
+        dut.mem6.save_state(writer, "mem6/");
+    }
+    auto reader = std::make_shared<util::checkpoint_reader>("memory_restore_test.ckpt");
+    REQUIRE(reader->names("mem2/page/").size() == 1);
+    // modify the memories after the checkpoint
+    dut.mem2.enable_dirty_tracking();
+    write(mem2, 0x10, 0x3333333333333333ULL);
+    write(mem2, 17_MB, 0x4444444444444444ULL);
+    write(mem6, 0x100, 0x5555555555555555ULL);
+    write(mem6, 40_MB, 0x6666666666666666ULL);
+    REQUIRE(dut.mem2.is_dirty(17_MB));
+    // a reservation taken before the restore is lost
+    {
+        tlm::tlm_generic_payload gp;
+        tlm::scc::atomic_extension ext(util::amo_e::LOAD_RESERVED, 3);
+        prepare_trans(gp, tlm::TLM_READ_COMMAND, 16_MB + 0x40, 0ULL);
+        gp.set_extension(&ext);
+        dut.isck0->b_transport(gp, t);
+        gp.clear_extension(&ext);
+        delete[] gp.get_data_ptr();
+    }
+    dut.mem2.restore_state(reader, "mem2/");
+    dut.mem6.restore_state(reader, "mem6/");
+    CHECK(read(mem2, 0x10) == 0x1111111111111111ULL);
+    CHECK(read(mem2, 17_MB) == 0);
+    CHECK(read(mem6, 0x100) == 0x2222222222222222ULL);
+    CHECK(read(mem6, 40_MB) == 0);
+    CHECK_FALSE(dut.mem2.is_dirty(0, 18_MB));
+    {
+        tlm::tlm_generic_payload gp;
+        tlm::scc::atomic_extension ext(util::amo_e::STORE_CONDITIONAL, 3);
+        prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 16_MB + 0x40, 1ULL);
+        gp.set_extension(&ext);
+        dut.isck0->b_transport(gp, t);
+        gp.clear_extension(&ext);
+        delete[] gp.get_data_ptr();
+        CHECK_FALSE(ext.success);
+    }
+    std::remove("memory_restore_test.ckpt");
+}
+
+TEST_CASE("flattening_fallback", "[memory][tlm-level]") {
+    auto& dut = factory::get<testbench>();
+    REQUIRE(dut.flat_router.is_flattened());
+    REQUIRE_FALSE(dut.hooked_router.is_flattened());
+    tlm::tlm_generic_payload gp;
+    sc_core::sc_time t;
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 513_MB + 0x20, 0xfedcba9876543210ULL);
+    dut.isck2->b_transport(gp, t);
+    REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+    delete[] gp.get_data_ptr();
+    prepare_trans(gp, tlm::TLM_READ_COMMAND, 0x20, 0ULL);
+    dut.mem8.handle_operation(gp, t);
+    uint64_t res;
+    memcpy(&res, gp.get_data_ptr(), sizeof(res));
+    REQUIRE(res == 0xfedcba9876543210ULL);
+    delete[] gp.get_data_ptr();
+    // accesses beyond the nested router are decoded by it
+    prepare_trans(gp, tlm::TLM_WRITE_COMMAND, 513_MB + 8_kB, 0ULL);
+    dut.isck2->b_transport(gp, t);
+    REQUIRE(gp.get_response_status() == tlm::TLM_ADDRESS_ERROR_RESPONSE);
+    delete[] gp.get_data_ptr();
+}
+
 TEST_CASE("scattered_access", "[memory][tlm-level]") {
     auto& dut = factory::get<testbench>();
 
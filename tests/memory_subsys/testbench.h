@@ -57,15 +57,22 @@ struct testbench : public sc_core::sc_module {
     sc_core::sc_signal<bool> rst{"rst"};
     tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>> isck0{"isck0"};
     tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>> isck1{"isck1"};
+    tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>> isck2{"isck2"};
 
-    scc::router<scc::LT> router{"router", 7, 2};
+    scc::router<scc::LT> router{"router", 8, 2};
     scc::memory_tl<1_kB, scc::LT> mem0{"mem0"};
     scc::memory_tl<1_kB, scc::LT> mem1{"mem1"};
     scc::memory_tl<18_MB, scc::LT> mem2{"mem2"};
     scc::memory_tl<24_MB, scc::LT> mem3{"mem3"};
     scc::memory_tl<88_MB, scc::LT> mem4{"mem4"};
     scc::memory<4_GB> mem5{"mem5"};
+    scc::memory<64_MB> mem6{"mem6"};
     dmi_probe_target dmi_probe{"dmi_probe"};
+    scc::router<scc::LT> flat_router{"flat_router", 2, 1};
+    scc::router<scc::LT> sub_router{"sub_router", 1, 1};
+    scc::memory<64_kB> mem7{"mem7"};
+    scc::router<scc::LT> hooked_router{"hooked_router", 1, 1};
+    scc::memory<4_kB> mem8{"mem8"};
 
     testbench()
     : testbench(sc_core::sc_gen_unique_name("testbench", false)) {}
@@ -84,6 +91,21 @@ struct testbench : public sc_core::sc_module {
         router.set_default_target(5);
 
         router.bind_target(dmi_probe.target, 6, high_range_base, high_range_size, false);
+        router.bind_target(mem6.target, 7, 256_MB, 64_MB);
+        mem6.reserve_host_memory();
+        // a nested fabric being flattened at the end of elaboration
+        isck2(flat_router.target[0]);
+        flat_router.bind_target(sub_router.target[0], 0, 512_MB, 1_MB);
+        sub_router.bind_target(mem7.target, 0, 32_kB, 64_kB);
+        flat_router.set_flattening(true);
+        sub_router.set_flattening(true);
+        // a nested router with a callback registered at its target socket is accessed thru its sockets, this is
+        // detected as well if the callback is registered using a reference to the mixin
+        flat_router.bind_target(hooked_router.target[0], 1, 513_MB, 1_MB);
+        hooked_router.bind_target(mem8.target, 0, 0, 4_kB);
+        hooked_router.set_flattening(true);
+        tlm::scc::target_mixin<tlm::tlm_target_socket<scc::LT>>& hooked_sckt = hooked_router.target[0];
+        hooked_sckt.register_transport_dbg([](tlm::tlm_generic_payload&) -> unsigned { return 0; });
         mem0.clk_i(clk);
         mem1.clk_i(clk);
         mem2.clk_i(clk);
@@ -0,0 +1,92 @@
+#include <array>
+#include <factory.h>
+#include <fstream>
+#include <rapidjson/document.h>
+#include <scc/perf_counter.h>
+#include <scc/perf_estimator.h>
+#include <scc/utilities.h>
+#include <string>
+#include <systemc>
+#include <tlm/scc/socket_stats.h>
+#include <vector>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+char const telemetry_file[] = "perf_estimator_telemetry.jsonl";
+//! a thread accessing a socket every 10ns and a method triggered in the following delta cycle
+struct telemetry_tb : public sc_module {
+    scc::perf_estimator estimator;
+    tlm::scc::socket_stats stats{std::string(name()) + ".sckt"};
+    scc::perf_counter reactions{std::string(name()) + ".reactions"};
+    sc_event tick;
+
+    telemetry_tb()
+    : telemetry_tb(sc_gen_unique_name("telemetry_tb", false)) {}
+
+    telemetry_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        SC_HAS_PROCESS(telemetry_tb);
+        estimator.set_telemetry(telemetry_file, 100_ns);
+        SC_THREAD(run);
+        SC_METHOD(react);
+        sensitive << tick;
+        dont_initialize();
+    }
+
+    void run() {
+        std::array<uint8_t, 8> data{};
+        tlm::tlm_generic_payload gp;
+        gp.set_command(tlm::TLM_WRITE_COMMAND);
+        gp.set_data_ptr(data.data());
+        gp.set_data_length(data.size());
+        while(true) {
+            wait(10_ns);
+            stats.record_b_transport(gp, SC_ZERO_TIME, SC_ZERO_TIME);
+            tick.notify(SC_ZERO_TIME);
+        }
+    }
+
+    void react() { ++reactions; }
+};
+
+factory::add<telemetry_tb> tb;
+} // namespace
+
+TEST_CASE("perf_estimator telemetry", "[SCC][perf_estimator]") {
+    auto& dut = factory::get<telemetry_tb>();
+    sc_start(1_us);
+    std::vector<rapidjson::Document> records;
+    std::ifstream ifs(telemetry_file);
+    for(std::string line; std::getline(ifs, line);) {
+        records.emplace_back();
+        REQUIRE_FALSE(records.back().Parse(line.c_str()).HasParseError());
+    }
+    // the telemetry method writes a record every 100ns after the baseline at time 0
+    REQUIRE(records.size() >= 9);
+    auto const sckt = std::string(dut.stats.get_name());
+    uint64_t last_transactions = 0;
+    for(size_t i = 0; i < records.size(); ++i) {
+        auto const& r = records[i];
+        REQUIRE(r["sim_time_s"].GetDouble() == Catch::Approx((i + 1) * 1e-7));
+        // the stage callbacks see 10 time steps per record, each having a delta cycle for the method
+        REQUIRE(r["timesteps"].GetUint64() == 10);
+        REQUIRE(r["deltas"].GetUint64() >= 9);
+        REQUIRE(r["deltas"].GetUint64() <= 10);
+        REQUIRE(r["timed_ms"].GetDouble() >= 0.0);
+        REQUIRE(r["delta_ms"].GetDouble() >= 0.0);
+        // the counters of the socket are aggregated as well as the perf_counter
+        auto const& counters = r["counters"];
+        REQUIRE(counters.HasMember((sckt + ".transactions").c_str()));
+        auto const transactions = counters[(sckt + ".transactions").c_str()]["total"].GetUint64();
+        REQUIRE(transactions >= last_transactions + 9);
+        REQUIRE(transactions <= (i + 1) * 10);
+        REQUIRE(counters[(sckt + ".bytes").c_str()]["total"].GetUint64() == transactions * 8);
+        REQUIRE(counters[(sckt + ".transactions").c_str()]["rate"].GetDouble() > 0.0);
+        REQUIRE(counters[(std::string(dut.name()) + ".reactions").c_str()]["total"].GetUint64() >= i * 10);
+        last_transactions = transactions;
+    }
+    REQUIRE(dut.stats.transactions() >= last_transactions);
+}
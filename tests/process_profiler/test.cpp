@@ -0,0 +1,81 @@
+#include <algorithm>
+#include <chrono>
+#include <factory.h>
+#include <scc/process_profiler.h>
+#include <scc/utilities.h>
+#include <string>
+#include <systemc>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+//! two methods triggered by the same event, only one of them burns wall clock time
+struct profiler_tb : public sc_module {
+    scc::process_profiler profiler;
+    sc_event tick;
+
+    profiler_tb()
+    : profiler_tb(sc_gen_unique_name("profiler_tb", false)) {}
+
+    profiler_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        SC_HAS_PROCESS(profiler_tb);
+        SC_THREAD(clock);
+        SC_METHOD(heavy);
+        sensitive << tick;
+        dont_initialize();
+        SC_METHOD(light);
+        sensitive << tick;
+        dont_initialize();
+    }
+
+    void clock() {
+        while(true) {
+            wait(10_ns);
+            tick.notify();
+        }
+    }
+
+    void heavy() {
+        scc::process_profiler::count_activation();
+        auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(3);
+        while(std::chrono::steady_clock::now() < end)
+            ;
+    }
+
+    void light() { scc::process_profiler::count_activation(); }
+};
+
+factory::add<profiler_tb> tb;
+
+using process_profile = scc::process_profiler::process_profile;
+
+process_profile find(std::vector<process_profile> const& profile, std::string const& name) {
+    auto it = std::find_if(profile.begin(), profile.end(), [&name](process_profile const& p) { return p.name == name; });
+    REQUIRE(it != profile.end());
+    return *it;
+}
+} // namespace
+
+TEST_CASE("process_profiler_attribution", "[process_profiler]") {
+    auto& dut = factory::get<profiler_tb>();
+    // ticks at 10ns...100ns
+    sc_start(105_ns);
+    auto const profile = dut.profiler.get_profile();
+    REQUIRE(profile.size() >= 2);
+    auto const heavy = find(profile, std::string(dut.name()) + ".heavy");
+    auto const light = find(profile, std::string(dut.name()) + ".light");
+    REQUIRE(heavy.activations == 10);
+    REQUIRE(light.activations == 10);
+    // the time is attributed to the process burning it, not to the one running next
+    REQUIRE(profile.front().name == heavy.name);
+    REQUIRE(heavy.time >= std::chrono::milliseconds(25));
+    REQUIRE(light.time * 10 < heavy.time);
+    if(dut.profiler.is_sampling()) {
+        REQUIRE(heavy.samples > light.samples);
+        REQUIRE(heavy.deltas > 0);
+        REQUIRE(heavy.deltas <= 10);
+    }
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include "cxs_sender.h"
+#include <algorithm>
+#include <scc/report.h>
+
+using namespace sc_core;
+
+namespace {
+//! a memory manager allocating each packet on the heap as reference for the pooling tlm_mm
+struct heap_pkt_mm : public tlm::nw::tlm_base_mm_interface {
+    static heap_pkt_mm& get() {
+        static heap_pkt_mm mm;
+        return mm;
+    }
+    void free(tlm::nw::tlm_network_payload_base* trans) override { delete trans; }
+};
+// the CXS transmitter needs at least one byte to fill a bucket
+unsigned const min_payload = 4;
+} // namespace
+
+cxs_sender::cxs_sender(const sc_core::sc_module_name& nm, config const& cfg)
+: sc_module(nm)
+, cfg(cfg) {
+    SC_HAS_PROCESS(cxs_sender);
+    isck.register_nb_transport_bw(
+        [this](transaction_type& trans, phase_type& phase, sc_core::sc_time& t) { return this->nb_bw(trans, phase, t); });
+    tsck.register_nb_transport_fw(
+        [this](transaction_type& trans, phase_type& phase, sc_core::sc_time& t) { return this->nb_fw(trans, phase, t); });
+    SC_THREAD(run);
+}
+
+void cxs_sender::run() {
+    sc_assert(peer);
+    wait(rst_i.negedge_event());
+    wait(clk_i.posedge_event());
+    for(auto i = 0U; i < cfg.count; i++) {
+        if(cfg.clocked && i)
+            wait(clk_i.posedge_event());
+        while(i - peer->received_count >= cfg.dim)
+            wait(peer->received_evt);
+        cxs::cxs_pkt_shared_ptr pkt = cfg.alloc == config::alloc_e::HEAP ? new transaction_type(&heap_pkt_mm::get())
+                                                                         : cxs::cxs_pkt_mm::get().allocate();
+        pkt->get_data().resize(std::max(cfg.payload, min_payload));
+        tlm::tlm_phase phase{tlm::nw::REQUEST};
+        sc_time delay;
+        auto sync = isck->nb_transport_fw(*pkt, phase, delay);
+        sc_assert(sync == tlm::TLM_UPDATED && phase == tlm::nw::CONFIRM);
+    }
+    while(peer->received_count < cfg.count)
+        wait(peer->received_evt);
+    finish_evt.notify(SC_ZERO_TIME);
+}
+
+tlm::tlm_sync_enum cxs_sender::nb_fw(transaction_type& trans, phase_type& phase, sc_core::sc_time& t) {
+    sc_assert(phase == tlm::nw::REQUEST);
+    received_count++;
+    received_evt.notify(SC_ZERO_TIME);
+    phase = tlm::nw::CONFIRM;
+    return tlm::TLM_UPDATED;
+}
+
+tlm::tlm_sync_enum cxs_sender::nb_bw(transaction_type& trans, phase_type& phase, sc_core::sc_time& t) {
+    sc_assert(phase == tlm::nw::CONFIRM);
+    return tlm::TLM_ACCEPTED;
+}
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright 2026 MINRES Technologies GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#ifndef _SIM_PERFORMANCE_CXS_SENDER_H_
+#define _SIM_PERFORMANCE_CXS_SENDER_H_
+
+#include "types.h"
+#include <cxs/cxs_tlm.h>
+#include <systemc>
+#include <tlm/nw/initiator_mixin.h>
+#include <tlm/nw/target_mixin.h>
+
+/**
+ * one hop of a CXS chain: a transmitter packing the packets into flits, the channel and the receiver unpacking them
+ */
+struct cxs_link : public sc_core::sc_module {
+    static constexpr unsigned PHIT_WIDTH = 256;
+    sc_core::sc_in<bool> clk_i{"clk_i"};
+    sc_core::sc_in<bool> rst_i{"rst_i"};
+    cxs::cxs_transmitter<PHIT_WIDTH> tx{"tx"};
+    cxs::cxs_channel<PHIT_WIDTH> chan{"chan"};
+    cxs::cxs_receiver<PHIT_WIDTH> rx{"rx"};
+
+    cxs_link(sc_core::sc_module_name const& nm)
+    : sc_core::sc_module(nm) {
+        tx.clk_i(clk_i);
+        tx.rst_i(rst_i);
+        chan.tx_clk_i(clk_i);
+        chan.rx_clk_i(clk_i);
+        rx.clk_i(clk_i);
+        rx.rst_i(rst_i);
+        tx.isck(chan.tsck);
+        chan.isck(rx.tsck);
+        rx.max_credit.set_value(15);
+    }
+};
+
+/**
+ * the counterpart of pkt_sender using tlm::nw CXS packets. The packets of a sender travel thru a chain of cxs_link to
+ * the sender at the opposite side of the mesh (its peer), at most dim packets are in flight.
+ */
+class cxs_sender : sc_core::sc_module {
+public:
+    using transaction_type = cxs::cxs_packet_types::tlm_payload_type;
+    using phase_type = cxs::cxs_packet_types::tlm_phase_type;
+
+    sc_core::sc_in<bool> clk_i{"clk_i"};
+    sc_core::sc_in<bool> rst_i{"rst_i"};
+    tlm::nw::initiator_mixin<cxs::cxs_pkt_initiator_socket<>, cxs::cxs_packet_types> isck{"isck"};
+    tlm::nw::target_mixin<cxs::cxs_pkt_target_socket<>, false, cxs::cxs_packet_types> tsck{"tsck"};
+    cxs_sender(sc_core::sc_module_name const&, config const& cfg);
+    virtual ~cxs_sender() = default;
+    //! sets the sender receiving the packets of this one
+    void set_peer(cxs_sender& p) { peer = &p; }
+    sc_core::sc_event const& get_finish_event() { return finish_evt; }
+    //! the number of packets received from the opposite sender
+    unsigned get_received() const { return received_count; }
+
+private:
+    void run();
+    tlm::tlm_sync_enum nb_fw(transaction_type&, phase_type&, sc_core::sc_time&);
+    tlm::tlm_sync_enum nb_bw(transaction_type&, phase_type&, sc_core::sc_time&);
+    sc_core::sc_event finish_evt, received_evt;
+    config const cfg;
+    cxs_sender* peer{nullptr};
+    unsigned received_count{0};
+};
+
+#endif /* _SIM_PERFORMANCE_CXS_SENDER_H_ */
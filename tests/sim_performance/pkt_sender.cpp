@@ -6,19 +6,35 @@
  */
 
 #include "pkt_sender.h"
-#include "types.h"
 #include <scc/report.h>
 #include <tlm/scc/tlm_mm.h>
 
 using namespace sc_core;
 
-pkt_sender::pkt_sender(const sc_core::sc_module_name& nm, unsigned dim, unsigned pos_x, unsigned pos_y, unsigned count)
+namespace {
+//! a memory manager allocating each payload and its data on the heap as reference for the pooling tlm_mm
+struct heap_mm : public tlm::tlm_mm_interface {
+    static heap_mm& get() {
+        static heap_mm mm;
+        return mm;
+    }
+    void free(tlm::tlm_generic_payload* gp) override {
+        delete[] gp->get_data_ptr();
+        gp->set_data_ptr(nullptr);
+        gp->reset();
+        delete gp;
+    }
+};
+} // namespace
+
+pkt_sender::pkt_sender(const sc_core::sc_module_name& nm, unsigned pos_x, unsigned pos_y, config const& cfg)
 : sc_module(nm)
 , bw_peq("bw_peq")
 , fw_peq("fw_peq")
+, bw_speq("bw_speq")
+, fw_speq("fw_speq")
 , my_pos{pos_x, pos_y}
-, dim{dim}
-, count{count} {
+, cfg(cfg) {
     SCCDEBUG(SCMOD) << "instantiating sender " << pos_x << "/" << pos_y;
     SC_HAS_PROCESS(pkt_sender);
     isck.register_nb_transport_bw([this](tlm::tlm_generic_payload& gp, tlm::tlm_phase& phase,
@@ -26,12 +42,16 @@ pkt_sender::pkt_sender(const sc_core::sc_module_name& nm, unsigned dim, unsigned
     tsck.register_nb_transport_fw([this](tlm::tlm_generic_payload& gp, tlm::tlm_phase& phase,
                                          sc_core::sc_time& delay) -> tlm::tlm_sync_enum { return this->nb_fw(gp, phase, delay); });
     SC_METHOD(received);
-    sensitive << fw_peq.get_event();
+    if(cfg.peq == config::peq_e::SCC)
+        sensitive << fw_speq.event();
+    else
+        sensitive << fw_peq.get_event();
     dont_initialize();
     SC_THREAD(run);
 }
 
 void pkt_sender::gen_routing(std::vector<uint8_t>& route_vec) {
+    auto const dim = cfg.dim;
     if(std::get<0>(my_pos) == 0) {
         for(auto i = 0; i < dim; ++i)
             route_vec.push_back(RIGHT);
@@ -48,10 +68,27 @@ void pkt_sender::gen_routing(std::vector<uint8_t>& route_vec) {
         SCCERR(SCMOD) << "WTF!?!";
 }
 
+tlm::tlm_generic_payload* pkt_sender::allocate() {
+    if(cfg.alloc == config::alloc_e::HEAP) {
+        auto* gp = new tlm::tlm_generic_payload(&heap_mm::get());
+        if(cfg.payload) {
+            gp->set_data_ptr(new uint8_t[cfg.payload]);
+            gp->set_data_length(cfg.payload);
+        }
+        gp->set_auto_extension(new packet_ext);
+        return gp;
+    }
+    if(cfg.payload)
+        return tlm::scc::tlm_mm<>::get().allocate<packet_ext>(cfg.payload);
+    return tlm::scc::tlm_mm<>::get().allocate<packet_ext>();
+}
+
 void pkt_sender::run() {
     wait(clk_i.posedge_event());
-    for(auto i = 0U; i < count; i++) {
-        tlm::tlm_generic_payload* gp = tlm::scc::tlm_mm<>::get().allocate<packet_ext>();
+    for(auto i = 0U; i < cfg.count; i++) {
+        if(cfg.clocked && i)
+            wait(clk_i.posedge_event());
+        tlm::tlm_generic_payload* gp = allocate();
         gen_routing(gp->get_extension<packet_ext>()->routing);
         tlm::tlm_phase phase{tlm::BEGIN_REQ};
         sc_time delay;
@@ -59,9 +96,12 @@ void pkt_sender::run() {
         auto sync = isck->nb_transport_fw(*gp, phase, delay);
         sc_assert(sync == tlm::TLM_UPDATED && phase == tlm::END_REQ);
         tlm::tlm_generic_payload* ret{nullptr};
-        while(!(ret = bw_peq.get_next_transaction())) {
-            wait(bw_peq.get_event());
-        }
+        if(cfg.peq == config::peq_e::SCC)
+            ret = bw_speq.get();
+        else
+            while(!(ret = bw_peq.get_next_transaction())) {
+                wait(bw_peq.get_event());
+            }
         sc_assert(gp == ret);
         ret->release();
     }
@@ -70,7 +110,10 @@ void pkt_sender::run() {
 
 tlm::tlm_sync_enum pkt_sender::nb_bw(tlm::tlm_generic_payload& gp, tlm::tlm_phase& phase, sc_core::sc_time& delay) {
     sc_assert(phase == tlm::BEGIN_RESP);
-    bw_peq.notify(gp, delay);
+    if(cfg.peq == config::peq_e::SCC)
+        bw_speq.notify(&gp, delay);
+    else
+        bw_peq.notify(gp, delay);
     phase = tlm::END_RESP;
     return tlm::TLM_COMPLETED;
 }
@@ -80,17 +123,27 @@ tlm::tlm_sync_enum pkt_sender::nb_fw(tlm::tlm_generic_payload& gp, tlm::tlm_phas
     auto ext = gp.get_extension<packet_ext>();
     sc_assert(ext->routing.size() == 0);
     gp.acquire();
-    fw_peq.notify(gp, delay);
+    if(cfg.peq == config::peq_e::SCC)
+        fw_speq.notify(&gp, delay);
+    else
+        fw_peq.notify(gp, delay);
     phase = tlm::END_REQ;
     return tlm::TLM_UPDATED;
 }
 
 void pkt_sender::received() {
-    if(auto gp = fw_peq.get_next_transaction()) {
+    tlm::tlm_generic_payload* gp{nullptr};
+    if(cfg.peq == config::peq_e::SCC) {
+        if(auto next = fw_speq.get_next())
+            gp = next.get();
+    } else
+        gp = fw_peq.get_next_transaction();
+    if(gp) {
         tlm::tlm_phase phase{tlm::BEGIN_RESP};
         sc_time delay;
         auto sync = tsck->nb_transport_bw(*gp, phase, delay);
         sc_assert(sync == tlm::TLM_COMPLETED && phase == tlm::END_RESP);
         gp->release();
+        received_count++;
     }
 }
@@ -21,10 +21,16 @@
  */
 
 #include "top.h"
+#include <bench.h>
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <ctime>
+#include <fmt/format.h>
+#include <scc/configurer.h>
 #include <scc/perf_estimator.h>
 #include <scc/report.h>
 #include <scc/tracer.h>
+#include <sys/resource.h>
 
 using namespace scc;
 namespace po = boost::program_options;
@@ -33,6 +39,11 @@ namespace {
 const size_t ERROR_IN_COMMAND_LINE = 1;
 const size_t SUCCESS = 0;
 const size_t ERROR_UNHANDLED_EXCEPTION = 2;
+//! the peak resident set size in KiB
+double peak_rss() {
+    struct rusage usage {};
+    return getrusage(RUSAGE_SELF, &usage) != -1 ? usage.ru_maxrss : 0.;
+}
 } // namespace
 
 int sc_main(int argc, char* argv[]) {
@@ -47,8 +58,16 @@ int sc_main(int argc, char* argv[]) {
     		("help,h",  "Print help message")
 			("debug,d", "set debug level")
 			("trace,t", "trace SystemC signals")
-			("dim",     po::value<unsigned>()->default_value(16))
-			("count",   po::value<unsigned>()->default_value(16384));
+			("dim",     po::value<unsigned>()->default_value(16), "dimension of the mesh")
+			("count",   po::value<unsigned>()->default_value(16384), "number of packets sent by each sender")
+			("payload", po::value<unsigned>()->default_value(0), "size of the packet data in bytes")
+			("clocked", "send at most one packet per clock cycle instead of as soon as the previous one was accepted")
+			("peq",     po::value<std::string>()->default_value("tlm"), "PEQ of the senders: tlm (peq_with_get) or scc (scc::peq)")
+			("alloc",   po::value<std::string>()->default_value("mm"), "packet allocation: mm (tlm_mm pool) or heap (new/delete)")
+			("mode",    po::value<std::string>()->default_value("gp"), "gp: switch mesh of generic payloads, cxs: tlm::nw packets via CXS")
+			("timeout", po::value<unsigned>()->default_value(1), "simulation time limit in ms")
+			("benchmark_out", po::value<std::string>()->default_value(""), "file to write the results to")
+			("benchmark_format", po::value<std::string>()->default_value("console"), "format of the results: console or json");
     // clang-format on
     po::variables_map vm;
     try {
@@ -60,6 +79,11 @@ int sc_main(int argc, char* argv[]) {
         }
         po::notify(vm); // throws on error, so do after help in case
         // there are any problems
+        auto const& mode = vm["mode"].as<std::string>();
+        auto const& peq = vm["peq"].as<std::string>();
+        auto const& alloc = vm["alloc"].as<std::string>();
+        if((mode != "gp" && mode != "cxs") || (peq != "tlm" && peq != "scc") || (alloc != "mm" && alloc != "heap"))
+            throw po::error("invalid value of option mode, peq or alloc");
     } catch(po::error& e) {
         std::cerr << "ERROR: " << e.what() << std::endl << std::endl;
         std::cerr << desc << std::endl;
@@ -74,19 +98,44 @@ int sc_main(int argc, char* argv[]) {
     ///////////////////////////////////////////////////////////////////////////
     // tracer trace("simple_system", tracer::TEXT, vm.count("trace"));
     //  todo: fix displayed clock period in VCD
+    config cfg;
+    cfg.dim = vm["dim"].as<unsigned>();
+    cfg.count = vm["count"].as<unsigned>();
+    cfg.payload = vm["payload"].as<unsigned>();
+    cfg.clocked = vm.count("clocked");
+    cfg.peq = vm["peq"].as<std::string>() == "scc" ? config::peq_e::SCC : config::peq_e::TLM;
+    cfg.alloc = vm["alloc"].as<std::string>() == "heap" ? config::alloc_e::HEAP : config::alloc_e::MM;
+    cfg.mode = vm["mode"].as<std::string>() == "cxs" ? config::mode_e::CXS : config::mode_e::GP;
+    bench::result res;
+    res.name = fmt::format("noc/{}/{}x{}/payload:{}/{}/peq:{}/alloc:{}", vm["mode"].as<std::string>(), cfg.dim, cfg.dim, cfg.payload,
+                           cfg.clocked ? "clocked" : "tickless", vm["peq"].as<std::string>(), vm["alloc"].as<std::string>());
+    res.iterations = 1;
     try {
         ///////////////////////////////////////////////////////////////////////////
         // instantiate top level
         ///////////////////////////////////////////////////////////////////////////
+        scc::configurer conf("");
         perf_estimator estimator;
-        auto const count = vm["count"].as<unsigned>();
-        auto const dim = vm["dim"].as<unsigned>();
-        SCCINFO() << "Instantiating " << (unsigned)dim << "x" << (unsigned)dim << " matrix and executing " << count << " accesses";
-        top i_top("i_top", dim, count);
+        SCCINFO() << "Instantiating " << cfg.dim << "x" << cfg.dim << " matrix and executing " << cfg.count << " accesses";
+        top i_top("i_top", cfg);
         ///////////////////////////////////////////////////////////////////////////
         // run simulation
         ///////////////////////////////////////////////////////////////////////////
-        sc_start(sc_core::sc_time(1, sc_core::SC_MS));
+        auto const real_start = std::chrono::steady_clock::now();
+        auto const cpu_start = std::clock();
+        auto const delta_start = sc_core::sc_delta_count();
+        sc_start(sc_core::sc_time(vm["timeout"].as<unsigned>(), sc_core::SC_MS));
+        auto const real_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - real_start).count();
+        auto const deltas = static_cast<double>(sc_core::sc_delta_count() - delta_start);
+        auto const packets = static_cast<double>(i_top.get_received());
+        res.real_time = real_time * 1e9;
+        res.cpu_time = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC * 1e9;
+        res.counters.emplace_back("packets", packets);
+        res.counters.emplace_back("packets_per_second", packets / real_time);
+        res.counters.emplace_back("delta_cycles", deltas);
+        res.counters.emplace_back("delta_cycles_per_second", deltas / real_time);
+        res.counters.emplace_back("sim_time_s", sc_core::sc_time_stamp().to_seconds());
+        res.counters.emplace_back("peak_rss_kib", peak_rss());
         if(sc_core::sc_is_running()) {
             SCCERR() << "simulation timed out"; // calls sc_stop
             sc_core::sc_stop();
@@ -100,6 +149,10 @@ int sc_main(int argc, char* argv[]) {
     }
     auto errcnt = sc_core::sc_report_handler::get_count(sc_core::SC_ERROR);
     auto warncnt = sc_core::sc_report_handler::get_count(sc_core::SC_WARNING);
+    if(errcnt)
+        res.error = "simulation finished with errors";
+    if(!bench::write_results({res}, vm["benchmark_out"].as<std::string>(), vm["benchmark_format"].as<std::string>() == "json"))
+        ++errcnt;
     SCCINFO() << "simulation finished, " << errcnt << " error" << (errcnt == 1 ? "" : "s") << " and " << warncnt << " warning"
               << (warncnt == 1 ? "" : "s");
     return errcnt + warncnt;
@@ -13,10 +13,20 @@
 using namespace sc_core;
 using namespace fmt;
 
-top::top(sc_core::sc_module_name const& nm, uint8_t dimension, unsigned count)
-: sc_module(nm) {
-    sc_assert(dimension > 0);
+top::top(sc_core::sc_module_name const& nm, config const& cfg)
+: sc_module(nm)
+, cfg(cfg) {
+    sc_assert(cfg.dim > 0);
     SC_HAS_PROCESS(top);
+    if(cfg.mode == config::mode_e::CXS)
+        build_cxs_chains();
+    else
+        build_mesh();
+    SC_THREAD(run);
+}
+
+void top::build_mesh() {
+    auto const dimension = cfg.dim;
     for(auto yidx = 0U; yidx < dimension; ++yidx) {
         for(auto xidx = 0U; xidx < dimension; ++xidx) {
             auto name = format("sw_{}_{}", xidx, yidx);
@@ -44,7 +54,7 @@ top::top(sc_core::sc_module_name const& nm, uint8_t dimension, unsigned count)
     auto xidx = 0U;
     for(xidx = 0U; xidx < dimension; ++xidx) {
         auto name = format("snd_{}_{}", xidx + 1, 0);
-        senders[TOP].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), dimension, xidx + 1, 0, count));
+        senders[TOP].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), xidx + 1, 0, cfg));
         auto& snd = senders[TOP].back();
         snd->clk_i(clk);
         auto& sw = switches[yidx * dimension + xidx];
@@ -54,7 +64,7 @@ top::top(sc_core::sc_module_name const& nm, uint8_t dimension, unsigned count)
     yidx = dimension - 1;
     for(xidx = 0U; xidx < dimension; ++xidx) {
         auto name = format("snd_{}_{}", xidx + 1, dimension + 1);
-        senders[BOTTOM].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), dimension, xidx + 1, dimension + 1, count));
+        senders[BOTTOM].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), xidx + 1, dimension + 1, cfg));
         auto& snd = senders[BOTTOM].back();
         snd->clk_i(clk);
         auto& sw = switches[yidx * dimension + xidx];
@@ -64,7 +74,7 @@ top::top(sc_core::sc_module_name const& nm, uint8_t dimension, unsigned count)
     xidx = 0U;
     for(yidx = 0U; yidx < dimension; ++yidx) {
         auto name = format("snd_{}_{}", 0, yidx + 1);
-        senders[LEFT].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), dimension, 0, yidx + 1, count));
+        senders[LEFT].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), 0, yidx + 1, cfg));
         auto& snd = senders[LEFT].back();
         snd->clk_i(clk);
         auto& sw = switches[yidx * dimension + xidx];
@@ -74,14 +84,59 @@ top::top(sc_core::sc_module_name const& nm, uint8_t dimension, unsigned count)
     xidx = dimension - 1;
     for(yidx = 0U; yidx < dimension; ++yidx) {
         auto name = format("snd_{}_{}", dimension + 1, yidx + 1);
-        senders[RIGHT].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), dimension, dimension + 1, yidx + 1, count));
+        senders[RIGHT].push_back(scc::make_unique<pkt_sender>(sc_module_name(name.c_str()), dimension + 1, yidx + 1, cfg));
         auto& snd = senders[RIGHT].back();
         snd->clk_i(clk);
         auto& sw = switches[yidx * dimension + xidx];
         snd->isck(sw->tsck[RIGHT]);
         sw->isck[RIGHT](snd->tsck);
     }
-    SC_THREAD(run);
+}
+
+void top::build_cxs_chains() {
+    auto const dimension = cfg.dim;
+    for(auto side = 0U; side < SIDES; ++side) {
+        for(auto idx = 0U; idx < dimension; ++idx) {
+            auto name = format("snd_{}_{}", side == LEFT ? 0 : side == RIGHT ? dimension + 1 : idx + 1,
+                               side == TOP ? 0 : side == BOTTOM ? dimension + 1 : idx + 1);
+            cxs_senders[side].push_back(scc::make_unique<cxs_sender>(sc_module_name(name.c_str()), cfg));
+            cxs_senders[side].back()->clk_i(clk);
+            cxs_senders[side].back()->rst_i(rst);
+        }
+    }
+    for(auto idx = 0U; idx < dimension; ++idx) {
+        connect(*cxs_senders[TOP][idx], *cxs_senders[BOTTOM][idx], format("link_down_{}", idx + 1));
+        connect(*cxs_senders[BOTTOM][idx], *cxs_senders[TOP][idx], format("link_up_{}", idx + 1));
+        connect(*cxs_senders[LEFT][idx], *cxs_senders[RIGHT][idx], format("link_right_{}", idx + 1));
+        connect(*cxs_senders[RIGHT][idx], *cxs_senders[LEFT][idx], format("link_left_{}", idx + 1));
+    }
+}
+
+void top::connect(cxs_sender& from, cxs_sender& to, std::string const& prefix) {
+    // a packet passes dim links like it passes dim switches in the mesh
+    auto const first = cxs_links.size();
+    for(auto hop = 0U; hop < cfg.dim; ++hop) {
+        auto name = format("{}_{}", prefix, hop);
+        cxs_links.push_back(scc::make_unique<cxs_link>(sc_module_name(name.c_str())));
+        cxs_links.back()->clk_i(clk);
+        cxs_links.back()->rst_i(rst);
+        if(hop)
+            cxs_links[first + hop - 1]->rx.isck(cxs_links.back()->tx.tsck);
+    }
+    from.isck(cxs_links[first]->tx.tsck);
+    cxs_links.back()->rx.isck(to.tsck);
+    from.set_peer(to);
+}
+
+uint64_t top::get_received() const {
+    uint64_t res = 0;
+    for(auto& sides : senders)
+        for(auto& sender : sides)
+            res += sender->get_received();
+    for(auto& sides : cxs_senders)
+        for(auto& sender : sides)
+            res += sender->get_received();
+    return res;
 }
 
 void top::run() {
@@ -91,6 +146,17 @@ void top::run() {
             evt_list &= sender->get_finish_event();
         }
     }
+    for(auto& sides : cxs_senders) {
+        for(auto& sender : sides) {
+            evt_list &= sender->get_finish_event();
+        }
+    }
+    if(cfg.mode == config::mode_e::CXS) {
+        // the CXS receivers hand out their credits while being in reset
+        rst.write(true);
+        wait(4 * clk.period());
+        rst.write(false);
+    }
     wait(evt_list);
     sc_stop();
 }
@@ -8,6 +8,7 @@
 #ifndef _SIM_PERFORMANCE_TOP_H_
 #define _SIM_PERFORMANCE_TOP_H_
 
+#include "cxs_sender.h"
 #include "pkt_sender.h"
 #include "pkt_switch.h"
 #include "types.h"
@@ -17,14 +18,23 @@
 
 class top : public sc_core::sc_module {
 public:
-    top(sc_core::sc_module_name const&, uint8_t, unsigned);
+    top(sc_core::sc_module_name const&, config const&);
     virtual ~top() = default;
+    //! the number of packets which arrived at their destination
+    uint64_t get_received() const;
 
 private:
     void run();
+    void build_mesh();
+    void build_cxs_chains();
+    void connect(cxs_sender&, cxs_sender&, std::string const&);
+    config const cfg;
     sc_core::sc_clock clk;
+    sc_core::sc_signal<bool> rst{"rst"};
     std::array<std::vector<std::unique_ptr<pkt_sender>>, SIDES> senders;
     std::vector<std::unique_ptr<pkt_switch>> switches;
+    std::array<std::vector<std::unique_ptr<cxs_sender>>, SIDES> cxs_senders;
+    std::vector<std::unique_ptr<cxs_link>> cxs_links;
 };
 
 #endif /* TESTS_SIM_PERFORMANCE_TOP_H_ */
@@ -10,4 +10,25 @@
 
 enum { TOP = 0, RIGHT = 1, BOTTOM = 2, LEFT = 3, SIDES = 4 };
 
+/**
+ * the variant of the benchmark as selected on the command line
+ */
+struct config {
+    //! gp: mesh of pkt_switch using tlm_generic_payload, cxs: tlm::nw packets sent thru chains of CXS links
+    enum class mode_e { GP, CXS };
+    //! the PEQ used by the senders: tlm_utils::peq_with_get or scc::peq
+    enum class peq_e { TLM, SCC };
+    //! the allocation of the packets: pooled by tlm::scc::tlm_mm or plain new/delete
+    enum class alloc_e { MM, HEAP };
+    unsigned dim{16};
+    unsigned count{16384};
+    //! the size of the data of a packet in bytes
+    unsigned payload{0};
+    //! if set a sender sends at most one packet per clock cycle otherwise as soon as the previous one was accepted
+    bool clocked{false};
+    peq_e peq{peq_e::TLM};
+    alloc_e alloc{alloc_e::MM};
+    mode_e mode{mode_e::GP};
+};
+
 #endif /* TESTS_SIM_PERFORMANCE_TYPES_H_ */
@@ -0,0 +1,79 @@
+#include <catch2/catch_all.hpp>
+#include <factory.h>
+#include <map>
+#include <sstream>
+#include <tlm/scc/socket_stats.h>
+
+using namespace sc_core;
+using tlm::scc::latency_histogram;
+
+TEST_CASE("latency histogram buckets", "[SCC][socket_stats]") {
+    unsigned const buckets = latency_histogram::bucket_count;
+    for(uint64_t v : {0ULL, 1ULL, 7ULL, 8ULL, 15ULL, 16ULL, 17ULL, 1000ULL, 123456789ULL, ~0ULL}) {
+        auto idx = latency_histogram::index(v);
+        REQUIRE(idx < buckets);
+        REQUIRE(latency_histogram::lower_bound(idx) <= v);
+        if(idx + 1 < buckets)
+            REQUIRE(latency_histogram::lower_bound(idx + 1) > v);
+    }
+    // values below 16 are exact
+    REQUIRE(latency_histogram::index(15) == 15);
+    REQUIRE(latency_histogram::lower_bound(latency_histogram::index(17)) == 16);
+}
+
+TEST_CASE("latency histogram percentiles", "[SCC][socket_stats]") {
+    latency_histogram h;
+    REQUIRE(h.percentile(0.5) == 0);
+    for(uint64_t v = 1; v <= 1000; ++v)
+        h.record(v);
+    REQUIRE(h.count() == 1000);
+    REQUIRE(h.min() == 1);
+    REQUIRE(h.max() == 1000);
+    REQUIRE(h.mean() == Catch::Approx(500.5));
+    // the relative error is limited by the sub-bucket resolution
+    REQUIRE(h.percentile(0.5) >= 500);
+    REQUIRE(h.percentile(0.5) <= 500 * 9 / 8);
+    REQUIRE(h.percentile(0.99) >= 990);
+    REQUIRE(h.percentile(1.0) == 1000);
+    latency_histogram h2(h);
+    h2.merge(h);
+    REQUIRE(h2.count() == 2000);
+    REQUIRE(h2.percentile(0.5) == h.percentile(0.5));
+}
+
+TEST_CASE("socket stats counting", "[SCC][socket_stats]") {
+    tlm::scc::socket_stats stats("top.sckt");
+    tlm::tlm_generic_payload gp;
+    gp.set_command(tlm::TLM_WRITE_COMMAND);
+    gp.set_data_length(8);
+    stats.record_b_transport(gp, SC_ZERO_TIME, sc_time(10, SC_NS));
+    gp.set_command(tlm::TLM_READ_COMMAND);
+    gp.set_data_length(4);
+    tlm::tlm_phase phase{tlm::BEGIN_REQ};
+    stats.record_nb_transport(gp, phase);
+    phase = tlm::END_REQ;
+    stats.record_nb_transport(gp, phase);
+    stats.record_dmi(true);
+    stats.record_dmi(false);
+    REQUIRE(stats.b_transports == 1);
+    REQUIRE(stats.nb_transports == 1);
+    REQUIRE(stats.writes == 1);
+    REQUIRE(stats.write_bytes == 8);
+    REQUIRE(stats.reads == 1);
+    REQUIRE(stats.read_bytes == 4);
+    REQUIRE(stats.dmi_requests == 2);
+    REQUIRE(stats.dmi_grants == 1);
+    REQUIRE(stats.latency.count() == 1);
+    REQUIRE(stats.transactions() == 2);
+    REQUIRE(stats.bytes() == 12);
+    // the telemetry finds the counters of all sockets
+    std::map<std::string, uint64_t> transactions;
+    tlm::scc::socket_stats::for_each([&transactions](tlm::scc::socket_stats const& s) { transactions[s.get_name()] = s.transactions(); });
+    REQUIRE(transactions["top.sckt"] == 2);
+    std::ostringstream os;
+    tlm::scc::socket_stats::dump_all(os, sc_time(1, SC_US));
+    REQUIRE(os.str().find("top.sckt: b_transport=1 nb_transport=1") == 0);
+    stats.reset();
+    REQUIRE(stats.b_transports == 0);
+    REQUIRE(stats.latency.count() == 0);
+}
@@ -0,0 +1,127 @@
+#include <array>
+#include <factory.h>
+#include <map>
+#include <scc/router.h>
+#include <scc/utilities.h>
+#include <sstream>
+#include <systemc>
+#include <tlm/scc/initiator_mixin.h>
+#include <tlm/scc/target_mixin.h>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+#ifndef WITH_TLM_STATS
+#error "the socket statistics of the mixins need the SCC libraries being built with ENABLE_TLM_STATS"
+#endif
+
+using namespace sc_core;
+
+namespace {
+//! a target answering each access after 10ns, it refuses DMI
+struct stats_target : public sc_module {
+    tlm::scc::target_mixin<tlm::tlm_target_socket<scc::LT>> tsck{"tsck"};
+
+    stats_target(sc_module_name const& nm)
+    : sc_module(nm) {
+        tsck.register_b_transport([](tlm::tlm_generic_payload& gp, sc_time& d) {
+            d += 10_ns;
+            gp.set_response_status(tlm::TLM_OK_RESPONSE);
+        });
+        tsck.register_transport_dbg([](tlm::tlm_generic_payload& gp) -> unsigned { return gp.get_data_length(); });
+        tsck.register_get_direct_mem_ptr([](tlm::tlm_generic_payload&, tlm::tlm_dmi&) -> bool { return false; });
+    }
+};
+
+struct stats_tb : public sc_module {
+    tlm::scc::initiator_mixin<tlm::tlm_initiator_socket<scc::LT>> isck{"isck"};
+    scc::router<> rtr{"rtr", 2};
+    stats_target mem0{"mem0"}, mem1{"mem1"};
+
+    stats_tb()
+    : stats_tb(sc_gen_unique_name("stats_tb", false)) {}
+
+    stats_tb(sc_module_name const& nm)
+    : sc_module(nm) {
+        isck(rtr.target[0]);
+        rtr.bind_target(mem0.tsck, 0, 0x0, 0x1000);
+        rtr.bind_target(mem1.tsck, 1, 0x1000, 0x1000);
+    }
+};
+
+factory::add<stats_tb> tb;
+
+void access(tlm::tlm_command cmd, uint64_t addr, unsigned len) {
+    std::array<uint8_t, 8> data{};
+    tlm::tlm_generic_payload gp;
+    gp.set_command(cmd);
+    gp.set_address(addr);
+    gp.set_data_ptr(data.data());
+    gp.set_data_length(len);
+    gp.set_streaming_width(len);
+    sc_time d;
+    factory::get<stats_tb>().isck->b_transport(gp, d);
+    REQUIRE(gp.get_response_status() == tlm::TLM_OK_RESPONSE);
+    REQUIRE(d == 10_ns);
+}
+} // namespace
+
+TEST_CASE("socket stats of mixins and router", "[SCC][socket_stats]") {
+    auto& dut = factory::get<stats_tb>();
+    auto p = sc_spawn([&dut]() {
+        access(tlm::TLM_WRITE_COMMAND, 0x10, 8);
+        access(tlm::TLM_READ_COMMAND, 0x1010, 4);
+        access(tlm::TLM_READ_COMMAND, 0x1020, 4);
+        std::array<uint8_t, 4> data{};
+        tlm::tlm_generic_payload gp;
+        gp.set_command(tlm::TLM_READ_COMMAND);
+        gp.set_address(0x0);
+        gp.set_data_ptr(data.data());
+        gp.set_data_length(data.size());
+        gp.set_streaming_width(data.size());
+        REQUIRE(dut.isck->transport_dbg(gp) == data.size());
+        tlm::tlm_dmi dmi;
+        gp.set_address(0x1000);
+        REQUIRE_FALSE(dut.isck->get_direct_mem_ptr(gp, dmi));
+    });
+    sc_start(1_ns);
+    REQUIRE(p.terminated());
+    // the initiator and the router input see all accesses
+    for(auto* stats : {&dut.isck.get_stats(), &dut.rtr.target[0].get_stats()}) {
+        REQUIRE(stats->b_transports == 3);
+        REQUIRE(stats->writes == 1);
+        REQUIRE(stats->write_bytes == 8);
+        REQUIRE(stats->reads == 2);
+        REQUIRE(stats->read_bytes == 8);
+        REQUIRE(stats->dbg_transports == 1);
+        REQUIRE(stats->dmi_requests == 1);
+        REQUIRE(stats->dmi_grants == 0);
+        REQUIRE(stats->latency.count() == 3);
+        REQUIRE(stats->latency.min() == sc_time(10, SC_NS).value());
+    }
+    // the router outputs and the targets see the accesses to their range
+    for(auto* stats : {&dut.rtr.initiator[0].get_stats(), &dut.mem0.tsck.get_stats()}) {
+        REQUIRE(stats->b_transports == 1);
+        REQUIRE(stats->writes == 1);
+        REQUIRE(stats->reads == 0);
+        REQUIRE(stats->dbg_transports == 1);
+        REQUIRE(stats->dmi_requests == 0);
+    }
+    for(auto* stats : {&dut.rtr.initiator[1].get_stats(), &dut.mem1.tsck.get_stats()}) {
+        REQUIRE(stats->b_transports == 2);
+        REQUIRE(stats->writes == 0);
+        REQUIRE(stats->read_bytes == 8);
+        REQUIRE(stats->dbg_transports == 0);
+        REQUIRE(stats->dmi_requests == 1);
+    }
+    // the telemetry finds the counters of all sockets
+    std::map<std::string, uint64_t> transactions, bytes;
+    tlm::scc::socket_stats::for_each([&transactions, &bytes](tlm::scc::socket_stats const& s) {
+        transactions[s.get_name()] = s.transactions();
+        bytes[s.get_name()] = s.bytes();
+    });
+    REQUIRE(transactions[dut.isck.name()] == 3);
+    REQUIRE(bytes[dut.mem1.tsck.name()] == 8);
+    std::ostringstream os;
+    tlm::scc::socket_stats::dump_all(os);
+    REQUIRE(os.str().find(std::string(dut.mem0.tsck.name()) + ": b_transport=1") != std::string::npos);
+}
@@ -0,0 +1,111 @@
+#include <chrono>
+#include <factory.h>
+#include <map>
+#include <scc/startup_profiler.h>
+#include <sstream>
+#include <string>
+#include <systemc>
+#include <tuple>
+#undef CHECK
+#include <catch2/catch_all.hpp>
+
+using namespace sc_core;
+
+namespace {
+void burn(unsigned ms) {
+    auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+    while(std::chrono::steady_clock::now() < end)
+        ;
+}
+//! a module spending time in its constructor and its before_end_of_elaboration() callback
+struct busy_child : public sc_module {
+    busy_child(sc_module_name const& nm)
+    : sc_module(nm) {
+        burn(30);
+    }
+
+protected:
+    void before_end_of_elaboration() override { burn(30); }
+};
+
+struct busy_parent : public sc_module {
+    busy_child child{"child"};
+    busy_parent(sc_module_name const& nm)
+    : sc_module(nm) {
+        burn(30);
+    }
+};
+
+struct leaf : public sc_module {
+    leaf(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+//! only the leaf is wrapped, the other modules are profiled by sampling
+struct startup_tb : public sc_module {
+    scc::startup_profiler prof;
+    busy_parent busy{"busy"};
+    scc::profiled<leaf> wrapped{"wrapped"};
+
+    startup_tb()
+    : startup_tb(sc_gen_unique_name("startup_tb", false)) {}
+
+    startup_tb(sc_module_name const& nm)
+    : sc_module(nm) {}
+};
+
+factory::add<startup_tb> tb;
+//! count, total and self time in ms of the rows of the CSV report
+using report = std::map<std::pair<std::string, std::string>, std::tuple<unsigned, double, double>>;
+
+report read_report(scc::startup_profiler const& prof) {
+    std::stringstream ss;
+    prof.write_report(ss, true);
+    report res;
+    std::string line;
+    std::getline(ss, line);
+    REQUIRE(line == "category,name,count,total_ms,self_ms,cpu_ms,heap_kB");
+    while(std::getline(ss, line)) {
+        auto const name_start = line.find(",\"");
+        auto const name_end = line.find("\",", name_start + 2);
+        REQUIRE(name_end != std::string::npos);
+        unsigned count;
+        double total, self;
+        std::istringstream is(line.substr(name_end + 2));
+        char sep;
+        is >> count >> sep >> total >> sep >> self;
+        res[std::make_pair(line.substr(0, name_start), line.substr(name_start + 2, name_end - name_start - 2))] =
+            std::make_tuple(count, total, self);
+    }
+    return res;
+}
+} // namespace
+
+TEST_CASE("startup_profiler_modules", "[startup_profiler]") {
+    auto& dut = factory::get<startup_tb>();
+    REQUIRE(scc::startup_profiler::get() == &dut.prof);
+    sc_start(SC_ZERO_TIME);
+    // the report is written after start_of_simulation and recording stops
+    REQUIRE(scc::startup_profiler::get() == nullptr);
+    auto const rep = read_report(dut.prof);
+    for(auto const* phase : {"construction", "before_end_of_elaboration", "end_of_elaboration", "start_of_simulation"})
+        REQUIRE(rep.count(std::make_pair(std::string("phase"), std::string(phase))));
+    REQUIRE(std::get<0>(rep.at(std::make_pair(std::string("constructor"), std::string(dut.wrapped.name())))) == 1);
+    // the modules not being wrapped are attributed by sampling, the parent's total includes the time of its child
+    auto const parent_ctor = rep.find(std::make_pair(std::string("sampled:construction"), std::string(dut.busy.name())));
+    auto const child_ctor = rep.find(std::make_pair(std::string("sampled:construction"), std::string(dut.busy.child.name())));
+    auto const child_cb = rep.find(std::make_pair(std::string("sampled:before_end_of_elaboration"), std::string(dut.busy.child.name())));
+    REQUIRE(parent_ctor != rep.end());
+    REQUIRE(child_ctor != rep.end());
+    REQUIRE(child_cb != rep.end());
+    CHECK(std::get<2>(parent_ctor->second) > 15.0);
+    CHECK(std::get<2>(child_ctor->second) > 15.0);
+    CHECK(std::get<1>(parent_ctor->second) >= std::get<2>(parent_ctor->second) + std::get<2>(child_ctor->second));
+    CHECK(std::get<2>(child_cb->second) > 15.0);
+    CHECK(rep.count(std::make_pair(std::string("sampled:before_end_of_elaboration"), std::string(dut.busy.name()))));
+    // the samples appear as slices in the Chrome trace
+    std::stringstream trace;
+    dut.prof.write_chrome_trace(trace);
+    CHECK(trace.str().find("\"name\":\"sampled modules\"") != std::string::npos);
+    auto const slice = std::string("{\"name\":\"") + dut.busy.child.name() + "\",\"cat\":\"sampled:construction\"";
+    CHECK(trace.str().find(slice) != std::string::npos);
+}
@@ -6,15 +6,22 @@
 #include <zlib.h>
 #include <zstd.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
+#include <iterator>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include <util/bzip2_streambuf.h>
+#include <util/chunked_lz4_file.h>
+#include <util/elf_symbols.h>
 #include <util/gzip_streambuf.h>
 #include <util/xz_streambuf.h>
 #include <util/zstd_streambuf.h>
+
+#include <scc/trace/gz_writer.hh>
 // ------------------------------------------------------------
 // Helpers
 // ------------------------------------------------------------
@@ -159,9 +166,8 @@ static void compressZstd(const std::string& path, const std::string& data) {
     std::ofstream file(path, std::ios::binary);
     file.write(out.data(), compressed);
 }
-/*
-TEST_CASE("ZstdStream decompresses correctly", "[zstd]")
-{
+
+TEST_CASE("ZstdStream decompresses correctly", "[zstd]") {
     std::string text = sampleText();
     std::string file = "test.zst";
 
@@ -175,7 +181,245 @@ TEST_CASE("ZstdStream decompresses correctly", "[zstd]")
 
     std::remove(file.c_str());
 }
-*/
+// ------------------------------------------------------------
+// Compressing output streams
+// ------------------------------------------------------------
+
+template <typename OSTREAM, typename ISTREAM, typename... ARGS>
+static void roundtrip(std::string const& file, std::string const& text, ARGS... args) {
+    {
+        OSTREAM out(file, args...);
+        out << text;
+        out.close();
+    }
+    ISTREAM in(file);
+    REQUIRE(readAll(in) == text);
+    std::remove(file.c_str());
+}
+
+TEST_CASE("gzip_ostream compresses", "[gzip]") {
+    std::string text = sampleText();
+    SECTION("single threaded") { roundtrip<gzip_ostream, gzip_stream>("test_out.gz", text, 6, 0U, 4096); }
+    SECTION("independent members") { roundtrip<gzip_ostream, gzip_stream>("test_out.gz", text, 6, 4U, 4096); }
+}
+
+TEST_CASE("xz_ostream compresses", "[xz]") {
+    std::string text = sampleText();
+    SECTION("single threaded") { roundtrip<xz_ostream, xz_stream>("test_out.xz", text, 6U, 0U, 4096); }
+    SECTION("multi threaded") { roundtrip<xz_ostream, xz_stream>("test_out.xz", text, 6U, 4U, 4096); }
+}
+
+TEST_CASE("zstd_ostream compresses", "[zstd]") {
+    std::string text = sampleText();
+    SECTION("single threaded") { roundtrip<zstd_ostream, zstd_stream>("test_out.zst", text, 3, 0U, 4096); }
+    SECTION("multi threaded") { roundtrip<zstd_ostream, zstd_stream>("test_out.zst", text, 3, 4U, 4096); }
+}
+
+template <typename... ARGS> static void gzWriterRoundtrip(std::string const& file, ARGS... args) {
+    std::ostringstream expected;
+    {
+        scc::trace::gz_writer w(file, args...);
+        for(int i = 0; i < 100000; ++i) {
+            auto line = "#" + std::to_string(i * 10) + "\nb" + std::to_string(i % 97) + " !\n";
+            w.write_single(line);
+            expected << line;
+        }
+    }
+    gzip_stream in(file);
+    REQUIRE(readAll(in) == expected.str());
+    std::remove(file.c_str());
+}
+
+TEST_CASE("trace gz_writer compresses", "[gzip]") {
+    SECTION("defaults") { gzWriterRoundtrip("test_writer.gz"); }
+    SECTION("single threaded") { gzWriterRoundtrip("test_writer.gz", 9, 0U, 4096); }
+    SECTION("independent members") { gzWriterRoundtrip("test_writer.gz", 1, 4U, 4096); }
+}
+
+// ------------------------------------------------------------
+// Chunked and indexed LZ4 file
+// ------------------------------------------------------------
+
+static void writeChunked(chunked_lz4_writer& w, unsigned count) {
+    std::string def = "stream 1\nstream 2\n";
+    w.write_definition(def.data(), def.size());
+    for(auto i = 0U; i < count; ++i) {
+        w.begin_record(i * 10, 1 + (i & 1));
+        auto rec = "tx " + std::to_string(i) + "\n";
+        w.write(rec.data(), rec.size());
+    }
+}
+
+TEST_CASE("chunked_lz4 file can be searched", "[chunked]") {
+    chunked_lz4_writer::config cfg;
+    cfg.chunk_size = 1024;
+    {
+        chunked_lz4_writer w("test_chunked", ".chk", cfg);
+        REQUIRE(w.is_open());
+        writeChunked(w, 10000);
+    }
+    chunked_lz4_reader r("test_chunked.chk");
+    REQUIRE(r.has_index());
+    REQUIRE(r.chunks().size() > 10);
+    REQUIRE((r.chunks().front().flags & chunk_info::DEFINITIONS) != 0);
+    std::string all;
+    for(size_t i = 0; i < r.chunks().size(); ++i)
+        all += r.read(i);
+    REQUIRE(all.find("tx 9999\n") != std::string::npos);
+    auto idx = r.find(50000);
+    REQUIRE(idx < r.chunks().size());
+    REQUIRE(r.read(idx).find("tx 5000\n") != std::string::npos);
+    auto sel = r.select(99980, 99990, {2});
+    REQUIRE(sel.size() == 2);
+    REQUIRE(r.read(sel[0]).find("stream 1") == 0);
+    REQUIRE(r.read(sel[1]).find("tx 9999\n") != std::string::npos);
+    std::remove("test_chunked.chk");
+}
+
+TEST_CASE("chunked_lz4 file rotates", "[chunked]") {
+    chunked_lz4_writer::config cfg;
+    cfg.chunk_size = 1024;
+    cfg.max_file_time = 20000;
+    cfg.max_files = 2;
+    {
+        chunked_lz4_writer w("test_rotate", ".chk", cfg);
+        writeChunked(w, 10000);
+    }
+    REQUIRE_FALSE(std::ifstream("test_rotate.2.chk").good());
+    chunked_lz4_reader r("test_rotate.4.chk");
+    REQUIRE(r.read(0).find("stream 1") == 0);
+    REQUIRE(r.chunks().back().end_time == 99990);
+    for(auto i = 3; i < 5; ++i)
+        std::remove(("test_rotate." + std::to_string(i) + ".chk").c_str());
+}
+
+TEST_CASE("chunked_lz4 file without index is scanned", "[chunked]") {
+    chunked_lz4_writer::config cfg;
+    cfg.chunk_size = 1024;
+    {
+        chunked_lz4_writer w("test_truncated", ".chk", cfg);
+        writeChunked(w, 10000);
+    }
+    std::vector<chunk_info> chunks;
+    {
+        chunked_lz4_reader r("test_truncated.chk");
+        chunks = r.chunks();
+    }
+    // cut the file in the middle of the 6th chunk so that index and footer are lost
+    auto const& cut = chunks[5];
+    std::vector<char> content(cut.offset + 8 + cut.compressed_size / 2);
+    {
+        std::ifstream in("test_truncated.chk", std::ios::binary);
+        in.read(content.data(), content.size());
+    }
+    {
+        std::ofstream out("test_truncated.chk", std::ios::binary | std::ios::trunc);
+        out.write(content.data(), content.size());
+    }
+    chunked_lz4_reader r("test_truncated.chk");
+    REQUIRE_FALSE(r.has_index());
+    REQUIRE(r.chunks().size() == 5);
+    for(size_t i = 0; i < r.chunks().size(); ++i) {
+        REQUIRE(r.chunks()[i].offset == chunks[i].offset);
+        REQUIRE(r.read(i).size() == chunks[i].size);
+    }
+    std::remove("test_truncated.chk");
+}
+
+TEST_CASE("chunked_lz4 file indexes additional record streams", "[chunked]") {
+    chunked_lz4_writer::config cfg;
+    cfg.chunk_size = 1024;
+    {
+        chunked_lz4_writer w("test_streams", ".chk", cfg);
+        writeChunked(w, 1000);
+        // a relation between stream 1 and stream 3 which has no transaction of its own
+        w.begin_record(10000, 1);
+        w.add_record_stream(3);
+        std::string rec = "relation 1 3\n";
+        w.write(rec.data(), rec.size());
+    }
+    chunked_lz4_reader r("test_streams.chk");
+    auto sel = r.select(10000, 10000, {3});
+    REQUIRE(sel.size() == 2);
+    REQUIRE(r.read(sel[1]).find("relation 1 3\n") != std::string::npos);
+    REQUIRE(std::is_sorted(r.chunks()[sel[1]].streams.begin(), r.chunks()[sel[1]].streams.end()));
+    std::remove("test_streams.chk");
+}
+
+TEST_CASE("chunked_lz4 file with corrupt index is rejected", "[chunked]") {
+    chunked_lz4_writer::config cfg;
+    cfg.chunk_size = 1024;
+    {
+        chunked_lz4_writer w("test_corrupt", ".chk", cfg);
+        writeChunked(w, 1000);
+    }
+    std::vector<char> content;
+    {
+        std::ifstream in("test_corrupt.chk", std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    auto write_patched = [&content](size_t pos, uint64_t val, unsigned bytes) {
+        auto patched = content;
+        for(auto i = 0U; i < bytes; ++i)
+            patched[pos + i] = static_cast<char>((val >> (8 * i)) & 0xff);
+        std::ofstream out("test_corrupt.chk", std::ios::binary | std::ios::trunc);
+        out.write(patched.data(), patched.size());
+    };
+    auto const footer = content.size() - 24;
+    uint64_t idx_offset = 0;
+    for(auto i = 0U; i < 8; ++i)
+        idx_offset |= static_cast<uint64_t>(static_cast<uint8_t>(content[footer + i])) << (8 * i);
+    SECTION("index offset beyond the file") {
+        write_patched(footer, content.size() * 2, 8);
+        REQUIRE_THROWS_AS(chunked_lz4_reader("test_corrupt.chk"), std::runtime_error);
+    }
+    SECTION("chunk count beyond the index") {
+        write_patched(footer + 8, UINT64_MAX / 2, 8);
+        REQUIRE_THROWS_AS(chunked_lz4_reader("test_corrupt.chk"), std::runtime_error);
+    }
+    SECTION("stream count beyond the index") {
+        write_patched(idx_offset + 36, 0xffffffff, 4);
+        REQUIRE_THROWS_AS(chunked_lz4_reader("test_corrupt.chk"), std::runtime_error);
+    }
+    SECTION("chunk beyond the index") {
+        write_patched(idx_offset + 8, 0xffffffff, 4);
+        REQUIRE_THROWS_AS(chunked_lz4_reader("test_corrupt.chk"), std::runtime_error);
+    }
+    std::remove("test_corrupt.chk");
+}
+
+// ------------------------------------------------------------
+// Throughput benchmarks, run with: streambuf "[!benchmark]"
+// ------------------------------------------------------------
+
+static std::string benchmarkText() {
+    std::ostringstream oss;
+    for(int i = 0; i < 1000000; ++i)
+        oss << "#" << i * 10 << "\nb" << std::hex << i << std::dec << " !" << i % 97 << "\n";
+    return oss.str();
+}
+
+template <typename OSTREAM, typename... ARGS> static size_t compressFile(std::string const& file, std::string const& text, ARGS... args) {
+    OSTREAM out(file, args...);
+    out.write(text.data(), text.size());
+    out.close();
+    return text.size();
+}
+
+TEST_CASE("compression throughput", "[!benchmark]") {
+    static const auto text = benchmarkText();
+    auto const threads = std::max(2U, std::thread::hardware_concurrency());
+    BENCHMARK("gzip level 3 single threaded") { return compressFile<gzip_ostream>("bench.gz", text, 3, 0U, 1024 * 1024); };
+    BENCHMARK("gzip level 3 independent members") { return compressFile<gzip_ostream>("bench.gz", text, 3, threads, 1024 * 1024); };
+    BENCHMARK("xz level 1 single threaded") { return compressFile<xz_ostream>("bench.xz", text, 1U, 0U, 1024 * 1024); };
+    BENCHMARK("xz level 1 multi threaded") { return compressFile<xz_ostream>("bench.xz", text, 1U, threads, 1024 * 1024); };
+    BENCHMARK("zstd level 3 single threaded") { return compressFile<zstd_ostream>("bench.zst", text, 3, 0U, 0); };
+    BENCHMARK("zstd level 3 multi threaded") { return compressFile<zstd_ostream>("bench.zst", text, 3, threads, 0); };
+    std::remove("bench.gz");
+    std::remove("bench.xz");
+    std::remove("bench.zst");
+}
+
 // ------------------------------------------------------------
 // Line-by-line streaming test
 // ------------------------------------------------------------
@@ -197,3 +441,26 @@ TEST_CASE("Stream supports getline()", "[stream]") {
 
     std::remove(file.c_str());
 }
+
+// ------------------------------------------------------------
+// ELF symbol index, the test binary itself is used as input
+// ------------------------------------------------------------
+
+extern "C" int elf_symbol_probe(int a) { return a * 3 + 1; }
+
+TEST_CASE("ELF symbol lookup", "[elf]") {
+    elf_symbol_table symbols("/proc/self/exe");
+    REQUIRE(symbols.size() > 0);
+    for(size_t i = 1; i < symbols.size(); ++i)
+        REQUIRE(symbols.at(i - 1).address <= symbols.at(i).address);
+
+    elf_symbol_table::symbol sym;
+    REQUIRE(symbols.find("elf_symbol_probe", sym));
+    REQUIRE(sym.type == elf_symbol_table::FUNC);
+    REQUIRE(sym.size > 1);
+    elf_symbol_table::symbol by_addr;
+    REQUIRE(symbols.find(sym.address + 1, by_addr));
+    REQUIRE(by_addr.name == "elf_symbol_probe");
+    REQUIRE(symbols.to_string(sym.address + 1) == "elf_symbol_probe+0x1");
+    REQUIRE_FALSE(symbols.find("no_such_symbol_in_this_binary", sym));
+}